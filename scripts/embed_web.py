@@ -0,0 +1,59 @@
+# embed_web.py
+#
+# PlatformIO pre-build script: gzips web/index.html and writes it as a
+# PROGMEM byte array so the control panel is served straight from flash.
+# Also runnable by hand: `python scripts/embed_web.py`.
+
+import gzip
+import hashlib
+import os
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(PROJECT_DIR, "web", "index.html")
+TARGET = os.path.join(PROJECT_DIR, "src", "WebServerManager", "IndexHtml.h")
+
+
+def render_header(html):
+    # mtime=0 keeps the output byte-identical between builds
+    data = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(html).hexdigest()[:16]
+
+    lines = [
+        "// IndexHtml.h",
+        "// Generated by scripts/embed_web.py from web/index.html - do not edit.",
+        "#ifndef INDEX_HTML_H",
+        "#define INDEX_HTML_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        '#define INDEX_HTML_ETAG "\\"%s\\""' % etag,
+        "#define INDEX_HTML_GZ_LEN %d" % len(data),
+        "",
+        "const uint8_t INDEX_HTML_GZ[] PROGMEM = {",
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    lines += ["};", "", "#endif // INDEX_HTML_H", ""]
+    return "\n".join(lines)
+
+
+def main():
+    with open(SOURCE, "rb") as f:
+        header = render_header(f.read())
+
+    if os.path.exists(TARGET):
+        with open(TARGET, "r") as f:
+            if f.read() == header:
+                return
+
+    with open(TARGET, "w") as f:
+        f.write(header)
+    print("embed_web: wrote %s" % os.path.relpath(TARGET, PROJECT_DIR))
+
+
+main()
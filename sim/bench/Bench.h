@@ -0,0 +1,56 @@
+// Bench.h
+// Tiny host micro-benchmark harness: best-of-N wall time per operation.
+#ifndef SIM_BENCH_H
+#define SIM_BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+namespace Bench {
+    // Set from the command line; a benchmark runs if its name contains it
+    extern const char* filter;
+
+    // Heap allocations so far, counted by the operator new in BenchMain.cpp
+    extern std::atomic<uint64_t> allocations;
+
+    // Keeps a result alive so the optimizer cannot drop the work
+    template <typename T>
+    inline void keep(const T& value) {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+
+    inline void run(const char* name, uint32_t iterations, const std::function<void(uint32_t)>& body) {
+        if (filter && !strstr(name, filter)) return;
+        double best = 1e30;
+        for (int round = 0; round < 5; round++) {
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < iterations; i++) body(i);
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            if (ns < best) best = ns;
+        }
+        printf("%-44s %10.1f ns/op\n", name, best / iterations);
+    }
+
+    // run() plus heap allocations per operation, counted over one extra pass
+    inline void runCountingAllocations(const char* name, uint32_t iterations,
+                                       const std::function<void(uint32_t)>& body) {
+        if (filter && !strstr(name, filter)) return;
+        uint64_t before = allocations.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < iterations; i++) body(i);
+        double perOp = (double)(allocations.load(std::memory_order_relaxed) - before) / iterations;
+        double best = 1e30;
+        for (int round = 0; round < 5; round++) {
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < iterations; i++) body(i);
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            if (ns < best) best = ns;
+        }
+        printf("%-44s %10.1f ns/op %8.2f allocs/op\n", name, best / iterations, perOp);
+    }
+}
+
+#endif // SIM_BENCH_H
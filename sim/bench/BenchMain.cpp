@@ -0,0 +1,344 @@
+// BenchMain.cpp
+// Host micro-benchmarks for firmware hot paths. Numbers are host time and
+// only meaningful relative to each other (and to earlier runs).
+#include <Arduino.h>
+#include <stdlib.h>
+#include <new>
+#include "Bench.h"
+#include "LEDController/ColorFade.h"
+#include "LEDController/ColorParser.h"
+#include "LEDController/LEDCommand.h"
+#include "LEDController/LightRamp.h"
+#include "LEDController/OutputStage.h"
+#include "LEDController/StripConfig.h"
+#include "ScheduleManager/ScheduleTable.h"
+#include "Telemetry/LatencyHistogram.h"
+#include "Telemetry/Telemetry.h"
+#include "Trace/Trace.h"
+
+const char* Bench::filter = nullptr;
+std::atomic<uint64_t> Bench::allocations(0);
+
+// Every heap allocation in the process goes through here, String included
+void* operator new(size_t size) {
+    Bench::allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+namespace {
+    const uint16_t STRIP_SIZES[] = { 1, 60, 300 };
+
+    void benchFade() {
+        static CRGB leds[300];
+        const LedEasing easings[] = { LedEasing::Linear, LedEasing::EaseInOut };
+
+        for (LedEasing easing : easings) {
+            char name[64];
+            snprintf(name, sizeof(name), "fade/step/%s", ledEasingName(easing));
+            ColorFade fade;
+            Bench::run(name, 1000000, [&](uint32_t i) {
+                // One 800 ms fade per 80 frames, restarted mid-fade like a retarget
+                if (i % 80 == 0) fade.start(CRGB(i, 40, 200), CRGB::Red, i * 10, 800, easing);
+                CRGB color = fade.step(i * 10);
+                Bench::keep(color);
+            });
+        }
+
+        for (uint16_t count : STRIP_SIZES) {
+            char name[64];
+            snprintf(name, sizeof(name), "fade/frame/%u-leds", count);
+            ColorFade fade;
+            Bench::run(name, 200000, [&](uint32_t i) {
+                if (i % 80 == 0) fade.start(CRGB::Green, CRGB::Red, i * 10, 800, LedEasing::EaseInOut);
+                fill_solid(leds, count, fade.step(i * 10));
+                Bench::keep(leds[count - 1]);
+            });
+        }
+    }
+
+    // The frame path with the strip length fixed at compile time against
+    // the same path on a buffer allocated for a length read at boot
+    template <uint16_t COUNT>
+    void benchFixedStrip() {
+        static CRGB leds[COUNT];
+        char name[64];
+        snprintf(name, sizeof(name), "strip/frame/fixed-%u", COUNT);
+        Bench::run(name, 1000000, [&](uint32_t i) {
+            fill_solid(leds, COUNT, CRGB(i, 40, 200));
+            Bench::keep(leds[COUNT - 1]);
+        });
+    }
+
+    void benchRuntimeStrip(uint16_t count) {
+        StripConfig config = { count, 1, { 23 }, LedChipset::WS2812 };
+        Bench::keep(config);
+        CRGB* leds = new CRGB[config.totalPixels()]();
+        char name[64];
+        snprintf(name, sizeof(name), "strip/frame/runtime-%u", count);
+        Bench::run(name, 1000000, [&](uint32_t i) {
+            fill_solid(leds, config.totalPixels(), CRGB(i, 40, 200));
+            Bench::keep(leds[config.totalPixels() - 1]);
+        });
+        delete[] leds;
+    }
+
+    void benchStrip() {
+        benchFixedStrip<12>();
+        benchRuntimeStrip(12);
+        benchFixedStrip<60>();
+        benchRuntimeStrip(60);
+    }
+
+    // The output stage per frame: a solid zone (runs convert once), every
+    // pixel different, and the 8-bit scale-and-correct it replaced; then
+    // the same solid zone in the dim band, where every pixel is dithered
+    void benchOutput() {
+        static CRGB scene[300];
+        static CRGB out[300];
+        OutputStage stage;
+        stage.setBrightnessPercent(100);
+        OutputStage dim;
+        dim.setBrightnessPercent(3);
+
+        for (uint16_t count : STRIP_SIZES) {
+            char name[64];
+            snprintf(name, sizeof(name), "output/frame/%u-leds", count);
+            Bench::run(name, 200000, [&](uint32_t i) {
+                fill_solid(scene, count, CRGB(i, 40, 200));
+                stage.render(scene, out, count, (uint8_t)i);
+                Bench::keep(out[count - 1]);
+            });
+
+            snprintf(name, sizeof(name), "output/frame/%u-leds-mixed", count);
+            Bench::run(name, 200000, [&](uint32_t i) {
+                for (uint16_t p = 0; p < count; p++) scene[p] = CRGB(i + p, 40, 200);
+                stage.render(scene, out, count, (uint8_t)i);
+                Bench::keep(out[count - 1]);
+            });
+
+            snprintf(name, sizeof(name), "output/frame/%u-leds-scale8", count);
+            CRGB adjustment = CRGB(TypicalLEDStrip).nscale8(13);
+            Bench::run(name, 200000, [&](uint32_t i) {
+                for (uint16_t p = 0; p < count; p++) scene[p] = CRGB(i + p, 40, 200);
+                for (uint16_t p = 0; p < count; p++) {
+                    out[p] = CRGB(scale8(scene[p].r, adjustment.r), scale8(scene[p].g, adjustment.g),
+                                  scale8(scene[p].b, adjustment.b));
+                }
+                Bench::keep(out[count - 1]);
+            });
+
+            snprintf(name, sizeof(name), "output/dither/%u-leds", count);
+            Bench::run(name, 200000, [&](uint32_t i) {
+                fill_solid(scene, count, CRGB(i, 40, 200));
+                dim.render(scene, out, count, (uint8_t)i);
+                Bench::keep(out[count - 1]);
+            });
+        }
+    }
+
+    // Per loop() pass, and once per publish: snapshot plus serialization
+    void benchTelemetry() {
+        Bench::run("telemetry/recordLoop", 5000000, [&](uint32_t i) {
+            Telemetry::recordLoop((i * 2654435761u) >> 20);
+        });
+        Bench::run("telemetry/sample+format", 200000, [&](uint32_t i) {
+            for (uint32_t n = 0; n < 100; n++) Telemetry::recordLoop(n * 37 + i);
+            TelemetrySample sample;
+            Telemetry::sample(sample);
+            sample.mqttReconnects = i;
+            sample.mqttFailures = 0;
+            char payload[TELEMETRY_PAYLOAD_SIZE];
+            Bench::keep(Telemetry::format(sample, payload, sizeof(payload)));
+        });
+    }
+
+    // Counts bytes instead of keeping them, like a response that was
+    // reserved large enough up front
+    class NullPrint : public Print {
+    public:
+        size_t bytes = 0;
+        size_t write(uint8_t) override { bytes++; return 1; }
+        size_t write(const uint8_t*, size_t length) override { bytes += length; return length; }
+    };
+
+    // One observation per timed section, and one histogram's share of a
+    // /metrics scrape
+    void benchMetrics() {
+        LatencyHistogram histogram;
+        Bench::run("metrics/observe", 5000000, [&](uint32_t i) {
+            histogram.observe((i * 2654435761u) >> 15);
+        });
+        NullPrint out;
+        Bench::run("metrics/histogram-text", 100000, [&](uint32_t) {
+            histogram.writePrometheus(out, "otwu_loop_duration_seconds", "Time spent in one loop() pass");
+        });
+        Bench::keep(out.bytes);
+    }
+
+    // A begin/end pair around an empty section, and a full ring exported
+    // in TCP-segment-sized pieces
+    void benchTrace() {
+#if OTWU_TRACE
+        Bench::run("trace/scope", 2000000, [&](uint32_t) {
+            TRACE_SCOPE(LedShow);
+        });
+        char segment[1460];
+        Bench::run("trace/export", 200, [&](uint32_t) {
+            TraceJsonWriter writer;
+            size_t bytes = 0;
+            while (size_t length = writer.fill(segment, sizeof(segment))) bytes += length;
+            Bench::keep(bytes);
+        });
+#endif
+    }
+
+    // Not timed: the wire model for both output drivers, N outputs x M LEDs
+    void reportWireModel() {
+        if (Bench::filter && !strstr("wire", Bench::filter)) return;
+        const uint8_t OUTPUTS[] = { 1, 2, 4, 8 };
+        const uint16_t COUNTS[] = { 12, 60, 300 };
+        const LedDriver DRIVERS[] = { LedDriver::Rmt, LedDriver::I2s };
+        for (LedDriver driver : DRIVERS) {
+            for (uint8_t outputs : OUTPUTS) {
+                for (uint16_t count : COUNTS) {
+                    WireTiming timing = modelWireTiming(driver, LedChipset::WS2812, outputs, count);
+                    char name[64];
+                    snprintf(name, sizeof(name), "wire/%s/%ux%u", ledDriverName(driver), outputs, count);
+                    printf("%-44s %10u us/frame %6u irq\n", name, timing.frameUs, timing.interrupts);
+                }
+            }
+        }
+    }
+
+    // A million MQTT payloads through the span parser, against the String
+    // path it replaced: append byte by byte, trim(), then a chain of String
+    // compares and a copy into the current color. The host String keeps
+    // short text inline, so its allocation count is a lower bound
+    void benchMqttPayloads() {
+        const char* const PAYLOADS[] = {
+            "blue", "green", "red", "ping", "brightness:40", "mode:auto", " #00FF80 ", "hsv(200, 80, 100)",
+        };
+        const size_t COUNT = sizeof(PAYLOADS) / sizeof(PAYLOADS[0]);
+        size_t lengths[COUNT];
+        for (size_t i = 0; i < COUNT; i++) lengths[i] = strlen(PAYLOADS[i]);
+
+        Bench::runCountingAllocations("mqtt/payload/span", 1000000, [&](uint32_t i) {
+            LEDCommand command;
+            bool ok = parseLEDCommand(PAYLOADS[i % COUNT], lengths[i % COUNT], command);
+            Bench::keep(ok);
+            Bench::keep(command);
+        });
+
+        String current;
+        Bench::runCountingAllocations("mqtt/payload/string", 1000000, [&](uint32_t i) {
+            const char* payload = PAYLOADS[i % COUNT];
+            String message;
+            for (size_t n = 0; n < lengths[i % COUNT]; n++) message += payload[n];
+            message.trim();
+            if (message == "ping") return;
+            CRGB color = message == "green" ? CRGB::Green
+                       : message == "red"   ? CRGB::Red
+                       : message == "blue"  ? CRGB::Blue
+                                            : CRGB::Black;
+            current = message;
+            Bench::keep(color);
+        });
+        Bench::keep(current);
+    }
+
+    void benchParse() {
+        struct Input {
+            const char* name;
+            const char* text;
+        };
+        const Input INPUTS[] = {
+            { "parse/color/name", "warmwhite" },
+            { "parse/color/hex", "#FFA757" },
+            { "parse/color/hsv", "hsv(30, 100, 80)" },
+            { "parse/color/kelvin", "kelvin:2750" },
+            { "parse/color/palette", "ocean:128" },
+            { "parse/color/reject", "hsv(30,100,8x)" },
+        };
+        for (const Input& input : INPUTS) {
+            size_t length = strlen(input.text);
+            Bench::run(input.name, 2000000, [&](uint32_t) {
+                CRGB color;
+                bool ok = parseColor(input.text, length, color);
+                Bench::keep(ok);
+                Bench::keep(color);
+            });
+        }
+        // Whole MQTT payloads, keyword commands included
+        const char* const PAYLOADS[] = { "blue", "brightness:40", "mode:auto", " #00FF80 ", "kelvin=6500" };
+        Bench::run("parse/command/mix", 2000000, [&](uint32_t i) {
+            const char* payload = PAYLOADS[i % 5];
+            LEDCommand command;
+            bool ok = parseLEDCommand(payload, strlen(payload), command);
+            Bench::keep(ok);
+            Bench::keep(command);
+        });
+        benchMqttPayloads();
+
+        char text[COLOR_TEXT_SIZE];
+        Bench::run("format/color", 2000000, [&](uint32_t i) {
+            Bench::keep(formatColor(CRGB(i * 2654435761u), text));
+        });
+    }
+
+    // One scheduler evaluation: the bitmap lookup against the string
+    // compare it replaced (format "HH:MM", compare with the stored times)
+    void benchSchedule() {
+        ScheduleTable table;
+        table.compile("07:30-08:00,19:00-19:05");
+        Bench::run("schedule/isGreen/bitmap", 5000000, [&](uint32_t i) {
+            Bench::keep(table.isGreen(i % ScheduleTable::MINUTES_PER_DAY));
+        });
+        const String greenTime = "07:30";
+        const String redTime = "19:05";
+        Bench::run("schedule/isGreen/sprintf-string", 5000000, [&](uint32_t i) {
+            uint16_t minute = i % ScheduleTable::MINUTES_PER_DAY;
+            char currentTime[6];
+            sprintf(currentTime, "%02d:%02d", minute / 60, minute % 60);
+            int color = greenTime == currentTime ? 1 : redTime == currentTime ? 2 : 0;
+            Bench::keep(color);
+        });
+        Bench::run("schedule/nextTransition", 2000000, [&](uint32_t i) {
+            Bench::keep(table.nextTransition(i % ScheduleTable::MINUTES_PER_DAY));
+        });
+    }
+
+    void benchRamp() {
+        // 30 min sunrise sampled across its whole length
+        const LightRamp ramp = { RampKind::Sunrise, 0, 30 * 60000UL };
+        Bench::run("ramp/colorAt", 1000000, [&](uint32_t i) {
+            Bench::keep(ramp.colorAt((int64_t)(i % 1800000)));
+        });
+        Bench::run("ramp/nextChangeMs", 200000, [&](uint32_t i) {
+            Bench::keep(ramp.nextChangeMs((int64_t)(i * 9 % 1800000)));
+        });
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) Bench::filter = argv[1];
+    benchFade();
+    benchRamp();
+    benchSchedule();
+    benchParse();
+    benchStrip();
+    benchOutput();
+    benchTelemetry();
+    benchMetrics();
+    benchTrace();
+    reportWireModel();
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Arduino.h
+// Host stand-in for the parts of the ESP32 Arduino core the firmware uses.
+// Time is virtual: it only moves when the firmware calls delay() (or a
+// scenario calls SimClock::advance), see Sim.h.
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+#include <functional>
+
+#include "WString.h"
+#include "Print.h"
+#include "IPAddress.h"
+#include "freertos_sim.h"
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#define PGM_P const char*
+#define IRAM_ATTR
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// Same declarations as FastLED's stub platform so both can be included
+extern "C" {
+    uint32_t millis(void);
+    uint32_t micros(void);
+    void delay(int ms);
+    void yield(void);
+}
+
+uint32_t esp_random();
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char* server1,
+                const char* server2 = nullptr, const char* server3 = nullptr);
+void configTzTime(const char* tz, const char* server1, const char* server2 = nullptr, const char* server3 = nullptr);
+
+// glibc grew its own strlcpy in 2.38
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 38))
+#define SIM_HAVE_STRLCPY 1
+#else
+#define SIM_HAVE_STRLCPY 0
+size_t strlcpy(char* dst, const char* src, size_t size);
+#endif
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t length) override;
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    void restart();
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getHeapSize();
+};
+
+extern EspClass ESP;
+
+#endif // SIM_ARDUINO_H
@@ -0,0 +1,15 @@
+// DNSServer.h
+#ifndef SIM_DNSSERVER_H
+#define SIM_DNSSERVER_H
+
+#include <Arduino.h>
+
+class DNSServer {
+public:
+    void setTTL(uint32_t) {}
+    bool start(uint16_t, const String&, const IPAddress&) { return true; }
+    void processNextRequest() {}
+    void stop() {}
+};
+
+#endif // SIM_DNSSERVER_H
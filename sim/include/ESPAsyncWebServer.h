@@ -0,0 +1,240 @@
+// ESPAsyncWebServer.h
+// Host stand-in for ESPAsyncWebServer. Handlers are registered as on the
+// device; SimHttp (Sim.h) invokes them synchronously and captures the
+// response. Event sources record frames instead of writing sockets.
+#ifndef SIM_ESPASYNCWEBSERVER_H
+#define SIM_ESPASYNCWEBSERVER_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+typedef enum {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT = 0b00001000,
+    HTTP_PATCH = 0b00010000,
+    HTTP_HEAD = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServerRequest;
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total)> ArBodyHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, const String& filename, size_t index,
+                           uint8_t* data, size_t len, bool final)> ArUploadHandlerFunction;
+// Fills up to maxLen bytes of a chunked response; 0 ends it
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+class AsyncWebHeader {
+public:
+    AsyncWebHeader(const String& name, const String& value) : _name(name), _value(value) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+
+private:
+    String _name;
+    String _value;
+};
+
+class AsyncWebParameter {
+public:
+    AsyncWebParameter(const String& name, const String& value, bool form = false)
+        : _name(name), _value(value), _isForm(form) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+    bool isPost() const { return _isForm; }
+
+private:
+    String _name;
+    String _value;
+    bool _isForm;
+};
+
+class AsyncWebServerResponse {
+public:
+    AsyncWebServerResponse(int code, const String& contentType) : _code(code), _contentType(contentType) {}
+    virtual ~AsyncWebServerResponse() {}
+    void addHeader(const String& name, const String& value) { _headers.emplace_back(name, value); }
+    void setCode(int code) { _code = code; }
+
+    int code() const { return _code; }
+    const String& contentType() const { return _contentType; }
+    const std::vector<AsyncWebHeader>& headers() const { return _headers; }
+    std::string& body() { return _body; }
+    // Sim side: produces the body of responses that are generated while
+    // being sent
+    virtual void finish() {}
+
+protected:
+    int _code;
+    String _contentType;
+    std::vector<AsyncWebHeader> _headers;
+    std::string _body;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+public:
+    AsyncResponseStream(const String& contentType, size_t bufferSize)
+        : AsyncWebServerResponse(200, contentType) { _body.reserve(bufferSize); }
+    size_t write(uint8_t c) override { _body += (char)c; return 1; }
+    size_t write(const uint8_t* data, size_t length) override { _body.append((const char*)data, length); return length; }
+    size_t available() const { return _body.size(); }
+    using Print::write;
+};
+
+// The filler runs once per TCP segment on the device; here it runs when
+// the request completes, one segment's worth at a time
+class AsyncChunkedResponse : public AsyncWebServerResponse {
+public:
+    AsyncChunkedResponse(const String& contentType, AwsResponseFiller filler)
+        : AsyncWebServerResponse(200, contentType), _filler(filler) {}
+    void finish() override;
+
+private:
+    AwsResponseFiller _filler;
+};
+
+class AsyncWebServerRequest {
+public:
+    AsyncWebServerRequest(WebRequestMethod method, const String& url, const String& host);
+    ~AsyncWebServerRequest();
+
+    WebRequestMethod method() const { return _method; }
+    const String& url() const { return _url; }
+    const String& host() const { return _host; }
+
+    bool hasParam(const String& name, bool post = false, bool file = false) const;
+    AsyncWebParameter* getParam(const String& name, bool post = false, bool file = false) const;
+    size_t params() const { return _params.size(); }
+    AsyncWebParameter* getParam(size_t index) const;
+    bool hasHeader(const String& name) const { return getHeader(name) != nullptr; }
+    AsyncWebHeader* getHeader(const String& name) const;
+
+    void send(AsyncWebServerResponse* response);
+    void send(int code, const String& contentType = String(), const String& content = String());
+    void send_P(int code, const String& contentType, const char* content);
+    void send_P(int code, const String& contentType, const uint8_t* content, size_t length);
+    void redirect(const String& url);
+
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(), const String& content = String());
+    AsyncWebServerResponse* beginResponse_P(int code, const String& contentType, const uint8_t* content, size_t length);
+    AsyncResponseStream* beginResponseStream(const String& contentType, size_t bufferSize = 1460);
+    AsyncWebServerResponse* beginChunkedResponse(const String& contentType, AwsResponseFiller callback);
+
+    // Scratch space for handlers, free()d with the request
+    void* _tempObject = nullptr;
+
+    // Sim side
+    void addParam(const String& name, const String& value, bool post);
+    void addHeader(const String& name, const String& value);
+    void setBody(const std::string& body) { _rawBody = body; }
+    const std::string& rawBody() const { return _rawBody; }
+    AsyncWebServerResponse* response() const { return _response; }
+
+private:
+    WebRequestMethod _method;
+    String _url;
+    String _host;
+    std::string _rawBody;
+    std::vector<AsyncWebParameter*> _params;
+    std::vector<AsyncWebHeader*> _headers;
+    AsyncWebServerResponse* _response = nullptr;
+};
+
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() {}
+};
+
+class AsyncEventSourceClient {
+public:
+    explicit AsyncEventSourceClient(class AsyncEventSource* source) : _source(source) {}
+    void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+    size_t packetsWaiting() const { return _queued; }
+
+private:
+    friend class AsyncEventSource;
+    AsyncEventSource* _source;
+    size_t _queued = 0;
+};
+
+class AsyncEventSource : public AsyncWebHandler {
+public:
+    struct Frame {
+        std::string event;
+        std::string data;
+        uint32_t id;
+    };
+
+    typedef std::function<void(AsyncEventSourceClient* client)> ArEventHandlerFunction;
+
+    explicit AsyncEventSource(const String& url) : _url(url) {}
+    ~AsyncEventSource();
+
+    const String& url() const { return _url; }
+    void onConnect(ArEventHandlerFunction callback) { _connectCallback = callback; }
+    void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+    bool try_send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+    size_t count() const { return _clients.size(); }
+    size_t avgPacketsWaiting() const;
+
+    // Sim side
+    AsyncEventSourceClient* connectClient();
+    void disconnectClients();
+    void drain();
+    const std::vector<Frame>& frames() const { return _frames; }
+
+private:
+    friend class AsyncEventSourceClient;
+    String _url;
+    ArEventHandlerFunction _connectCallback;
+    std::vector<AsyncEventSourceClient*> _clients;
+    std::vector<Frame> _frames;
+    size_t _maxQueued = 32;
+
+    void record(const char* message, const char* event, uint32_t id);
+};
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t port) : _port(port) {}
+    ~AsyncWebServer();
+
+    void begin();
+    void end() { _running = false; }
+    void on(const char* uri, ArRequestHandlerFunction onRequest) { on(uri, HTTP_ANY, onRequest); }
+    void on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest);
+    void on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+            ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody = nullptr);
+    void onNotFound(ArRequestHandlerFunction onRequest) { _notFound = onRequest; }
+    AsyncWebHandler& addHandler(AsyncWebHandler* handler);
+
+    // Sim side: true when a route (or the not-found handler) took the request
+    bool dispatch(AsyncWebServerRequest* request);
+    bool dispatchNotFound(AsyncWebServerRequest* request);
+    AsyncEventSource* eventSource(const String& url) const;
+    void drainEvents();
+    bool running() const { return _running; }
+
+private:
+    struct Route {
+        std::string uri;
+        WebRequestMethodComposite method;
+        ArRequestHandlerFunction onRequest;
+        ArBodyHandlerFunction onBody;
+    };
+
+    uint16_t _port;
+    bool _running = false;
+    std::vector<Route> _routes;
+    std::vector<AsyncEventSource*> _eventSources;
+    ArRequestHandlerFunction _notFound;
+};
+
+#endif // SIM_ESPASYNCWEBSERVER_H
@@ -0,0 +1,26 @@
+// IPAddress.h
+#ifndef SIM_IPADDRESS_H
+#define SIM_IPADDRESS_H
+
+#include <stdint.h>
+#include "WString.h"
+
+class IPAddress {
+public:
+    IPAddress() : _bytes{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+    explicit IPAddress(uint32_t address) { memcpy(_bytes, &address, 4); }
+
+    operator uint32_t() const { uint32_t v; memcpy(&v, _bytes, 4); return v; }
+    uint8_t operator[](int index) const { return _bytes[index]; }
+    uint8_t& operator[](int index) { return _bytes[index]; }
+    bool operator==(const IPAddress& other) const { return memcmp(_bytes, other._bytes, 4) == 0; }
+    bool operator!=(const IPAddress& other) const { return !(*this == other); }
+
+    String toString() const;
+
+private:
+    uint8_t _bytes[4];
+};
+
+#endif // SIM_IPADDRESS_H
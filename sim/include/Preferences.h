@@ -0,0 +1,42 @@
+// Preferences.h
+// Host stand-in for the ESP32 NVS Preferences API. Namespaces live in one
+// in-memory store shared by all instances; SimNvs counts committed writes.
+#ifndef SIM_PREFERENCES_H
+#define SIM_PREFERENCES_H
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false);
+    void end() { _open = false; }
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    size_t putUChar(const char* key, uint8_t value) { return putValue(key, value) ? 1 : 0; }
+    size_t putUInt(const char* key, uint32_t value) { return putValue(key, value) ? 4 : 0; }
+    size_t putInt(const char* key, int32_t value) { return putValue(key, (uint32_t)value) ? 4 : 0; }
+    size_t putULong64(const char* key, uint64_t value);
+    size_t putString(const char* key, const char* value);
+    size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+    size_t putBytes(const char* key, const void* value, size_t length);
+
+    uint8_t getUChar(const char* key, uint8_t defaultValue = 0) { return (uint8_t)getValue(key, defaultValue); }
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0) { return (uint32_t)getValue(key, defaultValue); }
+    int32_t getInt(const char* key, int32_t defaultValue = 0) { return (int32_t)getValue(key, (uint32_t)defaultValue); }
+    uint64_t getULong64(const char* key, uint64_t defaultValue = 0) { return getValue(key, defaultValue); }
+    String getString(const char* key, const String& defaultValue = String());
+    size_t getBytesLength(const char* key);
+    size_t getBytes(const char* key, void* buffer, size_t maxLength);
+
+private:
+    String _ns;
+    bool _open = false;
+    bool _readOnly = false;
+
+    bool putValue(const char* key, uint64_t value);
+    uint64_t getValue(const char* key, uint64_t defaultValue);
+};
+
+#endif // SIM_PREFERENCES_H
@@ -0,0 +1,80 @@
+// PubSubClient.h
+// Host stand-in for PubSubClient talking to the in-process SimBroker
+// (Sim.h). Publishes are routed to matching subscriptions, including the
+// publisher's own, just like a real broker echoes a subscribed topic.
+#ifndef SIM_PUBSUBCLIENT_H
+#define SIM_PUBSUBCLIENT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+#define MQTT_CONNECTION_TIMEOUT (-4)
+#define MQTT_CONNECTION_LOST    (-3)
+#define MQTT_CONNECT_FAILED     (-2)
+#define MQTT_DISCONNECTED       (-1)
+#define MQTT_CONNECTED          0
+
+#define MQTT_CALLBACK_SIGNATURE std::function<void(char*, uint8_t*, unsigned int)> callback
+
+class PubSubClient {
+public:
+    explicit PubSubClient(Client& client);
+    ~PubSubClient();
+
+    PubSubClient& setServer(IPAddress ip, uint16_t port);
+    PubSubClient& setServer(const char* host, uint16_t port);
+    PubSubClient& setCallback(MQTT_CALLBACK_SIGNATURE);
+    PubSubClient& setSocketTimeout(uint16_t timeoutS) { _socketTimeoutS = timeoutS; return *this; }
+    PubSubClient& setKeepAlive(uint16_t keepAliveS) { _keepAliveS = keepAliveS; return *this; }
+    bool setBufferSize(uint16_t size) { _bufferSize = size; return true; }
+    uint16_t getBufferSize() const { return _bufferSize; }
+
+    bool connect(const char* id);
+    bool connect(const char* id, const char* user, const char* pass);
+    bool connect(const char* id, const char* willTopic, uint8_t willQos, bool willRetain, const char* willMessage);
+    bool connect(const char* id, const char* user, const char* pass,
+                 const char* willTopic, uint8_t willQos, bool willRetain, const char* willMessage);
+    bool connect(const char* id, const char* user, const char* pass,
+                 const char* willTopic, uint8_t willQos, bool willRetain, const char* willMessage,
+                 bool cleanSession);
+    void disconnect();
+
+    bool publish(const char* topic, const char* payload);
+    bool publish(const char* topic, const char* payload, bool retained);
+    bool publish(const char* topic, const uint8_t* payload, unsigned int length);
+    bool publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained);
+    bool subscribe(const char* topic, uint8_t qos = 0);
+    bool unsubscribe(const char* topic);
+
+    bool loop();
+    bool connected();
+    int state() const { return _state; }
+
+private:
+    friend class SimBrokerCore;
+
+    struct Message {
+        std::string topic;
+        std::string payload;
+    };
+
+    std::function<void(char*, uint8_t*, unsigned int)> _callback;
+    std::vector<std::string> _subscriptions;
+    std::deque<Message> _inbox;
+    std::string _id;
+    std::string _willTopic;
+    std::string _willMessage;
+    bool _willRetain = false;
+    uint16_t _socketTimeoutS = 15;
+    uint16_t _keepAliveS = 15;
+    uint16_t _bufferSize = 256;
+    uint32_t _session = 0;
+    int _state = MQTT_DISCONNECTED;
+
+    bool isSubscribed(const std::string& topic) const;
+};
+
+#endif // SIM_PUBSUBCLIENT_H
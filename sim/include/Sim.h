@@ -0,0 +1,91 @@
+// Sim.h
+// Scenario-side controls for the host simulation. Firmware code never
+// includes this; the stand-in headers are all it sees.
+#ifndef SIM_H
+#define SIM_H
+
+#include <ESPAsyncWebServer.h>
+#include <stdint.h>
+#include <time.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SimClock {
+    // Microseconds since boot; only moves in advance()
+    uint64_t nowUs();
+    // Moves virtual time forward, firing esp_timer callbacks and waking
+    // blocked tasks in time order, then waits until every task is idle again
+    void advance(uint64_t us);
+    // Wall clock as the firmware sees it (0-based until the first sync)
+    time_t wallTime();
+}
+
+namespace SimNtp {
+    // True UTC "now"; the device clock only learns it on a successful sync
+    void setTime(time_t epoch);
+    void setReachable(bool reachable);
+    void setSyncDelayMs(uint32_t delayMs);
+    // The device crystal runs fast by this much from now on (negative: slow)
+    void setDriftPpm(int32_t ppm);
+    // Device wall clock minus true time
+    int64_t clockErrorUs();
+    uint32_t syncCount();
+}
+
+namespace SimWiFi {
+    void setApAvailable(bool available);
+    void setConnectDelayMs(uint32_t delayMs);
+    void addScanResult(const char* ssid, int8_t rssi, bool open);
+}
+
+namespace SimBroker {
+    struct Message {
+        std::string topic;
+        std::string payload;
+        bool retained;
+        uint64_t atUs;
+        bool fromDevice;
+    };
+
+    void setAvailable(bool available);
+    // Publishes as an external client (dashboard, home automation, ...)
+    void inject(const char* topic, const char* payload, bool retained = false);
+    const std::vector<Message>& log();
+    bool retained(const char* topic, std::string* payload);
+    uint32_t connectCount();
+}
+
+namespace SimHttp {
+    struct Response {
+        int code;
+        std::string contentType;
+        std::string body;
+        std::vector<std::pair<std::string, std::string>> headers;
+
+        std::string header(const char* name) const;
+    };
+
+    // url may carry a query string; body is parsed as form fields on POST
+    Response request(WebRequestMethod method, const char* url,
+                     const std::vector<std::pair<std::string, std::string>>& headers = {},
+                     const std::string& body = std::string());
+    // Opens an EventSource client on path; frames land in events(path)
+    bool connectEvents(const char* path);
+    const std::vector<AsyncEventSource::Frame>* events(const char* path);
+    // Lets every open event stream catch up (a fast client)
+    void drainEvents();
+}
+
+namespace SimNvs {
+    uint32_t writeCount();
+    uint32_t eraseCount();
+}
+
+namespace SimSystem {
+    void setSerialEcho(bool echo);
+    void seedRandom(uint32_t seed);
+    uint32_t restartCount();
+}
+
+#endif // SIM_H
@@ -0,0 +1,82 @@
+// WString.h
+// Host stand-in for the Arduino String class, backed by std::string.
+#ifndef SIM_WSTRING_H
+#define SIM_WSTRING_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+class String {
+public:
+    String() {}
+    String(const char* text) : _s(text ? text : "") {}
+    String(const std::string& text) : _s(text) {}
+    explicit String(char c) : _s(1, c) {}
+    explicit String(int value, unsigned char base = 10) : _s(format((long)value, base)) {}
+    explicit String(unsigned int value, unsigned char base = 10) : _s(formatUnsigned(value, base)) {}
+    explicit String(long value, unsigned char base = 10) : _s(format(value, base)) {}
+    explicit String(unsigned long value, unsigned char base = 10) : _s(formatUnsigned(value, base)) {}
+    explicit String(double value, unsigned int decimals = 2);
+
+    const char* c_str() const { return _s.c_str(); }
+    unsigned int length() const { return (unsigned int)_s.size(); }
+    bool isEmpty() const { return _s.empty(); }
+    bool reserve(unsigned int size) { _s.reserve(size); return true; }
+
+    String& operator=(const char* text) { _s = text ? text : ""; return *this; }
+    String& operator+=(const String& other) { _s += other._s; return *this; }
+    String& operator+=(const char* text) { if (text) _s += text; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+    String& operator+=(int value) { _s += format(value, 10); return *this; }
+    String& operator+=(unsigned int value) { _s += formatUnsigned(value, 10); return *this; }
+    String& operator+=(long value) { _s += format(value, 10); return *this; }
+    String& operator+=(unsigned long value) { _s += formatUnsigned(value, 10); return *this; }
+    bool concat(const String& other) { _s += other._s; return true; }
+    bool concat(const char* text) { if (text) _s += text; return true; }
+    bool concat(char c) { _s += c; return true; }
+
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    friend String operator+(const String& a, const char* b) { return String(a._s + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String(std::string(a ? a : "") + b._s); }
+    friend String operator+(const String& a, char b) { return String(a._s + b); }
+
+    bool operator==(const String& other) const { return _s == other._s; }
+    bool operator==(const char* text) const { return _s == (text ? text : ""); }
+    bool operator!=(const String& other) const { return _s != other._s; }
+    bool operator!=(const char* text) const { return !(*this == text); }
+    bool operator<(const String& other) const { return _s < other._s; }
+    bool equals(const String& other) const { return _s == other._s; }
+    bool equals(const char* text) const { return *this == text; }
+    bool equalsIgnoreCase(const String& other) const;
+
+    char charAt(unsigned int index) const { return index < _s.size() ? _s[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index) { return _s[index]; }
+
+    int indexOf(char c, unsigned int from = 0) const { return toIndex(_s.find(c, from)); }
+    int indexOf(const String& text, unsigned int from = 0) const { return toIndex(_s.find(text._s, from)); }
+    int lastIndexOf(char c) const { return toIndex(_s.rfind(c)); }
+    bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+    bool endsWith(const String& suffix) const;
+    String substring(unsigned int from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const;
+
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    void replace(const String& find, const String& replacement);
+    void remove(unsigned int index, unsigned int count = (unsigned int)-1);
+    long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(_s.c_str(), nullptr); }
+
+private:
+    std::string _s;
+
+    static int toIndex(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+    static std::string format(long value, unsigned char base);
+    static std::string formatUnsigned(unsigned long value, unsigned char base);
+};
+
+#endif // SIM_WSTRING_H
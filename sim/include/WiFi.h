@@ -0,0 +1,71 @@
+// WiFi.h
+// Host stand-in for the ESP32 WiFi API. Link state, scan results and DNS
+// answers are scripted through SimWiFi (Sim.h).
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+typedef enum { WIFI_AUTH_OPEN = 0, WIFI_AUTH_WPA2_PSK = 3 } wifi_auth_mode_t;
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED  (-2)
+
+class Client {
+public:
+    virtual ~Client() {}
+};
+
+class WiFiClient : public Client {};
+
+class WiFiClass {
+public:
+    wl_status_t status();
+    wl_status_t begin(const char* ssid, const char* password = nullptr,
+                      int32_t channel = 0, const uint8_t* bssid = nullptr, bool connect = true);
+    bool config(IPAddress localIp, IPAddress gateway, IPAddress subnet, IPAddress dns = IPAddress());
+    bool disconnect(bool wifiOff = false, bool eraseAp = false);
+    bool reconnect();
+    bool mode(wifi_mode_t mode);
+    bool setAutoReconnect(bool) { return true; }
+    bool setSleep(bool) { return true; }
+    bool softAP(const char* ssid, const char* password = nullptr) { return true; }
+    bool softAPConfig(IPAddress, IPAddress, IPAddress) { return true; }
+    bool softAPdisconnect(bool wifiOff = false) { return true; }
+    uint8_t softAPgetStationNum() { return 0; }
+    IPAddress localIP();
+    IPAddress gatewayIP();
+    IPAddress subnetMask();
+    IPAddress dnsIP();
+    int8_t RSSI();
+    String SSID();
+    uint8_t* BSSID();
+    int32_t channel();
+    uint8_t* macAddress(uint8_t* mac);
+    String macAddress();
+    int hostByName(const char* host, IPAddress& result);
+
+    int16_t scanNetworks(bool async = false);
+    int16_t scanComplete();
+    void scanDelete();
+    String SSID(uint8_t index);
+    int32_t RSSI(uint8_t index);
+    wifi_auth_mode_t encryptionType(uint8_t index);
+    uint8_t* BSSID(uint8_t index);
+    int32_t channel(uint8_t index);
+};
+
+extern WiFiClass WiFi;
+
+#endif // SIM_WIFI_H
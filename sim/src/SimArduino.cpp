@@ -0,0 +1,174 @@
+// SimArduino.cpp
+// String, Print, Serial and the small ESP helpers of the host stand-in core.
+#include <Arduino.h>
+#include <ESPmDNS.h>
+#include <Sim.h>
+#include <ctype.h>
+#include <unistd.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+MDNSResponder MDNS;
+
+namespace {
+    bool serialEcho = false;
+    uint32_t randomState = 0x2545F491u;
+    uint32_t restarts = 0;
+}
+
+// ----- String -----
+
+String::String(double value, unsigned int decimals) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, value);
+    _s = buffer;
+}
+
+std::string String::format(long value, unsigned char base) {
+    if (value < 0 && base == 10) return "-" + formatUnsigned((unsigned long)(-value), base);
+    return formatUnsigned((unsigned long)value, base);
+}
+
+std::string String::formatUnsigned(unsigned long value, unsigned char base) {
+    if (base < 2 || base > 36) base = 10;
+    char buffer[72];
+    char* p = buffer + sizeof(buffer) - 1;
+    *p = '\0';
+    do {
+        unsigned digit = value % base;
+        *--p = (char)(digit < 10 ? '0' + digit : 'A' + digit - 10);
+        value /= base;
+    } while (value);
+    return p;
+}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    if (_s.size() != other._s.size()) return false;
+    for (size_t i = 0; i < _s.size(); i++) {
+        if (tolower((unsigned char)_s[i]) != tolower((unsigned char)other._s[i])) return false;
+    }
+    return true;
+}
+
+bool String::endsWith(const String& suffix) const {
+    return _s.size() >= suffix._s.size() &&
+           _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= _s.size()) return String();
+    return String(_s.substr(from, to - from));
+}
+
+void String::trim() {
+    size_t begin = 0;
+    size_t end = _s.size();
+    while (begin < end && isspace((unsigned char)_s[begin])) begin++;
+    while (end > begin && isspace((unsigned char)_s[end - 1])) end--;
+    _s = _s.substr(begin, end - begin);
+}
+
+void String::toLowerCase() {
+    for (char& c : _s) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+    for (char& c : _s) c = (char)toupper((unsigned char)c);
+}
+
+void String::replace(const String& find, const String& replacement) {
+    if (find._s.empty()) return;
+    size_t pos = 0;
+    while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+        _s.replace(pos, find._s.size(), replacement._s);
+        pos += replacement._s.size();
+    }
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+    if (index >= _s.size()) return;
+    _s.erase(index, count);
+}
+
+// ----- Print -----
+
+size_t Print::write(const uint8_t* data, size_t length) {
+    size_t n = 0;
+    while (length--) n += write(*data++);
+    return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+    char stackBuffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(stackBuffer, sizeof(stackBuffer), format, args);
+    va_end(args);
+    if (length < 0) return 0;
+    if ((size_t)length < sizeof(stackBuffer)) return write((const uint8_t*)stackBuffer, length);
+
+    std::string heapBuffer(length + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&heapBuffer[0], heapBuffer.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)heapBuffer.data(), length);
+}
+
+size_t Print::print(const IPAddress& address) {
+    return print(address.toString());
+}
+
+String IPAddress::toString() const {
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+    return String(buffer);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (serialEcho) fputc(c, stdout);
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* data, size_t length) {
+    if (serialEcho) fwrite(data, 1, length, stdout);
+    return length;
+}
+
+// ----- ESP helpers -----
+
+void EspClass::restart() {
+    // Nothing to reboot into on the host; scenarios check restartCount()
+    restarts++;
+    if (serialEcho) fputs("[sim] ESP.restart() requested\n", stdout);
+}
+
+// Heap figures of a typical ESP32-WROOM after WiFi + AsyncTCP are up
+uint32_t EspClass::getFreeHeap() { return 182000; }
+uint32_t EspClass::getMinFreeHeap() { return 164000; }
+uint32_t EspClass::getMaxAllocHeap() { return 110580; }
+uint32_t EspClass::getHeapSize() { return 327680; }
+
+uint32_t esp_random() {
+    // xorshift32: deterministic so runs are reproducible
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+#if !SIM_HAVE_STRLCPY
+size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t length = strlen(src);
+    if (size) {
+        size_t n = length < size - 1 ? length : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return length;
+}
+#endif
+
+void SimSystem::setSerialEcho(bool echo) { serialEcho = echo; }
+void SimSystem::seedRandom(uint32_t seed) { randomState = seed ? seed : 1; }
+uint32_t SimSystem::restartCount() { return restarts; }
@@ -0,0 +1,227 @@
+// SimBroker.cpp
+// An in-process MQTT broker behind the PubSubClient stand-in. Routing,
+// retained messages and last wills follow MQTT 3.1.1; QoS is always 0.
+#include <PubSubClient.h>
+#include <Sim.h>
+#include "SimInternal.h"
+#include <map>
+
+namespace {
+    bool brokerAvailable = true;
+    uint32_t connects = 0;
+    // Clients are constructed as globals, possibly before this file's
+    // statics; a function-local registry sidesteps the init order
+    std::vector<PubSubClient*>& registry() {
+        static std::vector<PubSubClient*> clients;
+        return clients;
+    }
+    std::map<std::string, std::string> retainedMessages;
+    std::vector<SimBroker::Message> messageLog;
+
+    bool topicMatches(const std::string& filter, const std::string& topic) {
+        size_t f = 0;
+        size_t t = 0;
+        while (f < filter.size()) {
+            if (filter[f] == '#') return true;
+            if (filter[f] == '+') {
+                while (t < topic.size() && topic[t] != '/') t++;
+                f++;
+                continue;
+            }
+            if (t >= topic.size() || filter[f] != topic[t]) return false;
+            f++;
+            t++;
+        }
+        return t == topic.size();
+    }
+}
+
+// Broker side of the session; a friend of PubSubClient so the client API
+// stays exactly the library's. Device and scenario publishes share route().
+class SimBrokerCore {
+public:
+    static void route(const std::string& topic, const std::string& payload, bool retained, bool fromDevice) {
+        messageLog.push_back({ topic, payload, retained, SimClock::nowUs(), fromDevice });
+        if (retained) {
+            if (payload.empty()) {
+                retainedMessages.erase(topic);
+            } else {
+                retainedMessages[topic] = payload;
+            }
+        }
+        for (PubSubClient* client : registry()) {
+            if (client->_state == MQTT_CONNECTED && client->isSubscribed(topic)) {
+                client->_inbox.push_back({ topic, payload });
+            }
+        }
+    }
+
+    static void drop(PubSubClient* client, int reason) {
+        if (client->_state != MQTT_CONNECTED) return;
+        client->_state = reason;
+        client->_inbox.clear();
+        if (!client->_willTopic.empty()) {
+            SimBrokerCore::route(client->_willTopic, client->_willMessage, client->_willRetain, true);
+        }
+    }
+
+    static void deliverRetained(PubSubClient* client, const std::string& filter) {
+        for (const auto& entry : retainedMessages) {
+            if (topicMatches(filter, entry.first)) client->_inbox.push_back({ entry.first, entry.second });
+        }
+    }
+};
+
+PubSubClient::PubSubClient(Client&) {
+    registry().push_back(this);
+}
+
+PubSubClient::~PubSubClient() {
+    std::vector<PubSubClient*>& clients = registry();
+    clients.erase(std::remove(clients.begin(), clients.end(), this), clients.end());
+}
+
+PubSubClient& PubSubClient::setServer(IPAddress, uint16_t) { return *this; }
+PubSubClient& PubSubClient::setServer(const char*, uint16_t) { return *this; }
+
+PubSubClient& PubSubClient::setCallback(MQTT_CALLBACK_SIGNATURE) {
+    _callback = callback;
+    return *this;
+}
+
+bool PubSubClient::connect(const char* id) {
+    return connect(id, nullptr, nullptr, nullptr, 0, false, nullptr, true);
+}
+
+bool PubSubClient::connect(const char* id, const char* user, const char* pass) {
+    return connect(id, user, pass, nullptr, 0, false, nullptr, true);
+}
+
+bool PubSubClient::connect(const char* id, const char* willTopic, uint8_t willQos, bool willRetain,
+                           const char* willMessage) {
+    return connect(id, nullptr, nullptr, willTopic, willQos, willRetain, willMessage, true);
+}
+
+bool PubSubClient::connect(const char* id, const char* user, const char* pass, const char* willTopic,
+                           uint8_t willQos, bool willRetain, const char* willMessage) {
+    return connect(id, user, pass, willTopic, willQos, willRetain, willMessage, true);
+}
+
+bool PubSubClient::connect(const char* id, const char*, const char*, const char* willTopic, uint8_t,
+                           bool willRetain, const char* willMessage, bool) {
+    if (connected()) return true;
+    if (!brokerAvailable || WiFi.status() != WL_CONNECTED) {
+        _state = MQTT_CONNECT_FAILED;
+        return false;
+    }
+    // A second session with the same client id kicks the first one off
+    for (PubSubClient* other : registry()) {
+        if (other != this && other->_id == id) SimBrokerCore::drop(other, MQTT_CONNECTION_LOST);
+    }
+    _id = id ? id : "";
+    _willTopic = willTopic ? willTopic : "";
+    _willMessage = willMessage ? willMessage : "";
+    _willRetain = willRetain;
+    _subscriptions.clear();
+    _inbox.clear();
+    _session++;
+    _state = MQTT_CONNECTED;
+    connects++;
+    return true;
+}
+
+void PubSubClient::disconnect() {
+    // A clean DISCONNECT discards the will
+    _state = MQTT_DISCONNECTED;
+    _inbox.clear();
+}
+
+bool PubSubClient::connected() {
+    if (_state == MQTT_CONNECTED && (!brokerAvailable || WiFi.status() != WL_CONNECTED)) {
+        SimBrokerCore::drop(this, MQTT_CONNECTION_LOST);
+    }
+    return _state == MQTT_CONNECTED;
+}
+
+bool PubSubClient::publish(const char* topic, const char* payload) {
+    return publish(topic, (const uint8_t*)payload, payload ? strlen(payload) : 0, false);
+}
+
+bool PubSubClient::publish(const char* topic, const char* payload, bool retained) {
+    return publish(topic, (const uint8_t*)payload, payload ? strlen(payload) : 0, retained);
+}
+
+bool PubSubClient::publish(const char* topic, const uint8_t* payload, unsigned int length) {
+    return publish(topic, payload, length, false);
+}
+
+bool PubSubClient::publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained) {
+    if (!connected()) return false;
+    // Same limit as the real client: fixed header + topic + payload must fit the buffer
+    if (5 + 2 + strlen(topic) + length > _bufferSize) return false;
+    SimBrokerCore::route(topic, std::string((const char*)payload, length), retained, true);
+    return true;
+}
+
+bool PubSubClient::subscribe(const char* topic, uint8_t) {
+    if (!connected()) return false;
+    _subscriptions.push_back(topic);
+    SimBrokerCore::deliverRetained(this, topic);
+    return true;
+}
+
+bool PubSubClient::unsubscribe(const char* topic) {
+    if (!connected()) return false;
+    _subscriptions.erase(std::remove(_subscriptions.begin(), _subscriptions.end(), topic), _subscriptions.end());
+    return true;
+}
+
+bool PubSubClient::isSubscribed(const std::string& topic) const {
+    for (const std::string& filter : _subscriptions) {
+        if (topicMatches(filter, topic)) return true;
+    }
+    return false;
+}
+
+bool PubSubClient::loop() {
+    if (!connected()) return false;
+    // Like the real client, at most one inbound packet is handled per call
+    if (_inbox.empty()) return true;
+    Message message = _inbox.front();
+    _inbox.pop_front();
+    if (5 + 2 + message.topic.size() + message.payload.size() > _bufferSize) return true;
+    if (_callback) {
+        std::vector<char> topic(message.topic.begin(), message.topic.end());
+        topic.push_back('\0');
+        std::vector<uint8_t> payload(message.payload.begin(), message.payload.end());
+        payload.push_back(0);
+        _callback(topic.data(), payload.data(), (unsigned int)message.payload.size());
+    }
+    return true;
+}
+
+void SimBroker::setAvailable(bool available) {
+    brokerAvailable = available;
+    if (!available) {
+        for (PubSubClient* client : registry()) SimBrokerCore::drop(client, MQTT_CONNECTION_LOST);
+    }
+}
+
+void simBrokerLinkLost() {
+    for (PubSubClient* client : registry()) SimBrokerCore::drop(client, MQTT_CONNECTION_LOST);
+}
+
+void SimBroker::inject(const char* topic, const char* payload, bool retained) {
+    SimBrokerCore::route(topic, payload, retained, false);
+}
+
+const std::vector<SimBroker::Message>& SimBroker::log() { return messageLog; }
+
+bool SimBroker::retained(const char* topic, std::string* payload) {
+    auto it = retainedMessages.find(topic);
+    if (it == retainedMessages.end()) return false;
+    if (payload) *payload = it->second;
+    return true;
+}
+
+uint32_t SimBroker::connectCount() { return connects; }
@@ -0,0 +1,360 @@
+// SimClock.cpp
+// Virtual time for the host simulation: the clock, esp_timer, the FreeRTOS
+// task shim, and the libc wall-clock calls the firmware makes.
+//
+// Time only moves when the main (Arduino loop) thread calls delay(). Each
+// advance walks the pending events - timer expiries and task wake-ups - in
+// time order and waits for every woken task to block again before moving
+// on, so a run is deterministic no matter how the host schedules threads.
+#include <Arduino.h>
+#include <Sim.h>
+#include <WiFi.h>
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct sim_esp_timer {
+    std::function<void()> callback;
+    uint64_t dueUs;
+    uint64_t periodUs;
+    bool armed;
+};
+
+namespace {
+    struct SimTask {
+        TaskFunction_t function;
+        void* parameters;
+        const char* name;
+        uint32_t stackDepth;
+        BaseType_t coreId;
+        std::condition_variable wake;
+        uint32_t notifyValue = 0;
+        bool blocked = false;
+        bool waitingForNotify = false;
+        uint64_t wakeAtUs = UINT64_MAX;
+    };
+
+    const uint64_t NEVER = UINT64_MAX;
+
+    std::mutex clockMutex;
+    std::condition_variable idle;
+    std::atomic<uint64_t> nowUs{0};
+    std::vector<SimTask*> tasks;
+    std::vector<sim_esp_timer*> timers;
+    int runningTasks = 0;
+    thread_local SimTask* currentTask = nullptr;
+
+    // Wall clock offset from uptime; unset until the first NTP sync
+    std::atomic<bool> wallValid{false};
+    std::atomic<int64_t> wallOffsetUs{0};
+
+    // What an NTP server would answer, and whether it can be reached
+    int64_t trueOffsetUs = 1767225600LL * 1000000LL;  // 2026-01-01 00:00:00 UTC at boot
+    // Uptime runs driftPpm fast against true time from driftAnchorUs on
+    int32_t driftPpm = 0;
+    uint64_t driftAnchorUs = 0;
+    bool ntpReachable = true;
+    uint32_t ntpDelayMs = 1200;
+    uint32_t ntpSyncs = 0;
+    sntp_sync_time_cb_t syncCallback = nullptr;
+    sim_esp_timer* syncTimer = nullptr;
+
+    int64_t trueNowUs() {
+        uint64_t now = ::nowUs.load();
+        return (int64_t)now + trueOffsetUs - (int64_t)(now - driftAnchorUs) * driftPpm / 1000000;
+    }
+
+    // Caller holds clockMutex
+    void wakeTask(SimTask* task) {
+        task->blocked = false;
+        task->wakeAtUs = NEVER;
+        runningTasks++;
+        task->wake.notify_one();
+    }
+
+    void waitIdle(std::unique_lock<std::mutex>& lock) {
+        idle.wait(lock, [] { return runningTasks == 0; });
+    }
+
+    // Caller holds clockMutex; parks the calling task until woken
+    void block(std::unique_lock<std::mutex>& lock, SimTask* task, bool forNotify, uint64_t wakeAtUs) {
+        task->blocked = true;
+        task->waitingForNotify = forNotify;
+        task->wakeAtUs = wakeAtUs;
+        if (--runningTasks == 0) idle.notify_all();
+        task->wake.wait(lock, [task] { return !task->blocked; });
+    }
+
+    void taskEntry(SimTask* task) {
+        currentTask = task;
+        task->function(task->parameters);
+        // FreeRTOS tasks must not return; treat it as the task deleting itself
+        std::unique_lock<std::mutex> lock(clockMutex);
+        if (--runningTasks == 0) idle.notify_all();
+    }
+}
+
+// ----- clock -----
+
+uint64_t SimClock::nowUs() { return ::nowUs.load(); }
+
+void SimClock::advance(uint64_t us) {
+    std::unique_lock<std::mutex> lock(clockMutex);
+    waitIdle(lock);
+    uint64_t target = ::nowUs.load() + us;
+
+    for (;;) {
+        uint64_t nextUs = NEVER;
+        sim_esp_timer* nextTimer = nullptr;
+        SimTask* nextTask = nullptr;
+        for (sim_esp_timer* timer : timers) {
+            if (timer->armed && timer->dueUs < nextUs) {
+                nextUs = timer->dueUs;
+                nextTimer = timer;
+            }
+        }
+        for (SimTask* task : tasks) {
+            if (task->blocked && task->wakeAtUs < nextUs) {
+                nextUs = task->wakeAtUs;
+                nextTask = task;
+                nextTimer = nullptr;
+            }
+        }
+        if (nextUs > target) break;
+
+        if (nextUs > ::nowUs.load()) ::nowUs.store(nextUs);
+        if (nextTask) {
+            wakeTask(nextTask);
+            waitIdle(lock);
+            continue;
+        }
+
+        if (nextTimer->periodUs) {
+            nextTimer->dueUs += nextTimer->periodUs;
+        } else {
+            nextTimer->armed = false;
+        }
+        std::function<void()> callback = nextTimer->callback;
+        lock.unlock();
+        callback();
+        lock.lock();
+        waitIdle(lock);
+    }
+
+    ::nowUs.store(target);
+}
+
+time_t SimClock::wallTime() { return time(nullptr); }
+
+extern "C" uint32_t micros(void) { return (uint32_t)::nowUs.load(); }
+extern "C" uint32_t millis(void) { return (uint32_t)(::nowUs.load() / 1000); }
+extern "C" void yield(void) {}
+
+extern "C" void delay(int ms) {
+    if (ms < 0) ms = 0;
+    if (currentTask) {
+        vTaskDelay(pdMS_TO_TICKS(ms));
+        return;
+    }
+    SimClock::advance((uint64_t)ms * 1000);
+}
+
+// ----- esp_timer -----
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* outHandle) {
+    sim_esp_timer* timer = new sim_esp_timer();
+    esp_timer_cb_t callback = args->callback;
+    void* arg = args->arg;
+    timer->callback = [callback, arg] { callback(arg); };
+    timer->dueUs = 0;
+    timer->periodUs = 0;
+    timer->armed = false;
+    std::lock_guard<std::mutex> lock(clockMutex);
+    timers.push_back(timer);
+    *outHandle = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeoutUs) {
+    std::lock_guard<std::mutex> lock(clockMutex);
+    if (timer->armed) return ESP_ERR_INVALID_STATE;
+    timer->dueUs = ::nowUs.load() + timeoutUs;
+    timer->periodUs = 0;
+    timer->armed = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t periodUs) {
+    std::lock_guard<std::mutex> lock(clockMutex);
+    if (timer->armed) return ESP_ERR_INVALID_STATE;
+    timer->dueUs = ::nowUs.load() + periodUs;
+    timer->periodUs = periodUs;
+    timer->armed = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    std::lock_guard<std::mutex> lock(clockMutex);
+    if (!timer->armed) return ESP_ERR_INVALID_STATE;
+    timer->armed = false;
+    return ESP_OK;
+}
+
+int64_t esp_timer_get_time() { return (int64_t)::nowUs.load(); }
+
+// ----- FreeRTOS -----
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                                   void* parameters, UBaseType_t, TaskHandle_t* createdTask, BaseType_t coreId) {
+    SimTask* task = new SimTask();
+    task->function = function;
+    task->parameters = parameters;
+    task->name = name;
+    task->stackDepth = stackDepth;
+    task->coreId = coreId;
+    {
+        std::lock_guard<std::mutex> lock(clockMutex);
+        tasks.push_back(task);
+        runningTasks++;
+    }
+    if (createdTask) *createdTask = task;
+    // Tasks loop forever; the process exits without joining them
+    std::thread(taskEntry, task).detach();
+    return pdPASS;
+}
+
+void xTaskNotifyGive(TaskHandle_t handle) {
+    SimTask* task = static_cast<SimTask*>(handle);
+    std::lock_guard<std::mutex> lock(clockMutex);
+    task->notifyValue++;
+    if (task->blocked && task->waitingForNotify) wakeTask(task);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+    SimTask* task = currentTask;
+    std::unique_lock<std::mutex> lock(clockMutex);
+    if (task->notifyValue == 0 && ticksToWait != 0) {
+        uint64_t wakeAt = ticksToWait == portMAX_DELAY ? NEVER : ::nowUs.load() + (uint64_t)ticksToWait * 1000;
+        block(lock, task, true, wakeAt);
+    }
+    uint32_t value = task->notifyValue;
+    if (value) task->notifyValue = clearOnExit ? 0 : value - 1;
+    return value;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    SimTask* task = currentTask;
+    if (!task || ticks == 0) return;
+    std::unique_lock<std::mutex> lock(clockMutex);
+    block(lock, task, false, ::nowUs.load() + (uint64_t)ticks * 1000);
+}
+
+TickType_t xTaskGetTickCount() { return (TickType_t)(::nowUs.load() / 1000); }
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t handle) {
+    // No stack to measure on the host; report the full allocation as free
+    SimTask* task = static_cast<SimTask*>(handle ? handle : currentTask);
+    return task ? task->stackDepth : 0;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return currentTask; }
+
+char* pcTaskGetName(TaskHandle_t handle) {
+    SimTask* task = static_cast<SimTask*>(handle ? handle : currentTask);
+    return const_cast<char*>(task ? task->name : "loopTask");
+}
+
+// The Arduino loop runs on core 1
+BaseType_t xPortGetCoreID() { return currentTask ? currentTask->coreId : 1; }
+
+// ----- wall clock -----
+// The firmware reads the wall clock through libc; these definitions take
+// precedence over glibc's so it sees virtual time.
+
+extern "C" time_t time(time_t* out) noexcept {
+    uint64_t now = ::nowUs.load();
+    time_t seconds = (time_t)((wallValid ? (int64_t)now + wallOffsetUs.load() : (int64_t)now) / 1000000);
+    if (out) *out = seconds;
+    return seconds;
+}
+
+extern "C" int gettimeofday(struct timeval* tv, void*) noexcept {
+    uint64_t now = ::nowUs.load();
+    int64_t us = wallValid ? (int64_t)now + wallOffsetUs.load() : (int64_t)now;
+    tv->tv_sec = (time_t)(us / 1000000);
+    tv->tv_usec = (suseconds_t)(us % 1000000);
+    return 0;
+}
+
+extern "C" int settimeofday(const struct timeval* tv, const struct timezone*) noexcept {
+    if (!tv) return 0;
+    int64_t us = (int64_t)tv->tv_sec * 1000000 + tv->tv_usec;
+    wallOffsetUs.store(us - (int64_t)::nowUs.load());
+    wallValid = true;
+    return 0;
+}
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) {
+    syncCallback = callback;
+}
+
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char* server1, const char* server2,
+                const char* server3) {
+    // POSIX TZ offsets are west-positive, the opposite of configTime's
+    long offset = gmtOffsetSec + daylightOffsetSec;
+    char tz[24];
+    snprintf(tz, sizeof(tz), "UTC%c%ld:%02ld", offset > 0 ? '-' : '+',
+             labs(offset) / 3600, (labs(offset) % 3600) / 60);
+    configTzTime(tz, server1, server2, server3);
+}
+
+void configTzTime(const char* tz, const char*, const char*, const char*) {
+    setenv("TZ", tz, 1);
+    tzset();
+
+    if (!syncTimer) {
+        esp_timer_create_args_t args = {};
+        args.callback = [](void*) {
+            // lwIP SNTP polls again an hour later, and retries sooner on failure
+            bool reachable = ntpReachable && WiFi.status() == WL_CONNECTED;
+            esp_timer_start_once(syncTimer, reachable ? 3600000000ULL : 15000000ULL);
+            if (!reachable) return;
+            struct timeval tv;
+            int64_t us = trueNowUs();
+            tv.tv_sec = (time_t)(us / 1000000);
+            tv.tv_usec = (suseconds_t)(us % 1000000);
+            settimeofday(&tv, nullptr);
+            ntpSyncs++;
+            if (syncCallback) syncCallback(&tv);
+        };
+        args.name = "sntp";
+        esp_timer_create(&args, &syncTimer);
+    }
+    esp_timer_stop(syncTimer);
+    esp_timer_start_once(syncTimer, (uint64_t)ntpDelayMs * 1000);
+}
+
+void SimNtp::setTime(time_t epoch) {
+    trueOffsetUs = (int64_t)epoch * 1000000 - (int64_t)::nowUs.load();
+    driftAnchorUs = ::nowUs.load();
+}
+
+void SimNtp::setDriftPpm(int32_t ppm) {
+    trueOffsetUs = trueNowUs() - (int64_t)::nowUs.load();
+    driftAnchorUs = ::nowUs.load();
+    driftPpm = ppm;
+}
+
+int64_t SimNtp::clockErrorUs() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec - trueNowUs();
+}
+
+void SimNtp::setReachable(bool reachable) { ntpReachable = reachable; }
+void SimNtp::setSyncDelayMs(uint32_t delayMs) { ntpDelayMs = delayMs; }
+uint32_t SimNtp::syncCount() { return ntpSyncs; }
@@ -0,0 +1,9 @@
+// SimInternal.h
+// Hooks between stand-ins that firmware and scenarios never call.
+#ifndef SIM_INTERNAL_H
+#define SIM_INTERNAL_H
+
+// The station link went down: every TCP session on it is gone
+void simBrokerLinkLost();
+
+#endif // SIM_INTERNAL_H
@@ -0,0 +1,526 @@
+// SimMain.cpp
+// Runs the unmodified firmware setup()/loop() on the host against the
+// stand-ins in sim/include, drives a scripted day of traffic (or, with
+// --soak, a multi-day network outage on a drifting crystal; with
+// --router-late, a router that comes up after the device), and prints the
+// resulting LED timeline and module statistics.
+#include <Arduino.h>
+#include <Preferences.h>
+#include <Sim.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <fl/engine_events.h>
+#include "config.h"
+#include "globals.h"
+#include "SettingsStore/SettingsStore.h"
+#include "Telemetry/Telemetry.h"
+#include "Timekeeper/Timekeeper.h"
+#include "TaskScheduler/TaskScheduler.h"
+
+void setup();
+void loop();
+
+namespace {
+    struct Event {
+        uint32_t atSec;
+        const char* label;
+        std::function<void()> action;
+    };
+
+    // 2026-01-05 04:00:00 UTC, 07:00 at the firmware's UTC+3
+    const time_t SIM_START_EPOCH = 1767585600;
+
+    // What a dashboard or home automation publishes to
+    #define MQTT_SET_TOPIC MQTT_TOPIC "/set"
+
+    const uint64_t LED_SETTLE_US = 200000;
+    // Runs this short and closer together than LED_RAMP_GAP_US are one ramp
+    const uint32_t LED_RAMP_MAX_RUN = 3;
+    const uint64_t LED_RAMP_GAP_US = 120000000;
+    // No frame for this long: the strip holds its last one
+    const uint64_t LED_IDLE_US = 50000;
+
+    bool timeline = true;
+
+    // Soak: the crystal runs SOAK_DRIFT_PPM fast, then warms up by another
+    // 10 ppm halfway through a 60 h outage of the router (WiFi and NTP).
+    // Without correction the clock would be ~10 s off by the end.
+    const int32_t SOAK_DRIFT_PPM = 40;
+    const uint32_t SOAK_OUTAGE_START_S = 29 * 3600;  // 12:00 on day 2
+    const uint32_t SOAK_OUTAGE_END_S = 89 * 3600;
+    const int64_t SOAK_MAX_ERROR_US = 2000000;
+    // Local midnights, for transitions per day
+    const uint32_t SOAK_DAY_STARTS_S[] = { 17 * 3600, 41 * 3600, 65 * 3600, 89 * 3600 };
+
+    // --router-late: the router only comes up this long after power-on
+    uint32_t routerLateS = 0;
+
+    bool offline = false;
+    int64_t offlineMaxErrorUs = 0;
+    std::vector<uint32_t> dayTransitions;
+
+    // Stamps an instant up to now, so deferred reports keep their time
+    void printStamp(uint64_t us) {
+        time_t wall = SimClock::wallTime() - (time_t)((SimClock::nowUs() - us) / 1000000);
+        struct tm local;
+        localtime_r(&wall, &local);
+        printf("[+%7.1fs %02d:%02d:%02d] ", us / 1e6, local.tm_hour, local.tm_min, local.tm_sec);
+    }
+
+    // Pixel as seen over one dither cycle: the sum of LED_DITHER_FRAMES
+    // frames per channel, 12 bits each
+    typedef uint64_t LedState;
+    const LedState LED_STATE_NONE = ~(LedState)0;
+
+    inline uint32_t stateChannel(LedState state, int channel) {
+        return (uint32_t)(state >> (24 - channel * 12)) & 0xFFF;
+    }
+
+    void printLed(uint64_t atUs, LedState state, uint32_t steps, uint64_t spanUs, bool inSeconds) {
+        if (!timeline) return;
+        printStamp(atUs);
+        uint32_t sums[3];
+        bool dithered = false;
+        for (int c = 0; c < 3; c++) {
+            sums[c] = stateChannel(state, c);
+            dithered |= sums[c] % LED_DITHER_FRAMES != 0;
+        }
+        auto mean8 = [](uint32_t sum) { return (unsigned)((sum + LED_DITHER_FRAMES / 2) / LED_DITHER_FRAMES); };
+        printf("led #%02X%02X%02X", mean8(sums[0]), mean8(sums[1]), mean8(sums[2]));
+        if (dithered) {
+            printf(" dithered to %.2f/%.2f/%.2f", sums[0] / (double)LED_DITHER_FRAMES, sums[1] / (double)LED_DITHER_FRAMES,
+                   sums[2] / (double)LED_DITHER_FRAMES);
+        }
+        if (steps > 1) {
+            printf(" (%u steps over %llu %s)", steps, (unsigned long long)(spanUs / (inSeconds ? 1000000 : 1000)),
+                   inSeconds ? "s" : "ms");
+        }
+        printf("\n");
+    }
+
+    // Ramp steps gathered by watchLed() and not yet reported
+    struct PendingRamp {
+        uint32_t steps;
+        LedState state;
+        uint64_t firstUs;
+        uint64_t lastUs;
+    } pendingRamp = {};
+
+    void flushRamp() {
+        if (pendingRamp.steps == 0) return;
+        printLed(pendingRamp.lastUs, pendingRamp.state, pendingRamp.steps, pendingRamp.lastUs - pendingRamp.firstUs, true);
+        pendingRamp.steps = 0;
+    }
+
+    void note(const char* label) {
+        if (!timeline) return;
+        flushRamp();
+        printStamp(SimClock::nowUs());
+        printf("%s\n", label);
+    }
+
+    // Sums the first pixel of every frame shown into whole dither cycles.
+    // It runs on the render task, which never overlaps the main thread in
+    // the sim (SimClock waits for tasks to block).
+    struct FrameProbe : fl::EngineEvents::Listener {
+        uint32_t sums[3] = {};
+        uint32_t frames = 0;
+        uint64_t lastFrameUs = 0;
+        CRGB last;
+        LedState cycle = LED_STATE_NONE;
+
+        void onEndShowLeds() override {
+            last = FastLED[0].leds()[0];
+            for (int c = 0; c < 3; c++) sums[c] += last.raw[c];
+            lastFrameUs = SimClock::nowUs();
+            if (++frames < LED_DITHER_FRAMES) return;
+            cycle = 0;
+            for (int c = 0; c < 3; c++) {
+                cycle = (cycle << 12) | sums[c];
+                sums[c] = 0;
+            }
+            frames = 0;
+        }
+
+        // A strip that has stopped refreshing holds its last frame
+        LedState observe() {
+            if (SimClock::nowUs() - lastFrameUs >= LED_IDLE_US) {
+                cycle = 0;
+                for (int c = 0; c < 3; c++) {
+                    cycle = (cycle << 12) | ((uint32_t)last.raw[c] * LED_DITHER_FRAMES);
+                    sums[c] = 0;
+                }
+                frames = 0;
+            }
+            return cycle;
+        }
+    } frameProbe;
+
+    // Only the rendered pixel is trusted here; controller getters could lie.
+    // It is the wire value, with gamma, brightness and white balance in,
+    // averaged over a dither cycle. A run of changes (a fade) is reported
+    // once the pixel has held still for LED_SETTLE_US. Short runs seconds
+    // apart (ramp steps; channels may step a few ms apart, a cycle may
+    // straddle a step) are gathered and reported as one line.
+    void watchLed() {
+        static LedState shownState = LED_STATE_NONE;
+        static LedState lastState = LED_STATE_NONE;
+        static uint64_t firstChangeUs = 0;
+        static uint64_t lastChangeUs = 0;
+        static uint32_t steps = 0;
+        if (FastLED.count() == 0) return;
+
+        LedState state = frameProbe.observe();
+        uint64_t now = SimClock::nowUs();
+        if (state != lastState) {
+            if (steps == 0) firstChangeUs = now;
+            lastChangeUs = now;
+            lastState = state;
+            steps++;
+            return;
+        }
+        if (steps == 0 && now - pendingRamp.lastUs >= LED_RAMP_GAP_US) flushRamp();
+        if (steps == 0 || now - lastChangeUs < LED_SETTLE_US) return;
+        if (state == shownState) {
+            steps = 0;
+            return;
+        }
+
+        if (steps <= LED_RAMP_MAX_RUN) {
+            if (pendingRamp.steps == 0) pendingRamp.firstUs = firstChangeUs;
+            pendingRamp.steps++;
+            pendingRamp.lastUs = lastChangeUs;
+            pendingRamp.state = state;
+        } else {
+            flushRamp();
+            printLed(now, state, steps, lastChangeUs - firstChangeUs, false);
+        }
+        shownState = state;
+        steps = 0;
+    }
+
+    void provision() {
+        Preferences pref;
+        pref.begin("wifi", false);
+        pref.putString("ssid", "HomeNet");
+        pref.putString("password", "correct-horse");
+        // Joined before: boot takes the fast path to 0C:80:63:11:22:33
+        pref.putUInt("bssidHi", 0x0C80);
+        pref.putUInt("bssidLo", 0x63112233);
+        pref.putUChar("channel", 6);
+        pref.end();
+        // 45 min sunrise: the 07:30 wake below puts the start mid-ramp
+        pref.begin("schedule", false);
+        pref.putUChar("sunriseMin", 45);
+        pref.putUChar("sunsetMin", 15);
+        pref.end();
+        // Two 12-pixel rings instead of the single-LED default
+        pref.begin("led", false);
+        pref.putUInt("count", 12);
+        pref.putUChar("outputs", 2);
+        pref.putUChar("pin1", 22);
+        pref.putUInt("color", 0xFF0000);  // red when it was switched off
+        pref.end();
+    }
+
+    std::vector<Event> soakScenario() {
+        std::vector<Event> events;
+        events.push_back({ 5, "http /setSchedule 07:30-08:00,19:00-19:05", [] {
+            SimHttp::request(HTTP_GET, "/setSchedule?greenWindows=07:30-08:00,19:00-19:05");
+        } });
+        for (uint32_t at : SOAK_DAY_STARTS_S) {
+            events.push_back({ at, "midnight", [] { dayTransitions.push_back(getSchedulerStats().transitions); } });
+        }
+        events.push_back({ SOAK_OUTAGE_START_S, "router down (WiFi and NTP)", [] {
+            SimWiFi::setApAvailable(false);
+            SimNtp::setReachable(false);
+            offline = true;
+        } });
+        events.push_back({ (SOAK_OUTAGE_START_S + SOAK_OUTAGE_END_S) / 2, "crystal warms up", [] {
+            SimNtp::setDriftPpm(SOAK_DRIFT_PPM + 10);
+        } });
+        events.push_back({ SOAK_OUTAGE_END_S, "router back", [] {
+            offline = false;
+            SimWiFi::setApAvailable(true);
+            SimNtp::setReachable(true);
+        } });
+        std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.atSec < b.atSec; });
+        return events;
+    }
+
+    std::vector<Event> dayScenario() {
+        std::vector<Event> events;
+        events.push_back({ 5, "http /setSchedule 07:30-08:00,19:00-19:05", [] {
+            SimHttp::request(HTTP_GET, "/setSchedule?greenWindows=07:30-08:00,19:00-19:05");
+        } });
+        events.push_back({ 6, "dashboard opens /events", [] { SimHttp::connectEvents("/events"); } });
+        events.push_back({ 60, "mqtt <- blue", [] { SimBroker::inject(MQTT_SET_TOPIC, "blue"); } });
+        events.push_back({ 120, "http slider drag 20 -> 100 (40 requests)", [] {
+            for (int value = 22; value <= 100; value += 2) {
+                char url[40];
+                snprintf(url, sizeof(url), "/setBrightness?value=%d", value);
+                SimHttp::request(HTTP_GET, url);
+                delay(25);
+            }
+        } });
+        events.push_back({ 600, "broker outage begins", [] { SimBroker::setAvailable(false); } });
+        events.push_back({ 900, "broker back", [] { SimBroker::setAvailable(true); } });
+        events.push_back({ 3720, "mqtt <- mode:manual", [] { SimBroker::inject(MQTT_SET_TOPIC, "mode:manual"); } });
+        events.push_back({ 3780, "mqtt <- blue", [] { SimBroker::inject(MQTT_SET_TOPIC, "blue"); } });
+        events.push_back({ 4200, "mqtt <- mode:auto (legacy topic)", [] { SimBroker::inject(MQTT_TOPIC, "mode:auto"); } });
+        events.push_back({ 2 * 3600, "mqtt <- green, blue 300 ms into the fade", [] {
+            SimBroker::inject(MQTT_SET_TOPIC, "green");
+            for (int i = 0; i < 30; i++) loop();
+            SimBroker::inject(MQTT_SET_TOPIC, "blue");
+        } });
+        events.push_back({ 2 * 3600 + 600, "mqtt <- kelvin:2700", [] { SimBroker::inject(MQTT_SET_TOPIC, "kelvin:2700"); } });
+        events.push_back({ 2 * 3600 + 660, "http /setColor hsv(200,80,100)", [] {
+            SimHttp::request(HTTP_GET, "/setColor?color=hsv(200,80,100)");
+        } });
+        events.push_back({ 2 * 3600 + 720, "http /setColor purplish (rejected)", [] {
+            SimHttp::Response response = SimHttp::request(HTTP_GET, "/setColor?color=purplish");
+            if (timeline) printf("    %d %s\n", response.code, response.body.c_str());
+        } });
+        events.push_back({ 2 * 3600 + 780, "http /setBrightness 3 (night light)", [] {
+            SimHttp::request(HTTP_GET, "/setBrightness?value=3");
+        } });
+        events.push_back({ 2 * 3600 + 840, "http /setBrightness 100", [] {
+            SimHttp::request(HTTP_GET, "/setBrightness?value=100");
+        } });
+        events.push_back({ 2 * 3600 + 900, "http POST /api/batch #FF8800;brightness:40", [] {
+            SimHttp::Response response = SimHttp::request(HTTP_POST, "/api/batch", { { "Content-Type", "text/plain" } },
+                                                          "#FF8800;brightness:40");
+            if (timeline) printf("    %d %s\n", response.code, response.body.c_str());
+        } });
+        events.push_back({ 2 * 3600 + 960, "http POST /api/batch with brightness:400 (rejected)", [] {
+            SimHttp::Response response = SimHttp::request(HTTP_POST, "/api/batch", { { "Content-Type", "text/plain" } },
+                                                          "blue\nbrightness:400");
+            if (timeline) printf("    %d %s\n", response.code, response.body.c_str());
+        } });
+        events.push_back({ 2 * 3600 + 1020, "mqtt <- batch:#00FF00;brightness:100", [] {
+            SimBroker::inject(MQTT_SET_TOPIC, "batch:#00FF00;brightness:100");
+        } });
+        // What curl -d sends, and text the server mistakes for a form
+        events.push_back({ 2 * 3600 + 1080, "http POST /api/batch form ops=warmwhite;brightness:60", [] {
+            SimHttp::Response response = SimHttp::request(HTTP_POST, "/api/batch",
+                { { "Content-Type", "application/x-www-form-urlencoded" } }, "ops=warmwhite;brightness:60");
+            if (timeline) printf("    %d %s\n", response.code, response.body.c_str());
+        } });
+        events.push_back({ 2 * 3600 + 1140, "http POST /api/batch brightness=100;blue", [] {
+            SimHttp::Response response = SimHttp::request(HTTP_POST, "/api/batch", { { "Content-Type", "text/plain" } },
+                                                          "brightness=100;blue");
+            if (timeline) printf("    %d %s\n", response.code, response.body.c_str());
+        } });
+        events.push_back({ 5 * 3600, "wifi AP lost", [] { SimWiFi::setApAvailable(false); } });
+        events.push_back({ 5 * 3600 + 120, "wifi AP back", [] { SimWiFi::setApAvailable(true); } });
+        events.push_back({ 6 * 3600, "http /api/state", [] {
+            SimHttp::Response response = SimHttp::request(HTTP_GET, "/api/state");
+            if (timeline) printf("    %d %s\n", response.code, response.body.c_str());
+        } });
+        events.push_back({ 6 * 3600 + 60, "http /metrics", [] {
+            SimHttp::Response response = SimHttp::request(HTTP_GET, "/metrics");
+            if (!timeline) return;
+            printf("    %d, %u bytes\n", response.code, (unsigned)response.body.length());
+            // Samples only; HELP/TYPE comments and buckets would drown the timeline
+            const char* line = response.body.c_str();
+            while (*line) {
+                const char* end = strchr(line, '\n');
+                int length = end ? (int)(end - line) : (int)strlen(line);
+                if (*line != '#' && !strstr(std::string(line, length).c_str(), "_bucket")) {
+                    printf("    %.*s\n", length, line);
+                }
+                line += length + (end ? 1 : 0);
+            }
+        } });
+        return events;
+    }
+}
+
+int main(int argc, char** argv) {
+    double hours = 0;
+    bool soak = false;
+    const char* tracePath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--hours") == 0 && i + 1 < argc) {
+            hours = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--verbose") == 0) {
+            SimSystem::setSerialEcho(true);
+        } else if (strcmp(argv[i], "--quiet") == 0) {
+            timeline = false;
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            tracePath = argv[++i];
+        } else if (strcmp(argv[i], "--soak") == 0) {
+            soak = true;
+        } else if (strcmp(argv[i], "--router-late") == 0 && i + 1 < argc) {
+            routerLateS = (uint32_t)(atof(argv[++i]) * 60);
+        } else {
+            fprintf(stderr, "usage: %s [--hours N] [--soak] [--router-late MINUTES] [--verbose] [--quiet] [--trace out.json]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    setenv("TZ", "UTC", 1);
+    tzset();
+    SimSystem::seedRandom(12345);
+    if (hours <= 0) hours = soak ? 96 : 24;
+    SimNtp::setTime(SIM_START_EPOCH);
+    if (soak) SimNtp::setDriftPpm(SOAK_DRIFT_PPM);
+    provision();
+    if (routerLateS) SimWiFi::setApAvailable(false);
+    uint32_t provisionWrites = SimNvs::writeCount();
+
+    auto hostStart = std::chrono::steady_clock::now();
+    fl::EngineEvents::addListener(&frameProbe);
+    setup();
+    note("setup() returned");
+
+    std::vector<Event> events = soak ? soakScenario() : dayScenario();
+    if (routerLateS) {
+        events.push_back({ routerLateS, "router up", [] { SimWiFi::setApAvailable(true); } });
+        std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.atSec < b.atSec; });
+    }
+    size_t nextEvent = 0;
+    uint64_t endUs = (uint64_t)(hours * 3600e6);
+    uint64_t iterations = 0;
+    uint64_t worstLoopNs = 0;
+    uint64_t loopNs = 0;
+
+    while (SimClock::nowUs() < endUs) {
+        while (nextEvent < events.size() && SimClock::nowUs() >= (uint64_t)events[nextEvent].atSec * 1000000) {
+            note(events[nextEvent].label);
+            events[nextEvent].action();
+            nextEvent++;
+        }
+
+        auto before = std::chrono::steady_clock::now();
+        loop();
+        uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - before).count();
+        loopNs += ns;
+        if (ns > worstLoopNs) worstLoopNs = ns;
+        iterations++;
+
+        SimHttp::drainEvents();
+        watchLed();
+        if (offline) {
+            int64_t errorUs = llabs(SimNtp::clockErrorUs());
+            if (errorUs > offlineMaxErrorUs) offlineMaxErrorUs = errorUs;
+        }
+    }
+    flushRamp();
+    double hostSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - hostStart).count();
+
+    SchedulerStats scheduler = getSchedulerStats();
+    LEDFrameStats frames = ledController.getFrameStats();
+    MQTTStats mqtt = mqttManager.getStats();
+    size_t devicePublishes = 0;
+    for (const SimBroker::Message& message : SimBroker::log()) {
+        if (message.fromDevice) devicePublishes++;
+    }
+    const std::vector<AsyncEventSource::Frame>* sse = SimHttp::events("/events");
+
+    printf("\n== %.1f virtual hours in %.2f s host (%.0fx)\n", hours, hostSec, hours * 3600 / hostSec);
+    printf("loop       %llu iterations, %.2f us mean host time, %.1f us worst\n",
+           (unsigned long long)iterations, iterations ? loopNs / 1e3 / iterations : 0.0, worstLoopNs / 1e3);
+    printf("scheduler  %u wakeups, %u transitions\n", scheduler.wakeups, scheduler.transitions);
+    printf("led        %u frames, %u dropped commands\n", frames.frames, frames.droppedCommands);
+    printf("dither     %u frames over %.1f s in the dim band (%.0f Hz), idle otherwise\n", frames.ditherFrames,
+           frames.ditherUs / 1e6, frames.ditherUs ? frames.ditherFrames / (frames.ditherUs / 1e6) : 0.0);
+    const StripConfig& strip = ledController.getStripConfig();
+    WireTiming rmt = modelWireTiming(LedDriver::Rmt, strip.chipset, strip.outputs, strip.count);
+    WireTiming i2s = modelWireTiming(LedDriver::I2s, strip.chipset, strip.outputs, strip.count);
+    printf("wire       %ux%u %s: %u us/frame rmt (%u irq), %u us/frame i2s (%u irq), modelled\n",
+           strip.outputs, strip.count, ledChipsetName(strip.chipset), rmt.frameUs, rmt.interrupts, i2s.frameUs, i2s.interrupts);
+    printf("mqtt       %u attempts, %u failures, %u reconnects, %u ms offline, %zu publishes\n",
+           mqtt.attempts, mqtt.failures, mqtt.reconnects, mqtt.disconnectedMs, devicePublishes);
+    printf("mqtt       %u commands, %u own echoes ignored, %u state updates\n", mqtt.commands, mqtt.echoesIgnored,
+           mqtt.statePublishes);
+    std::string retainedState, retainedAvailability;
+    for (const SimBroker::Message& message : SimBroker::log()) {
+        if (!message.retained || !message.fromDevice) continue;
+        if (message.topic.size() > 6 && message.topic.compare(message.topic.size() - 6, 6, "/state") == 0) {
+            SimBroker::retained(message.topic.c_str(), &retainedState);
+        } else {
+            SimBroker::retained(message.topic.c_str(), &retainedAvailability);
+        }
+    }
+    printf("retained   %s, %s\n", retainedAvailability.c_str(), retainedState.c_str());
+    const SimBroker::Message* telemetry = nullptr;
+    for (const SimBroker::Message& message : SimBroker::log()) {
+        if (message.fromDevice && message.topic.find("/telemetry") != std::string::npos) telemetry = &message;
+    }
+    printf("telemetry  %u publishes, last %s\n", mqtt.telemetryPublishes, telemetry ? telemetry->payload.c_str() : "-");
+    printf("boot      ");
+    for (uint8_t i = 0; i < (uint8_t)BootPhase::Count; i++) {
+        printf("%s %s %d ms", i ? "," : "", Telemetry::bootPhaseName((BootPhase)i),
+               (int)Telemetry::getBootMs((BootPhase)i));
+    }
+    printf("\n");
+    TimeStatus clock = Timekeeper::getStatus();
+    printf("clock      %s, %u syncs, drift %+.1f ppm, last sync stepped %d ms, off by %lld ms now\n",
+           Timekeeper::sourceName(clock.source), clock.syncs, clock.driftPpb / 1000.0, (int)clock.lastStepMs,
+           (long long)(SimNtp::clockErrorUs() / 1000));
+    printf("nvs        %u writes (%u settings commits)\n",
+           SimNvs::writeCount() - provisionWrites, SettingsStore::getCommitCount());
+    printf("ntp        %u syncs\n", SimNtp::syncCount());
+    printf("sse        %zu frames\n", sse ? sse->size() : (size_t)0);
+#if OTWU_TRACE
+    // What /trace would serve at the end of the run
+    SimHttp::Response trace = SimHttp::request(HTTP_GET, "/trace");
+    size_t traceEvents = 0;
+    for (size_t at = trace.body.find("\"ts\":"); at != std::string::npos; at = trace.body.find("\"ts\":", at + 1)) {
+        traceEvents++;
+    }
+    printf("trace      %zu events, %zu bytes of JSON", traceEvents, trace.body.size());
+    if (tracePath) {
+        FILE* file = fopen(tracePath, "w");
+        if (file) {
+            fwrite(trace.body.data(), 1, trace.body.size(), file);
+            fclose(file);
+            printf(" in %s", tracePath);
+        }
+    }
+    printf("\n");
+#else
+    if (tracePath) fprintf(stderr, "--trace needs a build with OTWU_TRACE on\n");
+#endif
+
+    int status = 0;
+    // With every counter and histogram populated the page is at its
+    // largest; it must still fit the buffer the handler reserves
+    SimHttp::Response metrics = SimHttp::request(HTTP_GET, "/metrics");
+    printf("metrics    %d, %zu bytes - %s\n", metrics.code, metrics.body.size(), metrics.code == 200 ? "ok" : "FAIL");
+    if (metrics.code != 200) status = 1;
+
+    if (soak) {
+        // The schedule must keep its daily rhythm through the outage, on a
+        // clock that stays within SOAK_MAX_ERROR_US of the truth
+        printf("soak       %lld ms worst offline clock error, transitions per day", (long long)(offlineMaxErrorUs / 1000));
+        bool steady = dayTransitions.size() == sizeof(SOAK_DAY_STARTS_S) / sizeof(SOAK_DAY_STARTS_S[0]);
+        for (size_t i = 1; i < dayTransitions.size(); i++) {
+            uint32_t count = dayTransitions[i] - dayTransitions[i - 1];
+            printf(" %u", count);
+            steady &= count == dayTransitions[1] - dayTransitions[0];
+        }
+        bool pass = steady && offlineMaxErrorUs <= SOAK_MAX_ERROR_US;
+        printf(" - %s\n", pass ? "ok" : "FAIL");
+        if (!pass) status = 1;
+    }
+
+    if (routerLateS) {
+        // The device must find the router from the portal on its own,
+        // without restarting
+        int32_t wifiMs = Telemetry::getBootMs(BootPhase::WiFi);
+        int32_t mqttMs = Telemetry::getBootMs(BootPhase::Mqtt);
+        bool pass = wifiMs >= (int32_t)(routerLateS * 1000) && mqttMs >= wifiMs && SimSystem::restartCount() == 0 &&
+                    SimHttp::request(HTTP_GET, "/api/state").code == 200;
+        printf("late       router up at %u s, online at %d ms, %u restarts - %s\n", routerLateS, (int)wifiMs,
+               SimSystem::restartCount(), pass ? "ok" : "FAIL");
+        if (!pass) status = 1;
+    }
+
+    // Firmware tasks never return; skip static teardown under their feet
+    fflush(stdout);
+    std::_Exit(status);
+}
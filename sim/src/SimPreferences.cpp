@@ -0,0 +1,131 @@
+// SimPreferences.cpp
+// In-memory NVS. Like NVS itself, writing an identical value is not a
+// flash write and is not counted.
+#include <Preferences.h>
+#include <Sim.h>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace {
+    struct Item {
+        bool isBlob;
+        uint64_t number;
+        std::string blob;
+    };
+
+    std::mutex nvsMutex;
+    std::map<std::string, std::map<std::string, Item>> store;
+    uint32_t writes = 0;
+    uint32_t erases = 0;
+}
+
+bool Preferences::begin(const char* name, bool readOnly) {
+    if (!name || strlen(name) > 15) return false;
+    std::lock_guard<std::mutex> lock(nvsMutex);
+    // Read-only opens of a namespace that was never written fail on target
+    if (readOnly && store.find(name) == store.end()) return false;
+    store[name];
+    _ns = name;
+    _readOnly = readOnly;
+    _open = true;
+    return true;
+}
+
+bool Preferences::clear() {
+    if (!_open || _readOnly) return false;
+    std::lock_guard<std::mutex> lock(nvsMutex);
+    auto& ns = store[_ns.c_str()];
+    if (!ns.empty()) erases++;
+    ns.clear();
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!_open || _readOnly) return false;
+    std::lock_guard<std::mutex> lock(nvsMutex);
+    if (store[_ns.c_str()].erase(key)) erases++;
+    return true;
+}
+
+bool Preferences::isKey(const char* key) {
+    if (!_open) return false;
+    std::lock_guard<std::mutex> lock(nvsMutex);
+    auto& ns = store[_ns.c_str()];
+    return ns.find(key) != ns.end();
+}
+
+bool Preferences::putValue(const char* key, uint64_t value) {
+    if (!_open || _readOnly || !key) return false;
+    std::lock_guard<std::mutex> lock(nvsMutex);
+    auto& ns = store[_ns.c_str()];
+    auto it = ns.find(key);
+    bool same = it != ns.end() && !it->second.isBlob && it->second.number == value;
+    Item& item = ns[key];
+    item.isBlob = false;
+    item.number = value;
+    if (!same) writes++;
+    return true;
+}
+
+uint64_t Preferences::getValue(const char* key, uint64_t defaultValue) {
+    if (!_open || !key) return defaultValue;
+    std::lock_guard<std::mutex> lock(nvsMutex);
+    auto& ns = store[_ns.c_str()];
+    auto it = ns.find(key);
+    if (it == ns.end() || it->second.isBlob) return defaultValue;
+    return it->second.number;
+}
+
+size_t Preferences::putULong64(const char* key, uint64_t value) {
+    return putValue(key, value) ? 8 : 0;
+}
+
+size_t Preferences::putString(const char* key, const char* value) {
+    return putBytes(key, value, strlen(value));
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+    if (!_open || _readOnly || !key) return 0;
+    std::lock_guard<std::mutex> lock(nvsMutex);
+    std::string bytes((const char*)value, length);
+    auto& ns = store[_ns.c_str()];
+    auto it = ns.find(key);
+    if (it != ns.end() && it->second.isBlob && it->second.blob == bytes) return length;
+    Item& item = ns[key];
+    item.isBlob = true;
+    item.number = 0;
+    item.blob = bytes;
+    writes++;
+    return length;
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+    if (!_open || !key) return defaultValue;
+    std::lock_guard<std::mutex> lock(nvsMutex);
+    auto& ns = store[_ns.c_str()];
+    auto it = ns.find(key);
+    if (it == ns.end() || !it->second.isBlob) return defaultValue;
+    return String(it->second.blob);
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    if (!_open || !key) return 0;
+    std::lock_guard<std::mutex> lock(nvsMutex);
+    auto& ns = store[_ns.c_str()];
+    auto it = ns.find(key);
+    return it == ns.end() || !it->second.isBlob ? 0 : it->second.blob.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLength) {
+    if (!_open || !key) return 0;
+    std::lock_guard<std::mutex> lock(nvsMutex);
+    auto& ns = store[_ns.c_str()];
+    auto it = ns.find(key);
+    if (it == ns.end() || !it->second.isBlob || it->second.blob.size() > maxLength) return 0;
+    memcpy(buffer, it->second.blob.data(), it->second.blob.size());
+    return it->second.blob.size();
+}
+
+uint32_t SimNvs::writeCount() { return writes; }
+uint32_t SimNvs::eraseCount() { return erases; }
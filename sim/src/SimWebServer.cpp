@@ -0,0 +1,350 @@
+// SimWebServer.cpp
+// Request dispatch and event streams for the ESPAsyncWebServer stand-in.
+#include <ESPAsyncWebServer.h>
+#include <Sim.h>
+#include <strings.h>
+
+namespace {
+    std::vector<AsyncWebServer*> servers;
+
+    std::string urlDecode(const std::string& text) {
+        std::string out;
+        for (size_t i = 0; i < text.size(); i++) {
+            if (text[i] == '+') {
+                out += ' ';
+            } else if (text[i] == '%' && i + 2 < text.size()) {
+                out += (char)strtol(text.substr(i + 1, 2).c_str(), nullptr, 16);
+                i += 2;
+            } else {
+                out += text[i];
+            }
+        }
+        return out;
+    }
+
+    bool isParamChar(char c) {
+        return c && c != '{' && c != '[' && c != '&' && c != '=';
+    }
+
+    // Like the ESP32 server: a form post, or a text/plain body that starts
+    // like one ("name=..."), becomes parameters and skips the body handler
+    bool isPlainPost(const AsyncWebServerRequest& request, const std::string& body) {
+        AsyncWebHeader* type = request.getHeader("Content-Type");
+        if (!type) return false;
+        if (type->value().startsWith("application/x-www-form-urlencoded")) return true;
+        if (type->value() != "text/plain") return false;
+        size_t i = 0;
+        while (i < body.size() && isParamChar(body[i])) i++;
+        return i > 0 && i + 1 < body.size() && body[i] == '=';
+    }
+
+    // Its parameter split: at '&', then at the first '='; a piece without
+    // one (or starting with '{' or '[') is named "body"
+    void parsePlainPost(AsyncWebServerRequest* request, const std::string& body) {
+        size_t pos = 0;
+        while (pos < body.size()) {
+            size_t end = body.find('&', pos);
+            if (end == std::string::npos) end = body.size();
+            std::string piece = body.substr(pos, end - pos);
+            size_t eq = piece.find('=');
+            if (piece[0] != '{' && piece[0] != '[' && eq != std::string::npos && eq > 0) {
+                request->addParam(String(urlDecode(piece.substr(0, eq))), String(urlDecode(piece.substr(eq + 1))), true);
+            } else {
+                request->addParam(String("body"), String(urlDecode(piece)), true);
+            }
+            pos = end + 1;
+        }
+    }
+
+    void parseFields(AsyncWebServerRequest* request, const std::string& fields, bool post) {
+        size_t pos = 0;
+        while (pos < fields.size()) {
+            size_t end = fields.find('&', pos);
+            if (end == std::string::npos) end = fields.size();
+            std::string pair = fields.substr(pos, end - pos);
+            size_t eq = pair.find('=');
+            std::string name = urlDecode(pair.substr(0, eq));
+            std::string value = eq == std::string::npos ? std::string() : urlDecode(pair.substr(eq + 1));
+            if (!name.empty()) request->addParam(String(name), String(value), post);
+            pos = end + 1;
+        }
+    }
+}
+
+// ----- request -----
+
+AsyncWebServerRequest::AsyncWebServerRequest(WebRequestMethod method, const String& url, const String& host)
+    : _method(method), _url(url), _host(host) {}
+
+AsyncWebServerRequest::~AsyncWebServerRequest() {
+    for (AsyncWebParameter* param : _params) delete param;
+    for (AsyncWebHeader* header : _headers) delete header;
+    delete _response;
+    free(_tempObject);
+}
+
+bool AsyncWebServerRequest::hasParam(const String& name, bool post, bool file) const {
+    return getParam(name, post, file) != nullptr;
+}
+
+AsyncWebParameter* AsyncWebServerRequest::getParam(const String& name, bool post, bool) const {
+    for (AsyncWebParameter* param : _params) {
+        if (param->name() == name && param->isPost() == post) return param;
+    }
+    return nullptr;
+}
+
+AsyncWebParameter* AsyncWebServerRequest::getParam(size_t index) const {
+    return index < _params.size() ? _params[index] : nullptr;
+}
+
+AsyncWebHeader* AsyncWebServerRequest::getHeader(const String& name) const {
+    for (AsyncWebHeader* header : _headers) {
+        if (strcasecmp(header->name().c_str(), name.c_str()) == 0) return header;
+    }
+    return nullptr;
+}
+
+void AsyncWebServerRequest::addParam(const String& name, const String& value, bool post) {
+    _params.push_back(new AsyncWebParameter(name, value, post));
+}
+
+void AsyncWebServerRequest::addHeader(const String& name, const String& value) {
+    _headers.push_back(new AsyncWebHeader(name, value));
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse* response) {
+    if (_response) {
+        delete response;
+        return;
+    }
+    _response = response;
+}
+
+void AsyncWebServerRequest::send(int code, const String& contentType, const String& content) {
+    send(beginResponse(code, contentType, content));
+}
+
+void AsyncWebServerRequest::send_P(int code, const String& contentType, const char* content) {
+    send(beginResponse(code, contentType, String(content)));
+}
+
+void AsyncWebServerRequest::send_P(int code, const String& contentType, const uint8_t* content, size_t length) {
+    send(beginResponse_P(code, contentType, content, length));
+}
+
+void AsyncWebServerRequest::redirect(const String& url) {
+    AsyncWebServerResponse* response = beginResponse(302);
+    response->addHeader("Location", url);
+    send(response);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const String& contentType, const String& content) {
+    AsyncWebServerResponse* response = new AsyncWebServerResponse(code, contentType);
+    response->body().assign(content.c_str(), content.length());
+    return response;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse_P(int code, const String& contentType,
+                                                               const uint8_t* content, size_t length) {
+    AsyncWebServerResponse* response = new AsyncWebServerResponse(code, contentType);
+    response->body().assign((const char*)content, length);
+    return response;
+}
+
+AsyncResponseStream* AsyncWebServerRequest::beginResponseStream(const String& contentType, size_t bufferSize) {
+    return new AsyncResponseStream(contentType, bufferSize);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginChunkedResponse(const String& contentType,
+                                                                    AwsResponseFiller callback) {
+    return new AsyncChunkedResponse(contentType, callback);
+}
+
+void AsyncChunkedResponse::finish() {
+    uint8_t segment[1460];
+    while (size_t length = _filler(segment, sizeof(segment), _body.size())) {
+        _body.append((const char*)segment, length);
+    }
+}
+
+// ----- event source -----
+
+AsyncEventSource::~AsyncEventSource() {
+    disconnectClients();
+}
+
+void AsyncEventSourceClient::send(const char* message, const char* event, uint32_t id, uint32_t) {
+    _queued++;
+    _source->record(message, event, id);
+}
+
+void AsyncEventSource::record(const char* message, const char* event, uint32_t id) {
+    _frames.push_back({ event ? event : "", message ? message : "", id });
+}
+
+void AsyncEventSource::send(const char* message, const char* event, uint32_t id, uint32_t) {
+    for (AsyncEventSourceClient* client : _clients) client->_queued++;
+    record(message, event, id);
+}
+
+bool AsyncEventSource::try_send(const char* message, const char* event, uint32_t id, uint32_t reconnect) {
+    for (AsyncEventSourceClient* client : _clients) {
+        if (client->_queued >= _maxQueued) return false;
+    }
+    send(message, event, id, reconnect);
+    return true;
+}
+
+size_t AsyncEventSource::avgPacketsWaiting() const {
+    if (_clients.empty()) return 0;
+    size_t total = 0;
+    for (AsyncEventSourceClient* client : _clients) total += client->_queued;
+    return (total + _clients.size() - 1) / _clients.size();
+}
+
+AsyncEventSourceClient* AsyncEventSource::connectClient() {
+    AsyncEventSourceClient* client = new AsyncEventSourceClient(this);
+    _clients.push_back(client);
+    if (_connectCallback) _connectCallback(client);
+    return client;
+}
+
+void AsyncEventSource::disconnectClients() {
+    for (AsyncEventSourceClient* client : _clients) delete client;
+    _clients.clear();
+}
+
+void AsyncEventSource::drain() {
+    for (AsyncEventSourceClient* client : _clients) client->_queued = 0;
+}
+
+// ----- server -----
+
+AsyncWebServer::~AsyncWebServer() {
+    servers.erase(std::remove(servers.begin(), servers.end(), this), servers.end());
+}
+
+void AsyncWebServer::begin() {
+    if (_running) return;
+    _running = true;
+    servers.push_back(this);
+}
+
+void AsyncWebServer::on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest) {
+    _routes.push_back({ uri, method, onRequest, nullptr });
+}
+
+void AsyncWebServer::on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                        ArUploadHandlerFunction, ArBodyHandlerFunction onBody) {
+    _routes.push_back({ uri, method, onRequest, onBody });
+}
+
+AsyncWebHandler& AsyncWebServer::addHandler(AsyncWebHandler* handler) {
+    if (AsyncEventSource* source = dynamic_cast<AsyncEventSource*>(handler)) _eventSources.push_back(source);
+    return *handler;
+}
+
+bool AsyncWebServer::dispatch(AsyncWebServerRequest* request) {
+    std::string path = request->url().c_str();
+    for (Route& route : _routes) {
+        if (route.uri != path || !(route.method & request->method())) continue;
+        if (route.onBody && !request->rawBody().empty()) {
+            std::string body = request->rawBody();
+            route.onBody(request, (uint8_t*)&body[0], body.size(), 0, body.size());
+        }
+        route.onRequest(request);
+        return true;
+    }
+    return false;
+}
+
+bool AsyncWebServer::dispatchNotFound(AsyncWebServerRequest* request) {
+    if (!_notFound) return false;
+    _notFound(request);
+    return true;
+}
+
+void AsyncWebServer::drainEvents() {
+    for (AsyncEventSource* source : _eventSources) source->drain();
+}
+
+AsyncEventSource* AsyncWebServer::eventSource(const String& url) const {
+    for (AsyncEventSource* source : _eventSources) {
+        if (source->url() == url) return source;
+    }
+    return nullptr;
+}
+
+// ----- scenario side -----
+
+std::string SimHttp::Response::header(const char* name) const {
+    for (const auto& h : headers) {
+        if (strcasecmp(h.first.c_str(), name) == 0) return h.second;
+    }
+    return std::string();
+}
+
+SimHttp::Response SimHttp::request(WebRequestMethod method, const char* url,
+                                   const std::vector<std::pair<std::string, std::string>>& headers,
+                                   const std::string& body) {
+    std::string full = url;
+    size_t query = full.find('?');
+    AsyncWebServerRequest request(method, String(full.substr(0, query)), String("otw.local"));
+    if (query != std::string::npos) parseFields(&request, full.substr(query + 1), false);
+    for (const auto& header : headers) request.addHeader(String(header.first), String(header.second));
+    if (!body.empty()) {
+        if (method == HTTP_POST && isPlainPost(request, body)) {
+            parsePlainPost(&request, body);
+        } else {
+            request.setBody(body);
+            if (method == HTTP_POST && request.getHeader("Content-Type") == nullptr) parseFields(&request, body, true);
+        }
+    }
+
+    bool handled = false;
+    for (AsyncWebServer* server : servers) {
+        if (server->running() && server->dispatch(&request)) {
+            handled = true;
+            break;
+        }
+    }
+    for (AsyncWebServer* server : servers) {
+        if (handled) break;
+        handled = server->running() && server->dispatchNotFound(&request);
+    }
+    if (!handled) request.send(404, "text/plain", "Not found");
+
+    Response response = { 500, std::string(), std::string(), {} };
+    if (AsyncWebServerResponse* sent = request.response()) {
+        sent->finish();
+        response.code = sent->code();
+        response.contentType = sent->contentType().c_str();
+        response.body = sent->body();
+        for (const AsyncWebHeader& header : sent->headers()) {
+            response.headers.emplace_back(header.name().c_str(), header.value().c_str());
+        }
+    }
+    return response;
+}
+
+bool SimHttp::connectEvents(const char* path) {
+    for (AsyncWebServer* server : servers) {
+        if (AsyncEventSource* source = server->eventSource(path)) {
+            source->connectClient();
+            return true;
+        }
+    }
+    return false;
+}
+
+const std::vector<AsyncEventSource::Frame>* SimHttp::events(const char* path) {
+    for (AsyncWebServer* server : servers) {
+        if (AsyncEventSource* source = server->eventSource(path)) return &source->frames();
+    }
+    return nullptr;
+}
+
+void SimHttp::drainEvents() {
+    for (AsyncWebServer* server : servers) server->drainEvents();
+}
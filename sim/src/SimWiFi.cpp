@@ -0,0 +1,181 @@
+// SimWiFi.cpp
+// Station link, scans and DNS for the host simulation.
+#include <WiFi.h>
+#include <Sim.h>
+#include "SimInternal.h"
+#include <string>
+#include <vector>
+
+WiFiClass WiFi;
+
+namespace {
+    struct ScanResult {
+        std::string ssid;
+        int8_t rssi;
+        bool open;
+    };
+
+    bool apAvailable = true;
+    // Association plus DHCP; a join without a channel and BSSID scans
+    // all channels first, a static address skips DHCP
+    uint32_t connectDelayMs = 800;
+    const uint32_t JOIN_SCAN_MS = 1500;
+    const uint32_t DHCP_MS = 500;
+    IPAddress staticIp;
+    bool joining = false;
+    uint64_t linkUpAtUs = 0;
+    wifi_mode_t currentMode = WIFI_OFF;
+    std::string joinedSsid;
+    uint8_t bssid[6] = { 0x0C, 0x80, 0x63, 0x11, 0x22, 0x33 };
+
+    std::vector<ScanResult> scanResults = {
+        { "HomeNet", -48, false },
+        { "HomeNet", -71, false },
+        { "Neighbour-5G", -80, false },
+        { "CafeGuest", -86, true },
+    };
+    bool scanRunning = false;
+    bool scanDone = false;
+    uint64_t scanDoneAtUs = 0;
+    const uint64_t SCAN_DURATION_US = 2200000;
+
+    bool linkUp() {
+        return joining && apAvailable && SimClock::nowUs() >= linkUpAtUs;
+    }
+
+    bool scanFinished() {
+        if (scanRunning && SimClock::nowUs() >= scanDoneAtUs) {
+            scanRunning = false;
+            scanDone = true;
+        }
+        return scanDone;
+    }
+}
+
+wl_status_t WiFiClass::status() {
+    if (linkUp()) return WL_CONNECTED;
+    return joining ? WL_DISCONNECTED : WL_IDLE_STATUS;
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char*, int32_t channel, const uint8_t* apBssid, bool connect) {
+    joinedSsid = ssid ? ssid : "";
+    if (currentMode == WIFI_OFF) currentMode = WIFI_STA;
+    if (connect) {
+        uint64_t delayMs = connectDelayMs;
+        if (!channel || !apBssid) delayMs += JOIN_SCAN_MS;
+        if ((uint32_t)staticIp) delayMs -= DHCP_MS;
+        joining = true;
+        linkUpAtUs = SimClock::nowUs() + delayMs * 1000;
+        // Pinned to an access point that is not there: never associates
+        if (channel && apBssid && (channel != 6 || memcmp(apBssid, bssid, 6) != 0)) linkUpAtUs = UINT64_MAX;
+    }
+    return status();
+}
+
+bool WiFiClass::config(IPAddress localIp, IPAddress, IPAddress, IPAddress) {
+    staticIp = localIp;
+    return true;
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool) {
+    if (linkUp()) simBrokerLinkLost();
+    joining = false;
+    if (wifiOff) currentMode = WIFI_OFF;
+    return true;
+}
+
+bool WiFiClass::reconnect() {
+    if (joinedSsid.empty()) return false;
+    joining = true;
+    linkUpAtUs = SimClock::nowUs() + (uint64_t)connectDelayMs * 1000;
+    return true;
+}
+
+bool WiFiClass::mode(wifi_mode_t mode) {
+    currentMode = mode;
+    return true;
+}
+
+IPAddress WiFiClass::localIP() {
+    if (!linkUp()) return IPAddress();
+    return (uint32_t)staticIp ? staticIp : IPAddress(192, 168, 1, 57);
+}
+
+IPAddress WiFiClass::gatewayIP() { return linkUp() ? IPAddress(192, 168, 1, 1) : IPAddress(); }
+IPAddress WiFiClass::subnetMask() { return linkUp() ? IPAddress(255, 255, 255, 0) : IPAddress(); }
+IPAddress WiFiClass::dnsIP() { return linkUp() ? IPAddress(192, 168, 1, 1) : IPAddress(); }
+
+int8_t WiFiClass::RSSI() { return linkUp() ? -52 : 0; }
+String WiFiClass::SSID() { return linkUp() ? String(joinedSsid) : String(); }
+uint8_t* WiFiClass::BSSID() { return linkUp() ? bssid : nullptr; }
+int32_t WiFiClass::channel() { return linkUp() ? 6 : 0; }
+
+uint8_t* WiFiClass::macAddress(uint8_t* mac) {
+    static const uint8_t simMac[6] = { 0x24, 0x6F, 0x28, 0xA1, 0xB2, 0xC3 };
+    memcpy(mac, simMac, 6);
+    return mac;
+}
+
+String WiFiClass::macAddress() {
+    uint8_t mac[6];
+    macAddress(mac);
+    char buffer[18];
+    snprintf(buffer, sizeof(buffer), "%02X:%02X:%02X:%02X:%02X:%02X",
+             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    return String(buffer);
+}
+
+int WiFiClass::hostByName(const char*, IPAddress& result) {
+    if (!linkUp()) return 0;
+    result = IPAddress(10, 0, 0, 2);
+    return 1;
+}
+
+int16_t WiFiClass::scanNetworks(bool async) {
+    scanRunning = true;
+    scanDone = false;
+    scanDoneAtUs = SimClock::nowUs() + SCAN_DURATION_US;
+    if (!async) {
+        SimClock::advance(SCAN_DURATION_US);
+        scanFinished();
+        return (int16_t)scanResults.size();
+    }
+    return WIFI_SCAN_RUNNING;
+}
+
+int16_t WiFiClass::scanComplete() {
+    if (scanFinished()) return (int16_t)scanResults.size();
+    return scanRunning ? WIFI_SCAN_RUNNING : WIFI_SCAN_FAILED;
+}
+
+void WiFiClass::scanDelete() { scanDone = false; }
+
+String WiFiClass::SSID(uint8_t index) {
+    return index < scanResults.size() ? String(scanResults[index].ssid) : String();
+}
+
+int32_t WiFiClass::RSSI(uint8_t index) {
+    return index < scanResults.size() ? scanResults[index].rssi : 0;
+}
+
+wifi_auth_mode_t WiFiClass::encryptionType(uint8_t index) {
+    return index < scanResults.size() && scanResults[index].open ? WIFI_AUTH_OPEN : WIFI_AUTH_WPA2_PSK;
+}
+
+uint8_t* WiFiClass::BSSID(uint8_t) { return bssid; }
+int32_t WiFiClass::channel(uint8_t) { return 6; }
+
+void SimWiFi::setApAvailable(bool available) {
+    if (available && !apAvailable && joining) {
+        // Auto-reconnect: the link comes back after a fresh association
+        linkUpAtUs = SimClock::nowUs() + (uint64_t)connectDelayMs * 1000;
+    }
+    if (!available && apAvailable && linkUp()) simBrokerLinkLost();
+    apAvailable = available;
+}
+
+void SimWiFi::setConnectDelayMs(uint32_t delayMs) { connectDelayMs = delayMs; }
+
+void SimWiFi::addScanResult(const char* ssid, int8_t rssi, bool open) {
+    scanResults.push_back({ ssid, rssi, open });
+}
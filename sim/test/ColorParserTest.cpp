@@ -0,0 +1,134 @@
+// ColorParserTest.cpp
+#include "Test.h"
+#include <string.h>
+#include "LEDController/ColorParser.h"
+#include "LEDController/LEDCommand.h"
+
+namespace {
+    // -1 if rejected, otherwise 0xRRGGBB
+    long parse(const char* text) {
+        CRGB color;
+        if (!parseColor(text, strlen(text), color)) return -1;
+        return ((long)color.r << 16) | ((long)color.g << 8) | color.b;
+    }
+
+    long rgb(const CRGB& color) {
+        return ((long)color.r << 16) | ((long)color.g << 8) | color.b;
+    }
+
+    void testHex() {
+        CHECK_EQ(parse("#FF8800"), 0xFF8800);
+        CHECK_EQ(parse("#ff8800"), 0xFF8800);
+        CHECK_EQ(parse("#000000"), 0x000000);
+        CHECK_EQ(parse("#FF880"), -1);
+        CHECK_EQ(parse("#FF88000"), -1);
+        CHECK_EQ(parse("#GG0000"), -1);
+        CHECK_EQ(parse("# FF8800"), -1);
+        CHECK_EQ(parse("#"), -1);
+    }
+
+    void testRgb() {
+        CHECK_EQ(parse("rgb(255,136,0)"), 0xFF8800);
+        CHECK_EQ(parse("RGB( 1 , 2 , 3 )"), 0x010203);
+        CHECK_EQ(parse("rgb(0,0,0)"), 0x000000);
+        CHECK_EQ(parse("rgb(256,0,0)"), -1);
+        CHECK_EQ(parse("rgb(1,2)"), -1);
+        CHECK_EQ(parse("rgb(1,2,3,4)"), -1);
+        CHECK_EQ(parse("rgb(1,2,3)x"), -1);
+        CHECK_EQ(parse("rgb(-1,2,3)"), -1);
+        CHECK_EQ(parse("rgb(,2,3)"), -1);
+    }
+
+    void testHsv() {
+        CHECK_EQ(parse("hsv(240,100,100)"), 0x0000FF);
+        CHECK_EQ(parse("hsv(0,100,100)"), 0xFF0000);
+        CHECK_EQ(parse("hsv(120,100,100)"), 0x00FF00);
+        CHECK_EQ(parse("hsv(60,100,100)"), 0xFFFF00);
+        CHECK_EQ(parse("hsv(360,100,100)"), 0xFF0000);  // 360 wraps to red
+        CHECK_EQ(parse("hsv(0,0,100)"), 0xFFFFFF);
+        CHECK_EQ(parse("hsv(200,80,0)"), 0x000000);
+        CHECK_EQ(parse("HSV( 240 , 100 , 100 )"), 0x0000FF);
+        CHECK_EQ(parse("hsv(361,100,100)"), -1);
+        CHECK_EQ(parse("hsv(0,101,100)"), -1);
+        CHECK_EQ(parse("hsv(0,100,101)"), -1);
+        CHECK_EQ(parse("hsv(0,100)"), -1);
+        CHECK_EQ(parse("hsv 0,100,100"), -1);
+        CHECK_EQ(parse("hsl(0,100,100)"), -1);
+    }
+
+    void testKelvin() {
+        // 2700 K is a table row; warmwhite is defined as that row
+        CHECK_EQ(parse("kelvin:2700"), 0xFFA757);
+        CHECK_EQ(parse("warmwhite"), 0xFFA757);
+        CHECK_EQ(parse("kelvin=2700"), 0xFFA757);
+        CHECK_EQ(parse("Kelvin: 2700"), 0xFFA757);
+        CHECK_EQ(parse("kelvin:1000"), rgb(kelvinToRgb(1000)));
+        CHECK_EQ(parse("kelvin:10000"), rgb(kelvinToRgb(10000)));
+        CHECK_EQ(parse("kelvin:999"), -1);
+        CHECK_EQ(parse("kelvin:10001"), -1);
+        CHECK_EQ(parse("kelvin:"), -1);
+        CHECK_EQ(parse("kelvin:27OO"), -1);
+
+        // The function clamps instead of rejecting
+        CHECK_EQ(rgb(kelvinToRgb(0)), rgb(kelvinToRgb(1000)));
+        CHECK_EQ(rgb(kelvinToRgb(65535)), rgb(kelvinToRgb(10000)));
+        // Between rows the channels stay between the rows' values
+        CRGB low = kelvinToRgb(2700), mid = kelvinToRgb(2750), high = kelvinToRgb(2800);
+        CHECK(mid.g >= low.g && mid.g <= high.g);
+        CHECK(mid.b >= low.b && mid.b <= high.b);
+    }
+
+    void testNames() {
+        const char* const names[] = { "off", "red", "green", "blue", "white", "warmwhite",
+                                      "yellow", "amber", "orange", "pink", "purple", "cyan" };
+        for (const char* name : names) {
+            CRGB color;
+            CHECK(parseColor(name, strlen(name), color));
+            // Every name comes back as itself
+            char text[COLOR_TEXT_SIZE];
+            CHECK(strcmp(formatColor(color, text), name) == 0);
+        }
+        CHECK_EQ(parse("red"), CRGB::Red);
+        CHECK_EQ(parse("green"), CRGB::Green);
+        CHECK_EQ(parse("GREEN"), CRGB::Green);
+        CHECK_EQ(parse("Off"), 0x000000);
+        CHECK_EQ(parse("greenish"), -1);
+        CHECK_EQ(parse("gree"), -1);
+        CHECK_EQ(parse(""), -1);
+
+        CRGB color;
+        CHECK(!parseColor(nullptr, 4, color));
+        char text[COLOR_TEXT_SIZE];
+        CHECK(strcmp(formatColor(CRGB(0x123456), text), "#123456") == 0);
+    }
+
+    void testPalettes() {
+        CHECK(parse("rainbow:0") >= 0);
+        CHECK(parse("LAVA:255") >= 0);
+        CHECK(parse("ocean: 128") >= 0);
+        CHECK_EQ(parse("rainbow:256"), -1);
+        CHECK_EQ(parse("rainbow:"), -1);
+        CHECK_EQ(parse("sunset:10"), -1);
+    }
+
+    void testWhitespace() {
+        // parseColor takes the exact span; commands trim around it
+        CHECK_EQ(parse(" green"), -1);
+        CHECK_EQ(parse("green "), -1);
+        const char* text = " \tgreen\r\n";
+        LEDCommand command;
+        CHECK(parseLEDCommand(text, strlen(text), command));
+        CHECK(command.type == LEDCommand::Type::Color);
+        CHECK_EQ(rgb(command.color), CRGB::Green);
+    }
+}
+
+void testColorParser() {
+    testHex();
+    testRgb();
+    testHsv();
+    testKelvin();
+    testNames();
+    testPalettes();
+    testWhitespace();
+}
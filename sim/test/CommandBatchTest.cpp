@@ -0,0 +1,126 @@
+// CommandBatchTest.cpp
+#include "Test.h"
+#include <string.h>
+#include "CommandBatch/CommandBatch.h"
+#include "ScheduleManager/ScheduleManager.h"
+#include "TaskScheduler/TaskScheduler.h"
+
+namespace {
+    bool parse(const char* text, CommandBatch& batch, uint8_t& failed) {
+        return parseCommandBatch(text, strlen(text), batch, failed);
+    }
+
+    void testRejectedOperation() {
+        CommandBatch batch;
+        uint8_t failed;
+        // All or nothing, with the 1-based position of the first bad one
+        CHECK(!parse("red;brightness:40;bogus;blue", batch, failed));
+        CHECK_EQ(failed, 3);
+        CHECK(!parse("brightness:101;red", batch, failed));
+        CHECK_EQ(failed, 1);
+        CHECK(!parse("red\nsunrise:5", batch, failed));
+        CHECK_EQ(failed, 2);
+        CHECK(!parse("red;schedule:07:00-25:00", batch, failed));
+        CHECK_EQ(failed, 2);
+        // Blank operations do not count towards the position
+        CHECK(!parse("red;;  ;hsv(400,0,0)", batch, failed));
+        CHECK_EQ(failed, 2);
+
+        CHECK(!parse("", batch, failed));
+        CHECK_EQ(failed, 0);
+        CHECK(!parse(" ;\n; ", batch, failed));
+        CHECK_EQ(failed, 0);
+        CHECK(!parseCommandBatch(nullptr, 0, batch, failed));
+    }
+
+    void testSeparators() {
+        CommandBatch batch;
+        uint8_t failed;
+        CHECK(parse("red;brightness:40", batch, failed));
+        CHECK_EQ(batch.operations, 2);
+        CHECK(parse("red\nbrightness:40\n", batch, failed));
+        CHECK_EQ(batch.operations, 2);
+        CHECK(parse(" red \r\n\tbrightness:40 ;; mode:manual\r\n", batch, failed));
+        CHECK_EQ(batch.operations, 3);
+        CHECK(batch.hasColor && batch.color == CRGB(CRGB::Red));
+        CHECK(batch.hasBrightness && batch.brightness == 40);
+        CHECK(batch.hasMode && !batch.autoMode);
+        CHECK(!batch.hasWindows && !batch.hasSunrise && !batch.hasSunset);
+
+        // Later operations win, and the color remembers where it came from
+        CHECK(parse("red;brightness:10;blue;brightness:20", batch, failed));
+        CHECK(batch.color == CRGB(CRGB::Blue));
+        CHECK_EQ(batch.colorOperation, 3);
+        CHECK_EQ(batch.brightness, 20);
+    }
+
+    void testScheduleOperations() {
+        CommandBatch batch;
+        uint8_t failed;
+        CHECK(parse("schedule:07:30-08:00,19:00-19:05;sunrise:20;sunset:0", batch, failed));
+        CHECK(batch.hasWindows && strcmp(batch.windows, "07:30-08:00,19:00-19:05") == 0);
+        CHECK(batch.hasSunrise && batch.sunrise == 20);
+        CHECK(batch.hasSunset && batch.sunset == 0);
+        // Empty clears the windows
+        CHECK(parse("schedule:", batch, failed));
+        CHECK(batch.hasWindows && batch.windows[0] == '\0');
+        CHECK(!parse("sunset:61", batch, failed));
+    }
+
+    void testFormBodies() {
+        // What /api/batch rebuilds from form fields: name=value, one per line
+        CommandBatch batch;
+        uint8_t failed;
+        CHECK(parse("brightness=40\nmode=manual\nschedule=07:00-07:30\nsunrise=10", batch, failed));
+        CHECK_EQ(batch.operations, 4);
+        CHECK(batch.hasBrightness && batch.brightness == 40);
+        CHECK(batch.hasMode && !batch.autoMode);
+        CHECK(batch.hasWindows && strcmp(batch.windows, "07:00-07:30") == 0);
+        CHECK(batch.hasSunrise && batch.sunrise == 10);
+        CHECK(parse("kelvin=2700\nbrightness=5", batch, failed));
+        CHECK(batch.hasColor);
+        CHECK(!parse("brightness=40\ncolor=nope", batch, failed));
+        CHECK_EQ(failed, 2);
+    }
+
+    void testApply() {
+        LEDController led;
+        CommandBatch batch;
+        uint8_t failed;
+
+        // Manual mode: the color is applied
+        setScheduleAutoMode(true);
+        CHECK(parse("mode:manual;blue;brightness:30", batch, failed));
+        CHECK_EQ(applyCommandBatch(batch, led), 0);
+        CHECK(!isScheduleAutoMode());
+        CHECK(led.getColor() == CRGB(CRGB::Blue));
+        CHECK_EQ(led.getBrightnessPercent(), 30);
+
+        // Back to auto: the schedule sets the color, and the caller is told
+        // which operation was superseded
+        CHECK(parse("brightness:50;red;mode:auto", batch, failed));
+        CHECK_EQ(applyCommandBatch(batch, led), 2);
+        CHECK(isScheduleAutoMode());
+        CHECK(led.getColor() == CRGB(CRGB::Blue));
+        CHECK_EQ(led.getBrightnessPercent(), 50);
+
+        // A schedule change in auto mode supersedes the color too...
+        CHECK(parse("schedule:06:00-06:30;green", batch, failed));
+        CHECK_EQ(applyCommandBatch(batch, led), 2);
+        CHECK(led.getColor() == CRGB(CRGB::Blue));
+        // ...but re-sending the same schedule changes nothing, so it does not
+        CHECK(parse("schedule:06:00-06:30;green", batch, failed));
+        CHECK_EQ(applyCommandBatch(batch, led), 0);
+        CHECK(led.getColor() == CRGB(CRGB::Green));
+
+        ScheduleManager::clearGreenWindows();
+    }
+}
+
+void testCommandBatch() {
+    testRejectedOperation();
+    testSeparators();
+    testScheduleOperations();
+    testFormBodies();
+    testApply();
+}
@@ -0,0 +1,72 @@
+// CommandRingTest.cpp
+#include "Test.h"
+#include "LEDController/CommandRing.h"
+#include "LEDController/LEDController.h"
+
+namespace {
+    void testEmpty() {
+        CommandRing<uint32_t, 4> ring;
+        uint32_t item = 77;
+        CHECK(!ring.pop(item));
+        CHECK_EQ(item, 77); // untouched
+
+        CHECK(ring.push(1));
+        CHECK(ring.pop(item));
+        CHECK_EQ(item, 1);
+        CHECK(!ring.pop(item));
+    }
+
+    void testFull() {
+        CommandRing<uint32_t, 4> ring;
+        for (uint32_t i = 0; i < 4; i++) CHECK(ring.push(i));
+        CHECK(!ring.push(4));
+        CHECK(!ring.push(5));
+
+        // The rejected items are not in the ring, and a pop frees one cell
+        uint32_t item = 0;
+        CHECK(ring.pop(item));
+        CHECK_EQ(item, 0);
+        CHECK(ring.push(6));
+        CHECK(!ring.push(7));
+        for (uint32_t expected : { 1u, 2u, 3u, 6u }) {
+            CHECK(ring.pop(item));
+            CHECK_EQ(item, expected);
+        }
+        CHECK(!ring.pop(item));
+    }
+
+    void testWrapAndOrder() {
+        // Many times round the ring at every fill level, so the cell
+        // sequence numbers wrap through each slot
+        CommandRing<uint32_t, 8> ring;
+        uint32_t next = 0;
+        uint32_t expected = 0;
+        for (uint32_t round = 0; round < 200; round++) {
+            uint32_t burst = round % 9;
+            for (uint32_t i = 0; i < burst; i++) CHECK(ring.push(next++));
+            uint32_t item = 0;
+            while (ring.pop(item)) {
+                if (!CHECK_EQ(item, expected)) return;
+                expected++;
+            }
+        }
+        CHECK_EQ(expected, next);
+    }
+
+    void testDroppedCommandsCounted() {
+        // No render task: nothing drains the ring, so every post past the
+        // 16 commands is dropped and counted
+        LEDController led;
+        for (int i = 0; i < 20; i++) led.setColor(CRGB(i, 0, 0));
+        CHECK_EQ(led.getFrameStats().droppedCommands, 20 - 16);
+        // The getters already carry the last request
+        CHECK(led.getColor() == CRGB(19, 0, 0));
+    }
+}
+
+void testCommandRing() {
+    testEmpty();
+    testFull();
+    testWrapAndOrder();
+    testDroppedCommandsCounted();
+}
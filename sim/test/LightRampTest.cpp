@@ -0,0 +1,101 @@
+// LightRampTest.cpp
+#include "Test.h"
+#include "LEDController/LightRamp.h"
+
+namespace {
+    // 2026-03-01 00:00 UTC; the ramps are pinned to epoch time, so a local
+    // midnight is no different from any other instant
+    const int64_t MIDNIGHT_MS = 1772323200LL * 1000;
+    const int64_t MINUTE_MS = 60000;
+
+    void testPhaseEdges() {
+        LightRamp ramp = { RampKind::Sunrise, MIDNIGHT_MS, 30 * MINUTE_MS };
+        CHECK_EQ(ramp.phaseAt(MIDNIGHT_MS - MINUTE_MS), 0);
+        CHECK_EQ(ramp.phaseAt(MIDNIGHT_MS), 0);
+        CHECK_EQ(ramp.phaseAt(MIDNIGHT_MS + 1), 0);
+        CHECK_EQ(ramp.phaseAt(MIDNIGHT_MS + 15 * MINUTE_MS), 32768);
+        CHECK_EQ(ramp.phaseAt(MIDNIGHT_MS + 30 * MINUTE_MS - 1), 65535);
+        CHECK_EQ(ramp.phaseAt(MIDNIGHT_MS + 30 * MINUTE_MS), 65535);
+        CHECK_EQ(ramp.phaseAt(MIDNIGHT_MS + 60 * MINUTE_MS), 65535);
+
+        CHECK(!ramp.activeAt(MIDNIGHT_MS - 1));
+        CHECK(ramp.activeAt(MIDNIGHT_MS));
+        CHECK(ramp.activeAt(MIDNIGHT_MS + 30 * MINUTE_MS - 1));
+        CHECK(!ramp.activeAt(MIDNIGHT_MS + 30 * MINUTE_MS));
+
+        // A zero-length ramp is already finished
+        LightRamp instant = { RampKind::Sunrise, MIDNIGHT_MS, 0 };
+        CHECK_EQ(instant.phaseAt(MIDNIGHT_MS - 1), 65535);
+        CHECK_EQ(instant.phaseAt(MIDNIGHT_MS), 65535);
+        CHECK(!instant.activeAt(MIDNIGHT_MS));
+        CHECK_EQ(instant.nextChangeMs(MIDNIGHT_MS - 1), -1);
+
+        LightRamp none = { RampKind::None, MIDNIGHT_MS, 30 * MINUTE_MS };
+        CHECK(!none.activeAt(MIDNIGHT_MS + MINUTE_MS));
+        CHECK_EQ(none.nextChangeMs(MIDNIGHT_MS), -1);
+    }
+
+    void testEndpoints() {
+        CHECK(sunriseColor(0) == CRGB(255, 0, 0));
+        CHECK(sunriseColor(65535) == CRGB(255, 169, 87));
+
+        LightRamp sunrise = { RampKind::Sunrise, MIDNIGHT_MS, 20 * MINUTE_MS };
+        LightRamp sunset = { RampKind::Sunset, MIDNIGHT_MS, 20 * MINUTE_MS };
+        CHECK(sunrise.colorAt(MIDNIGHT_MS) == sunriseColor(0));
+        CHECK(sunrise.colorAt(MIDNIGHT_MS + 20 * MINUTE_MS) == sunriseColor(65535));
+        CHECK(sunset.colorAt(MIDNIGHT_MS) == sunriseColor(65535));
+        CHECK(sunset.colorAt(MIDNIGHT_MS + 20 * MINUTE_MS) == sunriseColor(0));
+    }
+
+    // Follows nextChangeMs() from before the start to the end, checking
+    // that each step is the first instant the color differs and that the
+    // channels only move one way. Returns the number of steps.
+    int walk(const LightRamp& ramp, int direction) {
+        int64_t now = ramp.startMs - MINUTE_MS;
+        int64_t endMs = ramp.startMs + (int64_t)ramp.durationMs;
+        int steps = 0;
+        for (;;) {
+            int64_t next = ramp.nextChangeMs(now);
+            if (next < 0) break;
+            CRGB before = ramp.colorAt(now);
+            CRGB after = ramp.colorAt(next);
+            if (!CHECK(next > now && next <= endMs)) break;
+            CHECK(ramp.colorAt(next - 1) == before);
+            CHECK(after != before);
+            for (int c = 0; c < 3; c++) {
+                CHECK((after[c] - before[c]) * direction >= 0);
+            }
+            now = next;
+            steps++;
+        }
+        CHECK(ramp.colorAt(now) == ramp.colorAt(endMs));
+        CHECK_EQ(ramp.nextChangeMs(endMs), -1);
+        return steps;
+    }
+
+    void testNextChangeAcrossMidnight() {
+        // 23:45 -> 00:15 and 23:50 -> 00:10
+        LightRamp sunrise = { RampKind::Sunrise, MIDNIGHT_MS - 15 * MINUTE_MS, 30 * MINUTE_MS };
+        LightRamp sunset = { RampKind::Sunset, MIDNIGHT_MS - 10 * MINUTE_MS, 20 * MINUTE_MS };
+
+        int sunriseSteps = walk(sunrise, 1);
+        int sunsetSteps = walk(sunset, -1);
+        // One step per 8-bit change: green 0 -> 169 alone is 169 of them,
+        // so nothing repeats and nothing is skipped in between
+        CHECK(sunriseSteps >= 169 && sunriseSteps <= 169 + 87);
+        CHECK(sunsetSteps >= 169 && sunsetSteps <= 169 + 87);
+
+        // Midnight is just another instant on the curve
+        CHECK_EQ(sunrise.phaseAt(MIDNIGHT_MS), 32768);
+        CHECK(sunrise.activeAt(MIDNIGHT_MS));
+        int64_t afterMidnight = sunrise.nextChangeMs(MIDNIGHT_MS - 1);
+        CHECK(afterMidnight >= MIDNIGHT_MS);
+        CHECK(sunrise.colorAt(afterMidnight) != sunrise.colorAt(MIDNIGHT_MS - 1));
+    }
+}
+
+void testLightRamp() {
+    testPhaseEdges();
+    testEndpoints();
+    testNextChangeAcrossMidnight();
+}
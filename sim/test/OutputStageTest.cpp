@@ -0,0 +1,75 @@
+// OutputStageTest.cpp
+#include "Test.h"
+#include <string.h>
+#include "LEDController/ColorParser.h"
+#include "LEDController/OutputStage.h"
+
+namespace {
+    CRGB wire(const char* name) {
+        CRGB scene;
+        if (!CHECK(parseColor(name, strlen(name), scene))) return CRGB::Black;
+        OutputStage stage;
+        CRGB out;
+        stage.render(&scene, &out, 1, 0);
+        return out;
+    }
+
+    // What named colors put on the wire at full brightness with the
+    // default white balance. Green is FastLED's half-scale 0x008000, which
+    // the gamma stage turns into 22% light: 0x27 on the wire, where the old
+    // linear output sent 0x58. Gains of 176 and 240 come out one step high
+    // because the 16-bit value is rounded in 256ths. Changing any of these
+    // is a visible change for every user.
+    void testNamedColorsOnTheWire() {
+        CRGB green = wire("green");
+        CHECK_EQ(green.r, 0);
+        CHECK_EQ(green.g, 0x27);
+        CHECK_EQ(green.b, 0);
+
+        CRGB red = wire("red");
+        CHECK_EQ(red.r, 0xFF);
+        CHECK_EQ(red.g, 0);
+        CHECK_EQ(red.b, 0);
+
+        CRGB blue = wire("blue");
+        CHECK_EQ(blue.r, 0);
+        CHECK_EQ(blue.g, 0);
+        CHECK_EQ(blue.b, 0xF1);
+
+        CRGB white = wire("white");
+        CHECK_EQ(white.r, 0xFF);
+        CHECK_EQ(white.g, 0xB1);
+        CHECK_EQ(white.b, 0xF1);
+
+        CRGB off = wire("off");
+        CHECK(!off);
+    }
+
+    // A dim-band value is on its upper step for its share of one cycle
+    void testDitherCycle() {
+        OutputStage stage;
+        CRGB scene(0, 0, 64); // 11.5 steps on the wire
+        uint32_t sum = 0;
+        for (uint8_t phase = 0; phase < LED_DITHER_FRAMES; phase++) {
+            CRGB out;
+            CHECK(stage.render(&scene, &out, 1, phase));
+            CHECK(out.b == 11 || out.b == 12);
+            sum += out.b;
+        }
+        // Two frames in four on 12
+        CHECK_EQ(sum, 4 * 11 + 2);
+
+        // Off: the same value rounded, every frame
+        stage.setDithering(false);
+        for (uint8_t phase = 0; phase < LED_DITHER_FRAMES; phase++) {
+            CRGB out;
+            CHECK(!stage.render(&scene, &out, 1, phase));
+            CHECK_EQ(out.b, 12);
+        }
+    }
+}
+
+void testOutputStage() {
+    testNamedColorsOnTheWire();
+    testDitherCycle();
+}
@@ -0,0 +1,166 @@
+// ScheduleTableTest.cpp
+#include "Test.h"
+#include "ScheduleManager/ScheduleTable.h"
+
+namespace {
+    const uint16_t DAY = ScheduleTable::MINUTES_PER_DAY;
+    const uint16_t NONE = ScheduleTable::NO_TRANSITION;
+
+    uint16_t at(uint16_t hours, uint16_t minutes) {
+        return hours * 60 + minutes;
+    }
+
+    // Minute by minute, for checking the word scans against
+    uint16_t slowNext(const ScheduleTable& table, uint16_t minute) {
+        for (uint16_t step = 1; step < DAY; step++) {
+            uint16_t m = (minute + step) % DAY;
+            if (table.isGreen(m) != table.isGreen(minute)) return m;
+        }
+        return NONE;
+    }
+
+    uint16_t slowPrevious(const ScheduleTable& table, uint16_t minute) {
+        for (uint16_t step = 1; step < DAY; step++) {
+            uint16_t m = (minute + DAY - step) % DAY;
+            if (table.isGreen(m) != table.isGreen(minute)) return (m + 1) % DAY;
+        }
+        return NONE;
+    }
+
+    void testEdges() {
+        ScheduleTable table;
+        CHECK(table.compile("07:30-08:00"));
+        CHECK(!table.isEmpty());
+        // Start is inclusive, end exclusive
+        CHECK(!table.isGreen(at(7, 29)));
+        CHECK(table.isGreen(at(7, 30)));
+        CHECK(table.isGreen(at(7, 59)));
+        CHECK(!table.isGreen(at(8, 0)));
+        CHECK(!table.isGreen(DAY));
+
+        // Windows on either side of a 32-minute word boundary
+        CHECK(table.compile("00:31-00:33,01:03-01:04"));
+        CHECK(!table.isGreen(30));
+        CHECK(table.isGreen(31));
+        CHECK(table.isGreen(32));
+        CHECK(!table.isGreen(33));
+        CHECK(table.isGreen(63));
+        CHECK(!table.isGreen(64));
+
+        // Same start and end is an empty window, not the whole day
+        CHECK(table.compile("07:30-07:30"));
+        CHECK(table.isEmpty());
+    }
+
+    void testMidnight() {
+        ScheduleTable table;
+        CHECK(table.compile("22:00-06:00"));
+        CHECK(!table.isGreen(at(21, 59)));
+        CHECK(table.isGreen(at(22, 0)));
+        CHECK(table.isGreen(at(23, 59)));
+        CHECK(table.isGreen(0));
+        CHECK(table.isGreen(at(5, 59)));
+        CHECK(!table.isGreen(at(6, 0)));
+
+        CHECK(table.compile("23:59-00:00"));
+        CHECK(table.isGreen(at(23, 59)));
+        CHECK(!table.isGreen(0));
+        CHECK(!table.isGreen(at(23, 58)));
+    }
+
+    void testMalformed() {
+        ScheduleTable table;
+        CHECK(table.compile(nullptr));
+        CHECK(table.isEmpty());
+        CHECK(table.compile(""));
+        CHECK(table.isEmpty());
+        // Blank entries and surrounding spaces are fine
+        CHECK(table.compile(" 07:30-08:00 ,, 19:00-19:05"));
+        CHECK(table.isGreen(at(7, 30)));
+        CHECK(table.isGreen(at(19, 4)));
+
+        // Each bad entry is skipped; the good ones are kept
+        const char* const BAD[] = {
+            "24:00-08:00", "07:60-08:00", "7:30-8:00", "07:30-08:00-09:00",
+            "07:30 08:00", "07:3a-08:00", "07:30-", "green",
+        };
+        for (const char* bad : BAD) {
+            char windows[64];
+            snprintf(windows, sizeof(windows), "%s,12:00-12:30", bad);
+            if (!CHECK(!table.compile(windows))) printf("    accepted \"%s\"\n", bad);
+            CHECK(table.isGreen(at(12, 0)));
+            CHECK_EQ(table.nextTransition(0), at(12, 0));
+        }
+
+        uint16_t minute;
+        CHECK(ScheduleTable::parseTime("23:59", minute));
+        CHECK_EQ(minute, at(23, 59));
+        CHECK(!ScheduleTable::parseTime("23:5", minute));
+    }
+
+    void testTransitions() {
+        ScheduleTable table;
+        CHECK_EQ(table.nextTransition(0), NONE);
+        CHECK_EQ(table.previousTransition(0), NONE);
+
+        CHECK(table.compile("07:30-08:00"));
+        CHECK_EQ(table.nextTransition(0), at(7, 30));
+        CHECK_EQ(table.nextTransition(at(7, 30)), at(8, 0));
+        CHECK_EQ(table.nextTransition(at(7, 59)), at(8, 0));
+        // Past the last edge of the day: tomorrow's first one
+        CHECK_EQ(table.nextTransition(at(8, 0)), at(7, 30));
+        CHECK_EQ(table.nextTransition(at(23, 59)), at(7, 30));
+        CHECK_EQ(table.nextTransition(DAY), NONE);
+
+        CHECK_EQ(table.previousTransition(at(7, 30)), at(7, 30));
+        CHECK_EQ(table.previousTransition(at(7, 59)), at(7, 30));
+        CHECK_EQ(table.previousTransition(at(8, 0)), at(8, 0));
+        // Before the first edge of the day: yesterday's last one
+        CHECK_EQ(table.previousTransition(0), at(8, 0));
+        CHECK_EQ(table.previousTransition(at(7, 29)), at(8, 0));
+        CHECK_EQ(table.previousTransition(DAY), NONE);
+
+        CHECK(table.compile("22:00-06:00"));
+        CHECK_EQ(table.nextTransition(at(23, 0)), at(6, 0));
+        CHECK_EQ(table.previousTransition(0), at(22, 0));
+        CHECK_EQ(table.previousTransition(at(6, 0)), at(6, 0));
+
+        // Green all day has no transitions
+        table.clear();
+        table.addWindow(0, at(23, 59));
+        table.addWindow(at(23, 59), 0);
+        CHECK(table.isGreen(at(23, 59)));
+        CHECK_EQ(table.nextTransition(at(12, 0)), NONE);
+        CHECK_EQ(table.previousTransition(at(12, 0)), NONE);
+    }
+
+    // Every minute of a few awkward schedules against the slow scans
+    void testTransitionsExhaustive() {
+        const char* const SCHEDULES[] = {
+            "07:30-08:00,19:00-19:05",
+            "22:00-06:00",
+            "00:00-00:01",
+            "23:59-00:00",
+            "00:31-00:32,00:32-00:33,01:03-01:04,12:00-12:01",
+            "06:00-06:32,06:33-07:04,07:05-23:58",
+        };
+        ScheduleTable table;
+        for (const char* schedule : SCHEDULES) {
+            CHECK(table.compile(schedule));
+            int mismatches = 0;
+            for (uint16_t minute = 0; minute < DAY; minute++) {
+                if (table.nextTransition(minute) != slowNext(table, minute)) mismatches++;
+                if (table.previousTransition(minute) != slowPrevious(table, minute)) mismatches++;
+            }
+            if (!CHECK_EQ(mismatches, 0)) printf("    schedule \"%s\"\n", schedule);
+        }
+    }
+}
+
+void testScheduleTable() {
+    testEdges();
+    testMidnight();
+    testMalformed();
+    testTransitions();
+    testTransitionsExhaustive();
+}
@@ -0,0 +1,38 @@
+// TelemetryTest.cpp
+#include "Test.h"
+#include <string.h>
+#include "Telemetry/Telemetry.h"
+
+void testTelemetry() {
+    // Every field at its widest must still fit the buffer
+    TelemetrySample widest;
+    widest.uptimeS = UINT32_MAX;
+    widest.freeHeap = UINT32_MAX;
+    widest.minFreeHeap = UINT32_MAX;
+    widest.largestBlock = UINT32_MAX;
+    widest.loops = UINT32_MAX;
+    widest.loopP50Us = UINT32_MAX;
+    widest.loopP90Us = UINT32_MAX;
+    widest.loopP99Us = UINT32_MAX;
+    widest.loopMaxUs = UINT32_MAX;
+    widest.rssi = INT8_MIN;
+    widest.mqttReconnects = UINT32_MAX;
+    widest.mqttFailures = UINT32_MAX;
+    for (size_t i = 0; i < (size_t)BootPhase::Count; i++) widest.bootMs[i] = INT32_MIN;
+
+    char buffer[TELEMETRY_PAYLOAD_SIZE];
+    size_t length = Telemetry::format(widest, buffer, sizeof(buffer));
+    CHECK_EQ(length, TELEMETRY_PAYLOAD_SIZE - 1);
+    CHECK_EQ(strlen(buffer), length);
+    CHECK(buffer[length - 1] == '}');
+
+    // One byte less and the payload is refused rather than cut short
+    CHECK_EQ(Telemetry::format(widest, buffer, sizeof(buffer) - 1), 0);
+
+    TelemetrySample idle;
+    memset(&idle, 0, sizeof(idle));
+    for (size_t i = 0; i < (size_t)BootPhase::Count; i++) idle.bootMs[i] = -1;
+    length = Telemetry::format(idle, buffer, sizeof(buffer));
+    CHECK(length > 0);
+    CHECK(strncmp(buffer, "{\"up\":0,", 8) == 0);
+}
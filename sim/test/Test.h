@@ -0,0 +1,46 @@
+// Test.h
+// Tiny host unit-test harness: CHECKs count failures and print where they
+// happened; the test binary exits non-zero if any failed.
+#ifndef SIM_TEST_H
+#define SIM_TEST_H
+
+#include <stdio.h>
+
+namespace Test {
+    extern int checks;
+    extern int failures;
+
+    inline bool check(bool ok, const char* file, int line, const char* expression) {
+        checks++;
+        if (!ok) {
+            failures++;
+            printf("%s:%d: CHECK(%s) failed\n", file, line, expression);
+        }
+        return ok;
+    }
+
+    inline bool checkEqual(long actual, long expected, const char* file, int line, const char* expression) {
+        checks++;
+        if (actual != expected) {
+            failures++;
+            printf("%s:%d: CHECK_EQ(%s) failed: %ld, expected %ld\n", file, line, expression, actual, expected);
+        }
+        return actual == expected;
+    }
+}
+
+#define CHECK(expression) Test::check((expression), __FILE__, __LINE__, #expression)
+#define CHECK_EQ(actual, expected) \
+    Test::checkEqual((long)(actual), (long)(expected), __FILE__, __LINE__, #actual ", " #expected)
+
+// One per test file, called from TestMain.cpp
+void testScheduleTable();
+void testSettingsStore();
+void testTelemetry();
+void testOutputStage();
+void testColorParser();
+void testCommandBatch();
+void testCommandRing();
+void testLightRamp();
+
+#endif // SIM_TEST_H
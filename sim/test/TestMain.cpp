@@ -0,0 +1,20 @@
+// TestMain.cpp
+// Host unit tests for firmware modules that do not need the simulated
+// device. Run by ctest as otwu_unit.
+#include "Test.h"
+
+int Test::checks = 0;
+int Test::failures = 0;
+
+int main() {
+    testScheduleTable();
+    testSettingsStore();
+    testTelemetry();
+    testOutputStage();
+    testColorParser();
+    testCommandBatch();
+    testCommandRing();
+    testLightRamp();
+    printf("%d checks, %d failed\n", Test::checks, Test::failures);
+    return Test::failures ? 1 : 0;
+}
@@ -1,169 +1,22 @@
 #include "CaptivePortalManager.h"
-
-CaptivePortalManager::CaptivePortalManager(const char *ssid, const IPAddress &localIP, const IPAddress &gatewayIP, const String &redirectURL)
-    : server(80), ssid(ssid), localIP(localIP), gatewayIP(gatewayIP), subnetMask(255, 255, 255, 0), redirectURL(redirectURL)
-{
-    connectedMode = false;
-}
-
-void CaptivePortalManager::start()
-{
-    Serial.println("🚀 Starting Captive Portal...");
-
-    WiFi.disconnect(true);
-    delay(100);
-
-    Serial.println("🔍 Scanning for WiFi networks...");
-    int numNetworks = WiFi.scanNetworks();
-
-    WiFi.mode(WIFI_AP_STA);
-    WiFi.softAPConfig(localIP, gatewayIP, subnetMask);
-    WiFi.softAP(ssid);
-
-    dnsServer.setTTL(3600);
-    dnsServer.start(53, "*", localIP);
-
-    connectedMode = (WiFi.status() == WL_CONNECTED);
-
-    // ROOT PAGE
-    server.on("/", HTTP_GET, [this, numNetworks](AsyncWebServerRequest *request) {
-        if (connectedMode) {
-            String html = "<html><body><h1>You're connected!</h1></body></html>";
-            request->send(200, "text/html", html);
-        } else {
-            String html = generateWiFiSetupPage(numNetworks);
-            request->send(200, "text/html", html);
-        }
-    });
-
-    // SAVE WiFi CREDENTIALS
-    server.on("/save", HTTP_POST, [this](AsyncWebServerRequest *request) {
-        if (request->hasParam("ssid", true) && request->hasParam("password", true)) {
-            String ssid = request->getParam("ssid", true)->value();
-            String password = request->getParam("password", true)->value();
-            saveWiFiCredentials(ssid, password);
-            request->send(200, "text/plain", "✅ WiFi credentials saved! Restarting...");
-            delay(2000);
-            ESP.restart();
-        } else {
-            request->send(400, "text/plain", "❌ Missing SSID or Password");
-        }
-    });
-
-    // CAPTIVE PORTAL DETECTION ROUTES
-    server.on("/generate_204", [](AsyncWebServerRequest *request) {
-        request->redirect("http://4.3.2.1");
-      });
-      
-
-    server.on("/hotspot-detect.html", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send(200, "text/html", "OK");
-    });
-
-    server.on("/ncsi.txt", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send(200, "text/plain", "Microsoft NCSI");
-    });
-
-    server.on("/connecttest.txt", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send(200, "text/plain", "Success");
-    });
-
-    server.on("/success.txt", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send(200, "text/plain", "Success");
-    });
-
-    server.on("/captiveportal", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->redirect("/");
-    });
-
-    // CATCH-ALL: FORCE REDIRECT
-    server.onNotFound([](AsyncWebServerRequest *request) {
-        request->redirect("http://4.3.2.1");
-        Serial.print("onnotfound ");
-        Serial.print(request->host());
-        Serial.print(" ");
-        Serial.print(request->url());
-        Serial.println(" sent redirect to http://4.3.2.1");
-      });
-      
-
-    server.begin();
-    Serial.println("✅ Captive Portal Started at 192.168.4.1");
-}
-
-void CaptivePortalManager::processDNSRequests()
-{
-    dnsServer.processNextRequest();
-}
-
-void CaptivePortalManager::saveWiFiCredentials(const String &ssid, const String &password)
-{
-    preferences.begin("wifi", false);
-    preferences.putString("ssid", ssid);
-    preferences.putString("password", password);
-    preferences.end();
-}
-
-bool CaptivePortalManager::loadWiFiCredentials(String &ssid, String &password)
-{
-    preferences.begin("wifi", true);
-    ssid = preferences.getString("ssid", "");
-    password = preferences.getString("password", "");
-    preferences.end();
-    return !ssid.isEmpty();
-}
-
-bool CaptivePortalManager::connectToWiFi()
-{
-    WiFi.mode(WIFI_STA);
-    String ssid, password;
-
-    if (loadWiFiCredentials(ssid, password)) {
-        Serial.printf("📶 Trying to connect to WiFi: %s\n", ssid.c_str());
-        WiFi.begin(ssid.c_str(), password.c_str());
-
-        unsigned long startTime = millis();
-        while (WiFi.status() != WL_CONNECTED && millis() - startTime < 15000) {
-            delay(500);
-            Serial.print(".");
-        }
-
-        if (WiFi.status() == WL_CONNECTED) {
-            Serial.println("\n✅ Connected to WiFi!");
-            Serial.print("📡 IP Address: ");
-            Serial.println(WiFi.localIP());
-            return true;
-        } else {
-            Serial.println("\n❌ Failed to connect within timeout.");
-        }
-    } else {
-        Serial.println("⚠️ No saved WiFi credentials found.");
-    }
-
-    Serial.println("🔄 Switching to AP mode and starting Captive Portal...");
-    WiFi.disconnect(true);
-    delay(100);
-    WiFi.mode(WIFI_AP_STA);
-    start();
-    return false;
-}
-
-String CaptivePortalManager::generateWiFiSetupPage(int numNetworks) {
-    // Build networks JSON
-    String networksJson = "[";
-    if (numNetworks > 0) {
-        for (int i = 0; i < numNetworks; i++) {
-            if (i > 0) networksJson += ",";
-            networksJson += "{";
-            networksJson += "\"ssid\":\"" + WiFi.SSID(i) + "\",";
-            networksJson += "\"rssi\":" + String(WiFi.RSSI(i)) + ",";
-            networksJson += "\"open\":" + String(WiFi.encryptionType(i) == WIFI_AUTH_OPEN ? "true" : "false");
-            networksJson += "}";
-        }
-    }
-    networksJson += "]";
-
-    String html = R"rawliteral(
+#include "SettingsStore/SettingsStore.h"
+#include "config.h"
+
+// Background scan refresh while the portal is up
+#define SCAN_INTERVAL_MS 30000
+
+// Last successful join, for the fast path (SettingsStore, next to the
+// credentials)
+#define PREF_WIFI_NAMESPACE "wifi"
+#define PREF_KEY_BSSID_HIGH "bssidHi"   // first two bytes
+#define PREF_KEY_BSSID_LOW "bssidLo"    // last four
+#define PREF_KEY_CHANNEL "channel"      // 0 = nothing cached
+#define PREF_KEY_IP "ip"
+#define PREF_KEY_GATEWAY "gateway"
+#define PREF_KEY_SUBNET "subnet"
+#define PREF_KEY_DNS "dns"
+
+static const char WIFI_SETUP_HTML[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html lang="en">
 <head>
@@ -329,9 +182,6 @@ footer{text-align:center;color:var(--muted-fg);font-size:13px;padding:18px 0 6px
 </div>
 
 <script>
-// Server injects networks JSON here:
-const INJECTED_NETWORKS = ')rawliteral" + networksJson + R"rawliteral(';
-
 const $ = (id) => document.getElementById(id);
 const listEl = $('list'), searchEl = $('search'), ssidEl = $('ssid'), passEl = $('password');
 const showPassEl = $('showPass'), refreshEl = $('refresh'), connectEl = $('connect');
@@ -350,23 +200,19 @@ document.addEventListener('DOMContentLoaded', async () => {
 });
 
 async function loadInitial(){
-  const injected = parseInjected(INJECTED_NETWORKS);
-  if (injected.length) {
-    networks = normalize(injected);
-    renderList(networks);
-  } else {
-    await scanNetworks();
-  }
+  await loadNetworks(false);
 }
 
-function parseInjected(str){
+async function loadNetworks(refresh){
   try {
-    if (!str || str === 'REPLACE_WIFI_NETWORKS_JSON') return [];
-    const data = JSON.parse(str);
-    return Array.isArray(data) ? data : [];
-  } catch {
-    return [];
+    const res = await fetch('/networks.json' + (refresh ? '?refresh=1' : ''));
+    const data = res.ok ? await res.json() : [];
+    networks = normalize(Array.isArray(data) ? data : []);
+  } catch (e) {
+    console.error('Network list error:', e);
+    networks = [];
   }
+  renderList(filterNetworks(searchEl.value));
 }
 
 function normalize(arr){
@@ -436,14 +282,12 @@ function renderList(items){
 async function scanNetworks(){
   setLoading(refreshEl, true, 'Scanning…');
   listEl.innerHTML = '<div class="skeleton"></div><div class="skeleton"></div><div class="skeleton"></div>';
-  
-  // Try to rescan - reload the page to get fresh scan
-  try {
-    window.location.reload();
-  } catch(e) {
-    console.error('Scan error:', e);
-    setLoading(refreshEl, false, 'Refresh');
-  }
+
+  // Ask the device for a fresh background scan, then pick up its results
+  await loadNetworks(true);
+  await new Promise(r => setTimeout(r, 4000));
+  await loadNetworks(false);
+  setLoading(refreshEl, false, 'Refresh');
 }
 
 function setLoading(btn, loading, textWhenLoading){
@@ -534,7 +378,300 @@ function escapeHtml(s){
 </script>
 </body>
 </html>
-    )rawliteral";
+)rawliteral";
+
+CaptivePortalManager::CaptivePortalManager(const char *ssid, const IPAddress &localIP, const IPAddress &gatewayIP, const String &redirectURL)
+    : server(80), ssid(ssid), localIP(localIP), gatewayIP(gatewayIP), subnetMask(255, 255, 255, 0), redirectURL(redirectURL)
+{
+    connectedMode = false;
+    portalActive = false;
+    routesAdded = false;
+    scanRunning = false;
+    scanRequested = false;
+    lastScanDone = 0;
+    networkCount = 0;
+    scanGeneration = 0;
+}
+
+void CaptivePortalManager::start()
+{
+    Serial.println("🚀 Starting Captive Portal...");
+
+    WiFi.disconnect(true);
+    delay(100);
+
+    WiFi.mode(WIFI_AP_STA);
+    WiFi.softAPConfig(localIP, gatewayIP, subnetMask);
+    WiFi.softAP(ssid);
+
+    dnsServer.setTTL(3600);
+    dnsServer.start(53, "*", localIP);
+
+    connectedMode = (WiFi.status() == WL_CONNECTED);
+
+    addRoutes();
+    server.begin();
+    Serial.println("✅ Captive Portal Started at 192.168.4.1");
+
+    portalActive = true;
+    startScan();
+}
+
+void CaptivePortalManager::stop()
+{
+    if (!portalActive) return;
+    server.end();
+    dnsServer.stop();
+    WiFi.softAPdisconnect(true);
+    WiFi.mode(WIFI_STA);
+    portalActive = false;
+    scanRunning = false;
+    Serial.println("✅ Captive Portal closed");
+}
+
+void CaptivePortalManager::addRoutes()
+{
+    // The server keeps its handlers across end()/begin()
+    if (routesAdded) return;
+    routesAdded = true;
+
+    // ROOT PAGE
+    server.on("/", HTTP_GET, [this](AsyncWebServerRequest *request) {
+        if (connectedMode) {
+            String html = "<html><body><h1>You're connected!</h1></body></html>";
+            request->send(200, "text/html", html);
+        } else {
+            request->send_P(200, "text/html", WIFI_SETUP_HTML);
+        }
+    });
+
+    // SCAN RESULTS (served from the background scan cache)
+    server.on("/networks.json", HTTP_GET, [this](AsyncWebServerRequest *request) {
+        sendNetworks(request);
+    });
+
+    // SAVE WiFi CREDENTIALS
+    server.on("/save", HTTP_POST, [this](AsyncWebServerRequest *request) {
+        if (request->hasParam("ssid", true) && request->hasParam("password", true)) {
+            String ssid = request->getParam("ssid", true)->value();
+            String password = request->getParam("password", true)->value();
+            saveWiFiCredentials(ssid, password);
+            request->send(200, "text/plain", "✅ WiFi credentials saved! Restarting...");
+            SettingsStore::flush();
+            delay(2000);
+            ESP.restart();
+        } else {
+            request->send(400, "text/plain", "❌ Missing SSID or Password");
+        }
+    });
+
+    // CAPTIVE PORTAL DETECTION ROUTES
+    server.on("/generate_204", [](AsyncWebServerRequest *request) {
+        request->redirect("http://4.3.2.1");
+      });
+      
+
+    server.on("/hotspot-detect.html", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "text/html", "OK");
+    });
+
+    server.on("/ncsi.txt", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "text/plain", "Microsoft NCSI");
+    });
+
+    server.on("/connecttest.txt", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "text/plain", "Success");
+    });
+
+    server.on("/success.txt", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "text/plain", "Success");
+    });
+
+    server.on("/captiveportal", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->redirect("/");
+    });
+
+    // CATCH-ALL: FORCE REDIRECT
+    server.onNotFound([](AsyncWebServerRequest *request) {
+        request->redirect("http://4.3.2.1");
+        Serial.print("onnotfound ");
+        Serial.print(request->host());
+        Serial.print(" ");
+        Serial.print(request->url());
+        Serial.println(" sent redirect to http://4.3.2.1");
+      });
+}
+
+void CaptivePortalManager::processDNSRequests()
+{
+    dnsServer.processNextRequest();
+    if (portalActive) updateScan();
+}
 
-    return html;
+void CaptivePortalManager::startScan()
+{
+    Serial.println("🔍 Scanning for WiFi networks...");
+    WiFi.scanNetworks(true);
+    scanRunning = true;
+    scanRequested = false;
+}
+
+void CaptivePortalManager::updateScan()
+{
+    if (!scanRunning) {
+        if (scanRequested || millis() - lastScanDone >= SCAN_INTERVAL_MS) {
+            startScan();
+        }
+        return;
+    }
+
+    int16_t found = WiFi.scanComplete();
+    if (found == WIFI_SCAN_RUNNING) return;
+
+    scanRunning = false;
+    lastScanDone = millis();
+    if (found < 0) return; // failed, keep the previous results
+
+    // Build the new list outside the lock: de-duplicated by SSID (strongest
+    // BSSID wins), sorted by RSSI, capped at MAX_NETWORKS
+    ScannedNetwork fresh[MAX_NETWORKS];
+    uint8_t count = 0;
+    for (int16_t i = 0; i < found; i++) {
+        String ssid = WiFi.SSID(i);
+        if (ssid.isEmpty()) continue;
+        int8_t rssi = (int8_t)WiFi.RSSI(i);
+
+        int8_t existing = -1;
+        for (uint8_t j = 0; j < count; j++) {
+            if (strcmp(fresh[j].ssid, ssid.c_str()) == 0) { existing = j; break; }
+        }
+        if (existing >= 0) {
+            if (rssi <= fresh[existing].rssi) continue;
+            // Drop the weaker duplicate; it is re-inserted below
+            for (uint8_t j = existing; j + 1 < count; j++) fresh[j] = fresh[j + 1];
+            count--;
+        }
+
+        uint8_t pos = count;
+        while (pos > 0 && fresh[pos - 1].rssi < rssi) pos--;
+        if (pos >= MAX_NETWORKS) continue;
+        if (count == MAX_NETWORKS) count--;
+        for (uint8_t j = count; j > pos; j--) fresh[j] = fresh[j - 1];
+
+        strlcpy(fresh[pos].ssid, ssid.c_str(), sizeof(fresh[pos].ssid));
+        fresh[pos].rssi = rssi;
+        fresh[pos].open = WiFi.encryptionType(i) == WIFI_AUTH_OPEN;
+        count++;
+    }
+    WiFi.scanDelete();
+
+    std::lock_guard<std::mutex> lock(networksMutex);
+    memcpy(networks, fresh, sizeof(ScannedNetwork) * count);
+    networkCount = count;
+    scanGeneration++;
+}
+
+void CaptivePortalManager::sendNetworks(AsyncWebServerRequest *request)
+{
+    if (request->hasParam("refresh")) {
+        scanRequested = true;
+    }
+
+    std::lock_guard<std::mutex> lock(networksMutex);
+    char etag[24];
+    snprintf(etag, sizeof(etag), "\"scan-%lu\"", (unsigned long)scanGeneration);
+
+    AsyncWebHeader *ifNoneMatch = request->getHeader("If-None-Match");
+    if (ifNoneMatch && ifNoneMatch->value() == etag) {
+        request->send(304);
+        return;
+    }
+
+    AsyncResponseStream *response = request->beginResponseStream("application/json", 64 + networkCount * 64);
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    response->print("[");
+    for (uint8_t i = 0; i < networkCount; i++) {
+        const ScannedNetwork &n = networks[i];
+        response->print(i ? ",{\"ssid\":\"" : "{\"ssid\":\"");
+        for (const char *p = n.ssid; *p; p++) {
+            if (*p == '"' || *p == '\\') response->write('\\');
+            if ((uint8_t)*p >= 0x20) response->write(*p);
+        }
+        response->printf("\",\"rssi\":%d,\"open\":%s}", n.rssi, n.open ? "true" : "false");
+    }
+    response->print("]");
+    request->send(response);
+}
+
+void CaptivePortalManager::saveWiFiCredentials(const String &ssid, const String &password)
+{
+    preferences.begin("wifi", false);
+    preferences.putString("ssid", ssid);
+    preferences.putString("password", password);
+    preferences.end();
+    // Another network: the next join has to scan for it
+    SettingsStore::putUChar(PREF_WIFI_NAMESPACE, PREF_KEY_CHANNEL, 0);
+}
+
+bool CaptivePortalManager::loadWiFiCredentials(String &ssid, String &password)
+{
+    preferences.begin("wifi", true);
+    ssid = preferences.getString("ssid", "");
+    password = preferences.getString("password", "");
+    preferences.end();
+    return !ssid.isEmpty();
+}
+
+WiFiJoin CaptivePortalManager::beginConnect(bool fast)
+{
+    String ssid, password;
+    if (!loadWiFiCredentials(ssid, password)) {
+        Serial.println("⚠️ No saved WiFi credentials found.");
+        return WiFiJoin::NoCredentials;
+    }
+
+    WiFi.mode(portalActive ? WIFI_AP_STA : WIFI_STA);
+    uint8_t channel = SettingsStore::getUChar(PREF_WIFI_NAMESPACE, PREF_KEY_CHANNEL, 0);
+    if (fast && channel) {
+        uint32_t bssidHigh = SettingsStore::getUInt(PREF_WIFI_NAMESPACE, PREF_KEY_BSSID_HIGH, 0);
+        uint32_t bssidLow = SettingsStore::getUInt(PREF_WIFI_NAMESPACE, PREF_KEY_BSSID_LOW, 0);
+        uint8_t bssid[6] = { (uint8_t)(bssidHigh >> 8), (uint8_t)bssidHigh, (uint8_t)(bssidLow >> 24),
+                             (uint8_t)(bssidLow >> 16), (uint8_t)(bssidLow >> 8), (uint8_t)bssidLow };
+#if WIFI_CACHE_IP
+        IPAddress ip(SettingsStore::getUInt(PREF_WIFI_NAMESPACE, PREF_KEY_IP, 0));
+        if ((uint32_t)ip) {
+            WiFi.config(ip, IPAddress(SettingsStore::getUInt(PREF_WIFI_NAMESPACE, PREF_KEY_GATEWAY, 0)),
+                        IPAddress(SettingsStore::getUInt(PREF_WIFI_NAMESPACE, PREF_KEY_SUBNET, 0)),
+                        IPAddress(SettingsStore::getUInt(PREF_WIFI_NAMESPACE, PREF_KEY_DNS, 0)));
+        }
+#endif
+        Serial.printf("📶 Reconnecting to WiFi: %s on channel %u\n", ssid.c_str(), channel);
+        WiFi.begin(ssid.c_str(), password.c_str(), channel, bssid);
+        return WiFiJoin::Fast;
+    }
+
+#if WIFI_CACHE_IP
+    // Back to DHCP in case a fast join set the address
+    WiFi.config(IPAddress(), IPAddress(), IPAddress());
+#endif
+    Serial.printf("📶 Trying to connect to WiFi: %s\n", ssid.c_str());
+    WiFi.begin(ssid.c_str(), password.c_str());
+    return WiFiJoin::Full;
+}
+
+void CaptivePortalManager::rememberConnection()
+{
+    const uint8_t* bssid = WiFi.BSSID();
+    if (!bssid) return;
+    SettingsStore::putUInt(PREF_WIFI_NAMESPACE, PREF_KEY_BSSID_HIGH, ((uint32_t)bssid[0] << 8) | bssid[1]);
+    SettingsStore::putUInt(PREF_WIFI_NAMESPACE, PREF_KEY_BSSID_LOW, ((uint32_t)bssid[2] << 24) |
+                           ((uint32_t)bssid[3] << 16) | ((uint32_t)bssid[4] << 8) | bssid[5]);
+    SettingsStore::putUChar(PREF_WIFI_NAMESPACE, PREF_KEY_CHANNEL, (uint8_t)WiFi.channel());
+#if WIFI_CACHE_IP
+    SettingsStore::putUInt(PREF_WIFI_NAMESPACE, PREF_KEY_IP, (uint32_t)WiFi.localIP());
+    SettingsStore::putUInt(PREF_WIFI_NAMESPACE, PREF_KEY_GATEWAY, (uint32_t)WiFi.gatewayIP());
+    SettingsStore::putUInt(PREF_WIFI_NAMESPACE, PREF_KEY_SUBNET, (uint32_t)WiFi.subnetMask());
+    SettingsStore::putUInt(PREF_WIFI_NAMESPACE, PREF_KEY_DNS, (uint32_t)WiFi.dnsIP());
+#endif
 }
@@ -5,10 +5,28 @@
 #include <DNSServer.h>
 #include <WiFi.h>
 #include <Preferences.h>
+#include <mutex>
+
+// How a station join was started
+enum class WiFiJoin
+{
+    NoCredentials,
+    Fast,   // straight to the stored BSSID and channel, no scan
+    Full    // scan for the SSID, then DHCP
+};
+
+struct ScannedNetwork
+{
+    char ssid[33];
+    int8_t rssi;
+    bool open;
+};
 
 class CaptivePortalManager
 {
 private:
+    static const uint8_t MAX_NETWORKS = 20;
+
     DNSServer dnsServer;
     AsyncWebServer server;
     Preferences preferences;
@@ -18,15 +36,38 @@ private:
     IPAddress subnetMask;
     String redirectURL;
     bool connectedMode;
+    bool portalActive;
+    bool routesAdded;
+
+    // Background scan cache, read by the web handlers
+    std::mutex networksMutex;
+    ScannedNetwork networks[MAX_NETWORKS];
+    uint8_t networkCount;
+    uint32_t scanGeneration;
+    bool scanRunning;
+    volatile bool scanRequested;
+    unsigned long lastScanDone;
 
+    void addRoutes();
     void saveWiFiCredentials(const String &ssid, const String &password);
     bool loadWiFiCredentials(String &ssid, String &password);
-    String generateWiFiSetupPage(int numNetworks);
+    void startScan();
+    void updateScan();
+    void sendNetworks(AsyncWebServerRequest *request);
 
 public:
     CaptivePortalManager(const char *ssid, const IPAddress &localIP, const IPAddress &gatewayIP, const String &redirectURL);
-    bool connectToWiFi(); 
-    void start();  
+    // Starts joining the saved network and returns at once; poll
+    // WiFi.status(). fast reuses the access point (and, with
+    // WIFI_CACHE_IP, the address) of the last successful join. With the
+    // portal up the join runs alongside it (AP+STA).
+    WiFiJoin beginConnect(bool fast);
+    // Keeps the current link's access point and address for the next fast join
+    void rememberConnection();
+    void start();
+    // Takes the access point, DNS and portal pages down again
+    void stop();
+    bool isActive() const { return portalActive; }
     void processDNSRequests();
 };
 
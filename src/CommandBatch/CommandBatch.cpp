@@ -0,0 +1,124 @@
+// CommandBatch.cpp
+#include "CommandBatch.h"
+#include <string.h>
+#include "LEDController/LEDCommand.h"
+#include "LEDController/TextParse.h"
+#include "ScheduleManager/ScheduleManager.h"
+#include "TaskScheduler/TaskScheduler.h"
+
+using namespace TextParse;
+
+namespace {
+    // "<key>:<value>" or "<key>=<value>"; key must be lower case.
+    // On a match value/valueLength are the trimmed value.
+    bool keyed(const char* data, size_t length, const char* key, const char*& value, size_t& valueLength) {
+        size_t keyLength = strlen(key);
+        if (length <= keyLength || (data[keyLength] != ':' && data[keyLength] != '=')) return false;
+        if (!matches(data, key, keyLength)) return false;
+        value = data + keyLength + 1;
+        valueLength = length - keyLength - 1;
+        trimLeft(value, valueLength);
+        return true;
+    }
+
+    bool parseMinutes(const char* data, size_t length, uint8_t& out) {
+        uint16_t value;
+        if (!parseDecimal(data, length, 255, value)) return false;
+        if (!ScheduleManager::isValidRampMinutes((uint8_t)value)) return false;
+        out = (uint8_t)value;
+        return true;
+    }
+
+    bool parseOperation(const char* data, size_t length, CommandBatch& out) {
+        const char* value;
+        size_t valueLength;
+        if (keyed(data, length, "schedule", value, valueLength)) {
+            if (valueLength >= BATCH_WINDOWS_SIZE) return false;
+            memcpy(out.windows, value, valueLength);
+            out.windows[valueLength] = '\0';
+            // Stricter than /setSchedule: a malformed window fails the batch
+            ScheduleTable table;
+            out.hasWindows = true;
+            return table.compile(out.windows);
+        }
+        if (keyed(data, length, "sunrise", value, valueLength)) {
+            out.hasSunrise = true;
+            return parseMinutes(value, valueLength, out.sunrise);
+        }
+        if (keyed(data, length, "sunset", value, valueLength)) {
+            out.hasSunset = true;
+            return parseMinutes(value, valueLength, out.sunset);
+        }
+
+        LEDCommand command;
+        if (!parseLEDCommand(data, length, command)) return false;
+        switch (command.type) {
+        case LEDCommand::Type::Color:
+            out.hasColor = true;
+            out.color = command.color;
+            out.colorOperation = out.operations;
+            break;
+        case LEDCommand::Type::Brightness:
+            out.hasBrightness = true;
+            out.brightness = command.brightness;
+            break;
+        case LEDCommand::Type::Mode:
+            out.hasMode = true;
+            out.autoMode = command.autoMode;
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+}
+
+bool parseCommandBatch(const char* data, size_t length, CommandBatch& out, uint8_t& failedOperation) {
+    memset(&out, 0, sizeof(out));
+    failedOperation = 0;
+    if (!data) return false;
+
+    size_t start = 0;
+    while (start <= length) {
+        size_t end = start;
+        while (end < length && data[end] != ';' && data[end] != '\n') end++;
+        const char* operation = data + start;
+        size_t operationLength = end - start;
+        trim(operation, operationLength);
+
+        if (operationLength > 0) {
+            if (out.operations < 0xFF) out.operations++;
+            if (!parseOperation(operation, operationLength, out)) {
+                failedOperation = out.operations;
+                return false;
+            }
+        }
+        start = end + 1;
+    }
+    return out.operations > 0;
+}
+
+uint8_t applyCommandBatch(const CommandBatch& batch, LEDController& led) {
+    bool rescheduled = false;
+    if (batch.hasWindows || batch.hasSunrise || batch.hasSunset) {
+        uint8_t sunrise, sunset;
+        ScheduleManager::getRampMinutes(sunrise, sunset);
+        uint32_t generation = ScheduleManager::getGeneration();
+        ScheduleManager::saveSchedule(batch.hasWindows ? String(batch.windows) : ScheduleManager::getGreenWindows(),
+                                      batch.hasSunrise ? batch.sunrise : sunrise,
+                                      batch.hasSunset ? batch.sunset : sunset);
+        rescheduled = ScheduleManager::getGeneration() != generation;
+    }
+
+    bool wasAuto = isScheduleAutoMode();
+    if (batch.hasMode) setScheduleAutoMode(batch.autoMode);
+    bool scheduleTakesOver = isScheduleAutoMode() && (rescheduled || !wasAuto);
+
+    LEDUpdate update = {};
+    update.hasColor = batch.hasColor && !scheduleTakesOver;
+    update.color = batch.color;
+    update.hasBrightness = batch.hasBrightness;
+    update.brightness = batch.brightness;
+    led.apply(update);
+    return batch.hasColor && scheduleTakesOver ? batch.colorOperation : 0;
+}
@@ -0,0 +1,47 @@
+// CommandBatch.h
+#ifndef COMMAND_BATCH_H
+#define COMMAND_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "LEDController/LEDController.h"
+
+// Longest schedule a batch can carry, "HH:MM-HH:MM," per window
+#define BATCH_WINDOWS_SIZE 192
+
+// The end state of a list of operations; later operations override
+// earlier ones and unset fields are left alone.
+struct CommandBatch {
+    bool hasColor;
+    CRGB color;
+    uint8_t colorOperation;   // 1-based position of the operation that set color
+    bool hasBrightness;
+    uint8_t brightness;   // percent 0-100
+    bool hasMode;
+    bool autoMode;
+    bool hasWindows;
+    char windows[BATCH_WINDOWS_SIZE];
+    bool hasSunrise;
+    uint8_t sunrise;      // minutes, see ScheduleManager::isValidRampMinutes
+    bool hasSunset;
+    uint8_t sunset;
+    uint8_t operations;   // non-empty operations parsed
+};
+
+// Operations are separated by ';' or newlines, blank ones are skipped:
+//   anything parseLEDCommand() accepts (a color, brightness:<n>, mode:<m>, ping)
+//   schedule:<HH:MM-HH:MM,...>   (empty clears the windows)
+//   sunrise:<minutes> | sunset:<minutes>   (0 = off, otherwise 10-60)
+// All or nothing: on false, failedOperation is the 1-based position of
+// the first invalid operation and nothing should be applied.
+bool parseCommandBatch(const char* data, size_t length, CommandBatch& out, uint8_t& failedOperation);
+
+// Applies a parsed batch as one change: one schedule write, one LED
+// update (a single frame and fade) and so one state publish. The schedule
+// re-applies its own color after a schedule change or on returning to
+// auto mode, so a color in such a batch is dropped rather than shown for
+// a moment. Returns the position of that dropped color operation, so the
+// caller can report it, or 0 if everything in the batch took effect.
+uint8_t applyCommandBatch(const CommandBatch& batch, LEDController& led);
+
+#endif // COMMAND_BATCH_H
@@ -0,0 +1,71 @@
+// ColorFade.cpp
+#include "ColorFade.h"
+#include "TextParse.h"
+
+using TextParse::matches;
+
+namespace {
+    inline uint8_t ease(LedEasing easing, uint8_t progress) {
+        switch (easing) {
+        case LedEasing::EaseIn:    return scale8(progress, progress);
+        case LedEasing::EaseOut:   return 255 - scale8(255 - progress, 255 - progress);
+        case LedEasing::EaseInOut: return ease8InOutCubic(progress);
+        default:                   return progress;
+        }
+    }
+}
+
+const char* ledEasingName(LedEasing easing) {
+    switch (easing) {
+    case LedEasing::EaseIn:    return "in";
+    case LedEasing::EaseOut:   return "out";
+    case LedEasing::EaseInOut: return "inout";
+    default:                   return "linear";
+    }
+}
+
+bool parseLedEasing(const char* data, size_t length, LedEasing& out) {
+    switch (length) {
+    case 2:
+        if (matches(data, "in", 2)) { out = LedEasing::EaseIn; return true; }
+        return false;
+    case 3:
+        if (matches(data, "out", 3)) { out = LedEasing::EaseOut; return true; }
+        return false;
+    case 5:
+        if (matches(data, "inout", 5)) { out = LedEasing::EaseInOut; return true; }
+        return false;
+    case 6:
+        if (matches(data, "linear", 6)) { out = LedEasing::Linear; return true; }
+        return false;
+    default:
+        return false;
+    }
+}
+
+ColorFade::ColorFade()
+    : _startMs(0), _from(CRGB::Black), _to(CRGB::Black), _easing(LedEasing::Linear), _active(false) {}
+
+void ColorFade::start(const CRGB& from, const CRGB& to, uint32_t nowMs, uint16_t durationMs, LedEasing easing) {
+    _from = from;
+    _to = to;
+    _easing = easing;
+    _startMs = nowMs;
+    _transition.start(0, durationMs);
+    _active = true;
+}
+
+CRGB ColorFade::step(uint32_t nowMs) {
+    if (!_active) return _to;
+
+    uint8_t progress = _transition.getProgress(nowMs - _startMs);
+    if (progress == 255) {
+        _active = false;
+        _transition.end();
+        return _to;
+    }
+
+    CRGB color = _from;
+    nblend(color, _to, ease(_easing, progress));
+    return color;
+}
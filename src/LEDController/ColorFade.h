@@ -0,0 +1,38 @@
+// ColorFade.h
+#ifndef COLOR_FADE_H
+#define COLOR_FADE_H
+
+#include <FastLED.h>
+#include "fx/detail/transition.h"
+
+enum class LedEasing : uint8_t { Linear, EaseIn, EaseOut, EaseInOut };
+
+const char* ledEasingName(LedEasing easing);
+// linear | in | out | inout (case-insensitive)
+bool parseLedEasing(const char* data, size_t length, LedEasing& out);
+
+// A time-based cross-fade between two colors. All per-frame math is 8-bit
+// fixed point (lib8tion easing + nblend); progress comes from FastLED's
+// fl::Transition, fed elapsed time so millis() wrap-around is harmless.
+class ColorFade {
+public:
+    ColorFade();
+
+    // Starts towards `to` from `from`, which should be the color currently
+    // on the strip so a retarget mid-fade continues without a jump
+    void start(const CRGB& from, const CRGB& to, uint32_t nowMs, uint16_t durationMs, LedEasing easing);
+    // Color for this frame; the fade ends once it reaches the target
+    CRGB step(uint32_t nowMs);
+    bool active() const { return _active; }
+    const CRGB& target() const { return _to; }
+
+private:
+    fl::Transition _transition;
+    uint32_t _startMs;
+    CRGB _from;
+    CRGB _to;
+    LedEasing _easing;
+    bool _active;
+};
+
+#endif // COLOR_FADE_H
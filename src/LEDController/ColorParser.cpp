@@ -0,0 +1,253 @@
+// ColorParser.cpp
+#include "ColorParser.h"
+#include "TextParse.h"
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+    struct NamedColor {
+        const char* name;
+        uint8_t length;
+        uint32_t rgb;
+    };
+
+    // Red, green and blue keep the FastLED constants the firmware has always
+    // used, but these are scene values: after the gamma stage and white
+    // balance half-scale green is about 44% as bright on the wire as it used
+    // to be (sim/test/OutputStageTest.cpp pins the wire values)
+    const NamedColor NAMED_COLORS[] = {
+        { "off", 3, 0x000000 },
+        { "red", 3, CRGB::Red },
+        { "green", 5, CRGB::Green },
+        { "blue", 4, CRGB::Blue },
+        { "white", 5, CRGB::White },
+        { "warmwhite", 9, 0xFFA757 },   // 2700 K
+        { "yellow", 6, CRGB::Yellow },
+        { "amber", 5, 0xFFBF00 },
+        { "orange", 6, CRGB::Orange },
+        { "pink", 4, CRGB::Pink },
+        { "purple", 6, CRGB::Purple },
+        { "cyan", 4, CRGB::Cyan },
+    };
+
+    struct NamedPalette {
+        const char* name;
+        uint8_t length;
+        const TProgmemRGBPalette16* palette;
+    };
+
+    const NamedPalette NAMED_PALETTES[] = {
+        { "rainbow", 7, &RainbowColors_p },
+        { "ocean", 5, &OceanColors_p },
+        { "lava", 4, &LavaColors_p },
+        { "forest", 6, &ForestColors_p },
+        { "party", 5, &PartyColors_p },
+        { "heat", 4, &HeatColors_p },
+        { "cloud", 5, &CloudColors_p },
+    };
+
+    struct Rgb8 {
+        uint8_t r, g, b;
+    };
+
+    const uint16_t KELVIN_MIN = 1000;
+    const uint16_t KELVIN_MAX = 10000;
+    const uint16_t KELVIN_STEP = 100;
+
+    // Blackbody white balance, 1000-10000 K in 100 K steps. Generated
+    // offline from Tanner Helland's fit of the CIE 1964 data so the device
+    // never runs pow()/log().
+    constexpr Rgb8 KELVIN_TABLE[] = {
+        { 255,  68,   0 }, { 255,  77,   0 }, { 255,  86,   0 }, { 255,  94,   0 }, { 255, 101,   0 },  // 1000 K
+        { 255, 108,   0 }, { 255, 115,   0 }, { 255, 121,   0 }, { 255, 126,   0 }, { 255, 132,   0 },  // 1500 K
+        { 255, 137,  14 }, { 255, 142,  27 }, { 255, 146,  39 }, { 255, 151,  50 }, { 255, 155,  61 },  // 2000 K
+        { 255, 159,  70 }, { 255, 163,  79 }, { 255, 167,  87 }, { 255, 170,  95 }, { 255, 174, 103 },  // 2500 K
+        { 255, 177, 110 }, { 255, 180, 117 }, { 255, 184, 123 }, { 255, 187, 129 }, { 255, 190, 135 },  // 3000 K
+        { 255, 193, 141 }, { 255, 195, 146 }, { 255, 198, 151 }, { 255, 201, 157 }, { 255, 203, 161 },  // 3500 K
+        { 255, 206, 166 }, { 255, 208, 171 }, { 255, 211, 175 }, { 255, 213, 179 }, { 255, 215, 183 },  // 4000 K
+        { 255, 218, 187 }, { 255, 220, 191 }, { 255, 222, 195 }, { 255, 224, 199 }, { 255, 226, 202 },  // 4500 K
+        { 255, 228, 206 }, { 255, 230, 209 }, { 255, 232, 213 }, { 255, 234, 216 }, { 255, 236, 219 },  // 5000 K
+        { 255, 237, 222 }, { 255, 239, 225 }, { 255, 241, 228 }, { 255, 243, 231 }, { 255, 244, 234 },  // 5500 K
+        { 255, 246, 237 }, { 255, 248, 240 }, { 255, 249, 242 }, { 255, 251, 245 }, { 255, 253, 248 },  // 6000 K
+        { 255, 254, 250 }, { 255, 255, 255 }, { 254, 249, 255 }, { 250, 246, 255 }, { 246, 244, 255 },  // 6500 K
+        { 243, 242, 255 }, { 240, 240, 255 }, { 237, 239, 255 }, { 234, 237, 255 }, { 232, 236, 255 },  // 7000 K
+        { 230, 235, 255 }, { 228, 234, 255 }, { 226, 233, 255 }, { 224, 232, 255 }, { 223, 231, 255 },  // 7500 K
+        { 221, 230, 255 }, { 220, 229, 255 }, { 218, 228, 255 }, { 217, 227, 255 }, { 216, 227, 255 },  // 8000 K
+        { 215, 226, 255 }, { 214, 225, 255 }, { 213, 225, 255 }, { 212, 224, 255 }, { 211, 223, 255 },  // 8500 K
+        { 210, 223, 255 }, { 209, 222, 255 }, { 208, 222, 255 }, { 207, 221, 255 }, { 206, 221, 255 },  // 9000 K
+        { 205, 220, 255 }, { 205, 220, 255 }, { 204, 219, 255 }, { 203, 219, 255 }, { 202, 218, 255 },  // 9500 K
+        { 202, 218, 255 },                                                                              // 10000 K
+    };
+    static_assert(sizeof(KELVIN_TABLE) / sizeof(KELVIN_TABLE[0]) == (KELVIN_MAX - KELVIN_MIN) / KELVIN_STEP + 1,
+                  "one entry per 100 K");
+
+    using TextParse::lower;
+    using TextParse::matches;
+
+    inline bool isLetter(char c) {
+        c = lower(c);
+        return c >= 'a' && c <= 'z';
+    }
+
+    inline int hexDigit(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        c = lower(c);
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        return -1;
+    }
+
+    inline void skipSpaces(const char*& p, const char* end) {
+        while (p < end && *p == ' ') p++;
+    }
+
+    // Decimal digits at p, advancing past them; false if there are none
+    // or the value exceeds max
+    bool readNumber(const char*& p, const char* end, uint16_t max, uint16_t& out) {
+        const char* start = p;
+        uint32_t value = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            value = value * 10 + (*p - '0');
+            if (value > max) return false;
+            p++;
+        }
+        out = (uint16_t)value;
+        return p != start;
+    }
+
+    bool parseHex(const char* p, const char* end, CRGB& out) {
+        if (end - p != 6) return false;
+        uint32_t rgb = 0;
+        for (int i = 0; i < 6; i++) {
+            int digit = hexDigit(p[i]);
+            if (digit < 0) return false;
+            rgb = (rgb << 4) | digit;
+        }
+        out = CRGB(rgb);
+        return true;
+    }
+
+    inline uint8_t div255(uint32_t x) {
+        return (uint8_t)((x + 127) / 255);
+    }
+
+    // Textbook six-sector HSV in integers. FastLED's hsv2rgb_* tops out
+    // below 255 and bends hues, but hsv(240,100,100) should be #0000FF.
+    CRGB hsvToRgb(uint16_t hue, uint16_t saturation, uint16_t value) {
+        hue %= 360;
+        uint32_t v = (value * 255 + 50) / 100;
+        uint32_t s = (saturation * 255 + 50) / 100;
+        uint32_t f = (uint32_t)(hue % 60) * 255 / 60;
+        uint8_t p = div255(v * (255 - s));
+        uint8_t q = div255(v * (255 - div255(s * f)));
+        uint8_t t = div255(v * (255 - div255(s * (255 - f))));
+        switch (hue / 60) {
+        case 0:  return CRGB(v, t, p);
+        case 1:  return CRGB(q, v, p);
+        case 2:  return CRGB(p, v, t);
+        case 3:  return CRGB(p, q, v);
+        case 4:  return CRGB(t, p, v);
+        default: return CRGB(v, p, q);
+        }
+    }
+
+    // "(a,b,c)" after the hsv/rgb keyword, spaces allowed around the numbers
+    bool parseTriple(const char* p, const char* end, const uint16_t limits[3], uint16_t values[3]) {
+        const char separators[3] = { ',', ',', ')' };
+        p++; // '('
+        for (int i = 0; i < 3; i++) {
+            skipSpaces(p, end);
+            if (!readNumber(p, end, limits[i], values[i])) return false;
+            skipSpaces(p, end);
+            if (p == end || *p != separators[i]) return false;
+            p++;
+        }
+        return p == end;
+    }
+
+    bool parseFunction(const char* word, const char* p, const char* end, CRGB& out) {
+        static const uint16_t HSV_LIMITS[3] = { 360, 100, 100 };
+        static const uint16_t RGB_LIMITS[3] = { 255, 255, 255 };
+        uint16_t values[3];
+        if (matches(word, "hsv", 3)) {
+            if (!parseTriple(p, end, HSV_LIMITS, values)) return false;
+            out = hsvToRgb(values[0], values[1], values[2]);
+            return true;
+        }
+        if (matches(word, "rgb", 3)) {
+            if (!parseTriple(p, end, RGB_LIMITS, values)) return false;
+            out = CRGB((uint8_t)values[0], (uint8_t)values[1], (uint8_t)values[2]);
+            return true;
+        }
+        return false;
+    }
+
+    bool lookupName(const char* word, size_t length, CRGB& out) {
+        for (const NamedColor& named : NAMED_COLORS) {
+            if (named.length == length && matches(word, named.name, length)) {
+                out = CRGB(named.rgb);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // "<word>:<number>" forms: kelvin or a palette position
+    bool parseKeyed(const char* word, size_t length, const char* p, const char* end, CRGB& out) {
+        p++; // ':' or '='
+        skipSpaces(p, end);
+        uint16_t value;
+        if (length == 6 && matches(word, "kelvin", 6)) {
+            if (!readNumber(p, end, KELVIN_MAX, value) || p != end || value < KELVIN_MIN) return false;
+            out = kelvinToRgb(value);
+            return true;
+        }
+        for (const NamedPalette& named : NAMED_PALETTES) {
+            if (named.length == length && matches(word, named.name, length)) {
+                if (!readNumber(p, end, 255, value) || p != end) return false;
+                out = ColorFromPalette(*named.palette, (uint8_t)value);
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+bool parseColor(const char* data, size_t length, CRGB& out) {
+    if (!data || length == 0) return false;
+    const char* end = data + length;
+    if (*data == '#') return parseHex(data + 1, end, out);
+
+    // The leading word plus the character after it decide the form
+    const char* p = data;
+    while (p < end && isLetter(*p)) p++;
+    size_t wordLength = p - data;
+    if (p == end) return lookupName(data, wordLength, out);
+    if (*p == '(') return wordLength == 3 && parseFunction(data, p, end, out);
+    if (*p == ':' || *p == '=') return parseKeyed(data, wordLength, p, end, out);
+    return false;
+}
+
+const char* formatColor(const CRGB& color, char* buffer) {
+    uint32_t rgb = ((uint32_t)color.r << 16) | ((uint32_t)color.g << 8) | color.b;
+    for (const NamedColor& named : NAMED_COLORS) {
+        if (named.rgb == rgb) {
+            memcpy(buffer, named.name, named.length + 1);
+            return buffer;
+        }
+    }
+    snprintf(buffer, COLOR_TEXT_SIZE, "#%06X", (unsigned)rgb);
+    return buffer;
+}
+
+CRGB kelvinToRgb(uint16_t kelvin) {
+    if (kelvin < KELVIN_MIN) kelvin = KELVIN_MIN;
+    if (kelvin > KELVIN_MAX) kelvin = KELVIN_MAX;
+    uint16_t index = (kelvin - KELVIN_MIN) / KELVIN_STEP;
+    uint16_t within = (kelvin - KELVIN_MIN) % KELVIN_STEP;
+    const Rgb8& low = KELVIN_TABLE[index];
+    if (within == 0) return CRGB(low.r, low.g, low.b);
+
+    const Rgb8& high = KELVIN_TABLE[index + 1];
+    fract8 frac = (fract8)(within * 256 / KELVIN_STEP);
+    return CRGB(lerp8by8(low.r, high.r, frac), lerp8by8(low.g, high.g, frac), lerp8by8(low.b, high.b, frac));
+}
@@ -0,0 +1,31 @@
+// ColorParser.h
+#ifndef COLOR_PARSER_H
+#define COLOR_PARSER_H
+
+#include <FastLED.h>
+#include <stddef.h>
+
+// "#RRGGBB" or a palette name, plus the terminator
+#define COLOR_TEXT_SIZE 12
+
+// Color grammar shared by /setColor and MQTT (case-insensitive):
+//   <name>                 off | red | green | blue | white | warmwhite |
+//                          yellow | amber | orange | pink | purple | cyan
+//   #RRGGBB
+//   hsv(h,s,v)             h 0-360 degrees, s and v 0-100 percent
+//   rgb(r,g,b)             0-255 each
+//   kelvin:<1000-10000>    white at a color temperature (also kelvin=)
+//   <palette>:<0-255>      a point on a FastLED palette: rainbow | ocean |
+//                          lava | forest | party | heat | cloud
+// One forward pass over the span; nothing is allocated or copied.
+bool parseColor(const char* data, size_t length, CRGB& out);
+
+// The name when the color has one, otherwise "#RRGGBB". Returns buffer,
+// which must hold COLOR_TEXT_SIZE bytes.
+const char* formatColor(const CRGB& color, char* buffer);
+
+// Table lookup with linear interpolation between 100 K steps; kelvin is
+// clamped to 1000-10000
+CRGB kelvinToRgb(uint16_t kelvin);
+
+#endif // COLOR_PARSER_H
@@ -0,0 +1,67 @@
+// CommandRing.h
+#ifndef COMMAND_RING_H
+#define COMMAND_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// Bounded lock-free multi-producer / single-consumer ring (Vyukov's
+// sequence-numbered cells). Producers never block: push() fails when the
+// ring is full and the caller decides how to recover.
+template <typename T, size_t N>
+class CommandRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "CommandRing size must be a power of two");
+
+public:
+    CommandRing() : _enqueuePos(0), _dequeuePos(0) {
+        for (size_t i = 0; i < N; i++) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Safe from any task
+    bool push(const T& item) {
+        size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = _cells[pos & (N - 1)];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data = item;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // full
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Single consumer only
+    bool pop(T& item) {
+        size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        Cell& cell = _cells[pos & (N - 1)];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if ((intptr_t)seq - (intptr_t)(pos + 1) < 0) return false; // empty
+        item = cell.data;
+        cell.sequence.store(pos + N, std::memory_order_release);
+        _dequeuePos.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    Cell _cells[N];
+    std::atomic<size_t> _enqueuePos;
+    std::atomic<size_t> _dequeuePos;
+};
+
+#endif // COMMAND_RING_H
@@ -0,0 +1,48 @@
+// LEDCommand.cpp
+#include "LEDCommand.h"
+#include "TextParse.h"
+
+using namespace TextParse;
+
+namespace {
+    bool parsePercent(const char* data, size_t length, uint8_t& out) {
+        uint16_t value;
+        if (!parseDecimal(data, length, 100, value)) return false;
+        out = (uint8_t)value;
+        return true;
+    }
+}
+
+bool parseLEDCommand(const char* data, size_t length, LEDCommand& out) {
+    if (!data) return false;
+    trim(data, length);
+
+    size_t sep = 0;
+    while (sep < length && data[sep] != ':' && data[sep] != '=' && data[sep] != ' ') sep++;
+
+    if (sep == length && length == 4 && matches(data, "ping", 4)) {
+        out.type = LEDCommand::Type::Ping;
+        return true;
+    }
+
+    if (sep < length) {
+        const char* value = data + sep + 1;
+        size_t valueLength = length - sep - 1;
+        trimLeft(value, valueLength);
+
+        if (sep == 4 && matches(data, "mode", 4)) {
+            out.type = LEDCommand::Type::Mode;
+            if (valueLength == 4 && matches(value, "auto", 4)) { out.autoMode = true; return true; }
+            if (valueLength == 6 && matches(value, "manual", 6)) { out.autoMode = false; return true; }
+            return false;
+        }
+        if (sep == 10 && matches(data, "brightness", 10)) {
+            out.type = LEDCommand::Type::Brightness;
+            return parsePercent(value, valueLength, out.brightness);
+        }
+    }
+
+    // Everything else is a color
+    out.type = LEDCommand::Type::Color;
+    return parseColor(data, length, out.color);
+}
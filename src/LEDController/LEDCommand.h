@@ -0,0 +1,27 @@
+// LEDCommand.h
+#ifndef LED_COMMAND_H
+#define LED_COMMAND_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "LEDController.h"
+#include "ColorParser.h"
+
+// A command decoded straight from a payload span. Parsing never allocates.
+struct LEDCommand {
+    enum class Type : uint8_t { Ping, Color, Brightness, Mode };
+
+    Type type;
+    CRGB color;           // Type::Color
+    uint8_t brightness;   // Type::Brightness, percent 0-100
+    bool autoMode;        // Type::Mode, true = follow the schedule
+};
+
+// Accepted (case-insensitive, surrounding whitespace ignored):
+//   ping
+//   brightness:<0-100>   (also "brightness=<n>" or "brightness <n>")
+//   mode:auto | mode:manual
+//   anything parseColor() accepts
+bool parseLEDCommand(const char* data, size_t length, LEDCommand& out);
+
+#endif // LED_COMMAND_H
@@ -1,57 +1,421 @@
 // LEDController.cpp
 #include "LEDController.h"
+#include "ColorParser.h"
+#include "SettingsStore/SettingsStore.h"
+#include "Telemetry/Telemetry.h"
+#include "Trace/Trace.h"
+#include <sys/time.h>
 
 #define PREF_NAMESPACE "led"
 #define PREF_KEY_BRIGHTNESS "brightness" // stored as uint8 0-100
+#define PREF_KEY_COLOR "color"           // last setColor()/startRamp() color, 0xRRGGBB
+#define PREF_KEY_FADE_MS "fadeMs"
+#define PREF_KEY_FADE_EASING "fadeEasing"
+#define PREF_KEY_COUNT "count"
+#define PREF_KEY_OUTPUTS "outputs"
+#define PREF_KEY_CHIPSET "chipset"
+#define PREF_KEY_WB_R "wbR"
+#define PREF_KEY_WB_G "wbG"
+#define PREF_KEY_WB_B "wbB"
 
-LEDController::LEDController() : _currentColor("off"), _brightness(255) {}
+// Output 0 keeps the key it had before there were several outputs
+static const char* const PIN_KEYS[LED_MAX_OUTPUTS] = { "pin", "pin1", "pin2", "pin3", "pin4", "pin5", "pin6", "pin7" };
+// The ten PREF_KEY_* above plus the pin keys; update the count with them
+static_assert(SETTINGS_KEYS_LED == 10 + LED_MAX_OUTPUTS, "SETTINGS_KEYS_LED out of date");
+static_assert(LED_DITHER_INTERVAL_MS * LED_DITHER_FRAMES <= LED_DITHER_MAX_CYCLE_MS, "dither cycle below ~60 Hz");
+
+static int64_t wallClockMs()
+{
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
+
+static uint32_t packRgb(const CRGB& color)
+{
+    return ((uint32_t)color.r << 16) | ((uint32_t)color.g << 8) | color.b;
+}
+
+LEDController::LEDController()
+    : _strip{ LED_DEFAULT_COUNT, 1, { LED_DEFAULT_PIN }, LED_DEFAULT_CHIPSET }, _scene(nullptr), _leds(nullptr),
+      _currentColor(0), _brightness(100), _whiteBalance(packRgb(LED_DEFAULT_WHITE_BALANCE)), _stateVersion(0),
+      _fadeMs(LED_FADE_DEFAULT_MS), _fadeEasing(LedEasing::EaseInOut), _requestedRamp(),
+      _task(nullptr), _resync(false), _droppedCommands(0), _stats(),
+      _renderColor(CRGB::Black), _renderBrightness(100), _renderWhiteBalance(LED_DEFAULT_WHITE_BALANCE),
+      _output(), _shown(CRGB::Black),
+      _renderRamp(), _rampNextMs(-1), _ditherIntervalMs(LED_DITHER_INTERVAL_MS), _ditherPhase(0),
+      _dithering(false) {}
 
 void LEDController::setup()
 {
-    FastLED.addLeds<LED_TYPE, LED_PIN, COLOR_ORDER>(_leds, NUM_LEDS).setCorrection(TypicalLEDStrip);
+    StripConfig stored = {};
+    stored.count = (uint16_t)SettingsStore::getUInt(PREF_NAMESPACE, PREF_KEY_COUNT, LED_DEFAULT_COUNT);
+    stored.outputs = SettingsStore::getUChar(PREF_NAMESPACE, PREF_KEY_OUTPUTS, 1);
+    stored.chipset = (LedChipset)SettingsStore::getUChar(PREF_NAMESPACE, PREF_KEY_CHIPSET, (uint8_t)LED_DEFAULT_CHIPSET);
+    // Only the outputs in use take a settings entry
+    for (uint8_t i = 0; i < stored.outputs && i < LED_MAX_OUTPUTS; i++) {
+        stored.pins[i] = SettingsStore::getUChar(PREF_NAMESPACE, PIN_KEYS[i], i == 0 ? LED_DEFAULT_PIN : 0);
+    }
+    if (isValidStripConfig(stored)) _strip = stored;
+    // The only allocations for pixels, one block each with the zones back
+    // to back; the frame path never resizes them
+    _scene = new CRGB[_strip.totalPixels()]();
+    _leds = new CRGB[_strip.totalPixels()]();
+    addStrips(_strip, _leds);
+    FastLED.setBrightness(BRIGHTNESS);
+    // FastLED's own dithering only spreads its global scale, which stays
+    // at full; OutputStage dithers the real remainder
+    FastLED.setDither(DISABLE_DITHER);
+    uint32_t wireMs = (modelWireTiming(LED_DRIVER, _strip.chipset, _strip.outputs, _strip.count).frameUs + 999) / 1000;
+    _ditherIntervalMs = wireMs > LED_DITHER_INTERVAL_MS ? wireMs : LED_DITHER_INTERVAL_MS;
+    // Slower than ~60 Hz the cycle is seen as flicker, not as a level
+    bool dither = _ditherIntervalMs * LED_DITHER_FRAMES <= LED_DITHER_MAX_CYCLE_MS;
+    _output.setDithering(dither);
+    Serial.printf("💡 Strip: %u x %u %s on GPIO", _strip.outputs, _strip.count, ledChipsetName(_strip.chipset));
+    for (uint8_t i = 0; i < _strip.outputs; i++) Serial.printf(" %u", _strip.pins[i]);
+    Serial.printf(" (%s)\n", ledDriverName(LED_DRIVER));
+    if (!dither) {
+        Serial.printf("💡 Dithering off: %u ms frames make a %u ms cycle (max %u)\n", _ditherIntervalMs,
+                      _ditherIntervalMs * LED_DITHER_FRAMES, LED_DITHER_MAX_CYCLE_MS);
+    }
+
     // Load brightness from preferences (percent 0-100)
-    _prefs.begin(PREF_NAMESPACE, false);
-    uint8_t stored = _prefs.getUChar(PREF_KEY_BRIGHTNESS, 100); // default 100%
-    if (stored > 100) stored = 100;
-    setBrightnessPercent(stored);
-    setColor("off");
+    uint8_t percent = SettingsStore::getUChar(PREF_NAMESPACE, PREF_KEY_BRIGHTNESS, 100); // default 100%
+    if (percent > 100) percent = 100;
+    setBrightnessPercent(percent);
+    CRGB balance = LED_DEFAULT_WHITE_BALANCE;
+    balance.r = SettingsStore::getUChar(PREF_NAMESPACE, PREF_KEY_WB_R, balance.r);
+    balance.g = SettingsStore::getUChar(PREF_NAMESPACE, PREF_KEY_WB_G, balance.g);
+    balance.b = SettingsStore::getUChar(PREF_NAMESPACE, PREF_KEY_WB_B, balance.b);
+    _whiteBalance = packRgb(balance);
+    uint32_t fadeMs = SettingsStore::getUInt(PREF_NAMESPACE, PREF_KEY_FADE_MS, LED_FADE_DEFAULT_MS);
+    uint8_t easing = SettingsStore::getUChar(PREF_NAMESPACE, PREF_KEY_FADE_EASING, (uint8_t)LedEasing::EaseInOut);
+    _fadeMs = fadeMs > LED_FADE_MAX_MS ? LED_FADE_MAX_MS : fadeMs;
+    _fadeEasing = easing <= (uint8_t)LedEasing::EaseInOut ? (LedEasing)easing : LedEasing::EaseInOut;
+    // Come back on the last color without a fade; the render task's first
+    // frame shows it, and the schedule corrects it once the clock is known
+    CRGB restored = CRGB(SettingsStore::getUInt(PREF_NAMESPACE, PREF_KEY_COLOR, 0));
+    _currentColor = packRgb(restored);
+    _renderColor = restored;
+    _shown = restored;
+    _stateVersion.fetch_add(1, std::memory_order_release);
+
+    xTaskCreatePinnedToCore(renderTask, "led", LED_TASK_STACK, this, LED_TASK_PRIORITY, &_task, LED_TASK_CORE);
 }
 
-void LEDController::setColor(const String& color)
+void LEDController::post(const Command& command)
 {
-    if (color == "green") {
-        _leds[0] = CRGB::Green;
-    } else if (color == "red") {
-        _leds[0] = CRGB::Red;
-    } else if (color == "blue") {
-        _leds[0] = CRGB::Blue;
-    } else {
-        _leds[0] = CRGB::Black;
+    if (!_commands.push(command)) {
+        // Nothing is lost: the getters' state is already updated and the
+        // render task rebuilds from it
+        _droppedCommands.fetch_add(1, std::memory_order_relaxed);
+        _resync.store(true, std::memory_order_release);
     }
+    if (_task) xTaskNotifyGive(_task);
+}
+
+void LEDController::setRequestedRamp(const LightRamp& ramp)
+{
+    std::lock_guard<std::mutex> lock(_rampMutex);
+    _requestedRamp = ramp;
+}
 
-    FastLED.setBrightness(_brightness); // ensure brightness applied
-    FastLED.show();
-    delay(10);
-    _currentColor = color;
+LightRamp LEDController::requestedRamp() const
+{
+    std::lock_guard<std::mutex> lock(_rampMutex);
+    return _requestedRamp;
+}
+
+void LEDController::setColor(const CRGB& color)
+{
+    _currentColor = packRgb(color);
+    SettingsStore::putUInt(PREF_NAMESPACE, PREF_KEY_COLOR, _currentColor);
+    setRequestedRamp(LightRamp());
+    _stateVersion.fetch_add(1, std::memory_order_release);
+    post({ Command::Type::SetColor, 0, color, LightRamp() });
 }
 
-String LEDController::getColor() const
+void LEDController::startRamp(const CRGB& color, const LightRamp& ramp)
 {
-    return _currentColor;
+    _currentColor = packRgb(color);
+    // Boot restores this: a reboot mid-ramp must come back on the color
+    // the ramp settles on, not on the one before the ramp
+    SettingsStore::putUInt(PREF_NAMESPACE, PREF_KEY_COLOR, _currentColor);
+    setRequestedRamp(ramp);
+    _stateVersion.fetch_add(1, std::memory_order_release);
+    post({ Command::Type::SetRamp, 0, color, ramp });
+}
+
+RampKind LEDController::getRampKind() const
+{
+    LightRamp ramp = requestedRamp();
+    return ramp.activeAt(wallClockMs()) ? ramp.kind : RampKind::None;
+}
+
+bool LEDController::setColor(const String& color)
+{
+    CRGB value;
+    if (!parseColor(color.c_str(), color.length(), value)) return false;
+    setColor(value);
+    return true;
+}
+
+CRGB LEDController::getColor() const
+{
+    return CRGB((uint32_t)_currentColor);
 }
 
 void LEDController::setBrightnessPercent(uint8_t percent) {
     if (percent > 100) percent = 100;
-    // Map 0-100% to 0-255 (linear)
-    uint8_t newBrightness = (uint16_t)percent * 255 / 100;
-    _brightness = newBrightness;
-    FastLED.setBrightness(_brightness);
-    FastLED.show();
-    // persist percent (not 0-255 value)
-    _prefs.putUChar(PREF_KEY_BRIGHTNESS, percent);
+    // Kept as the percent; the output stage turns it into light
+    _brightness = percent;
+    _stateVersion.fetch_add(1, std::memory_order_release);
+    post({ Command::Type::SetBrightness, percent, CRGB::Black, LightRamp() });
+    // the store coalesces slider bursts
+    SettingsStore::putUChar(PREF_NAMESPACE, PREF_KEY_BRIGHTNESS, percent);
+}
+
+void LEDController::apply(const LEDUpdate& update) {
+    if (!update.hasColor && !update.hasBrightness) return;
+    uint8_t percent = update.brightness > 100 ? 100 : update.brightness;
+    if (update.hasColor) {
+        _currentColor = packRgb(update.color);
+        setRequestedRamp(LightRamp());
+        SettingsStore::putUInt(PREF_NAMESPACE, PREF_KEY_COLOR, _currentColor);
+    }
+    if (update.hasBrightness) {
+        _brightness = percent;
+        SettingsStore::putUChar(PREF_NAMESPACE, PREF_KEY_BRIGHTNESS, percent);
+    }
+    _stateVersion.fetch_add(1, std::memory_order_release);
+    // One command for the whole update: the render task takes color and
+    // brightness in the same drain, so no frame shows only half of it
+    post({ Command::Type::Update, percent, update.color, LightRamp(), update.hasColor, update.hasBrightness });
 }
 
 uint8_t LEDController::getBrightnessPercent() const {
-    // Reverse map for UI (approx) _brightness 0-255 to 0-100
-    return (uint16_t)_brightness * 100 / 255;
+    return _brightness;
+}
+
+void LEDController::setWhiteBalance(const CRGB& balance) {
+    _whiteBalance = packRgb(balance);
+    _stateVersion.fetch_add(1, std::memory_order_release);
+    post({ Command::Type::SetWhiteBalance, 0, balance, LightRamp() });
+    SettingsStore::putUChar(PREF_NAMESPACE, PREF_KEY_WB_R, balance.r);
+    SettingsStore::putUChar(PREF_NAMESPACE, PREF_KEY_WB_G, balance.g);
+    SettingsStore::putUChar(PREF_NAMESPACE, PREF_KEY_WB_B, balance.b);
+}
+
+CRGB LEDController::getWhiteBalance() const {
+    return CRGB((uint32_t)_whiteBalance);
+}
+
+void LEDController::setTransition(uint16_t durationMs, LedEasing easing) {
+    if (durationMs > LED_FADE_MAX_MS) durationMs = LED_FADE_MAX_MS;
+    // Takes effect from the next color change; a running fade keeps its timing
+    _fadeMs = durationMs;
+    _fadeEasing = easing;
+    SettingsStore::putUInt(PREF_NAMESPACE, PREF_KEY_FADE_MS, durationMs);
+    SettingsStore::putUChar(PREF_NAMESPACE, PREF_KEY_FADE_EASING, (uint8_t)easing);
+}
+
+uint16_t LEDController::getTransitionMs() const {
+    return _fadeMs;
+}
+
+LedEasing LEDController::getTransitionEasing() const {
+    return _fadeEasing;
+}
+
+uint32_t LEDController::getStateVersion() const {
+    return _stateVersion.load(std::memory_order_acquire);
+}
+
+LEDFrameStats LEDController::getFrameStats() const {
+    LEDFrameStats stats;
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        stats = _stats;
+    }
+    stats.droppedCommands = _droppedCommands.load(std::memory_order_relaxed);
+    return stats;
+}
+
+const LatencyHistogram& LEDController::getShowHistogram() const {
+    return _showHistogram;
+}
+
+uint32_t LEDController::getTaskStackFree() const {
+    return _task ? uxTaskGetStackHighWaterMark(_task) : 0;
+}
+
+const StripConfig& LEDController::getStripConfig() const {
+    return _strip;
+}
+
+bool LEDController::setStripConfig(const StripConfig& config) {
+    if (!isValidStripConfig(config)) return false;
+    SettingsStore::putUInt(PREF_NAMESPACE, PREF_KEY_COUNT, config.count);
+    SettingsStore::putUChar(PREF_NAMESPACE, PREF_KEY_OUTPUTS, config.outputs);
+    for (uint8_t i = 0; i < config.outputs; i++) {
+        SettingsStore::putUChar(PREF_NAMESPACE, PIN_KEYS[i], config.pins[i]);
+    }
+    SettingsStore::putUChar(PREF_NAMESPACE, PREF_KEY_CHIPSET, (uint8_t)config.chipset);
+    return true;
+}
+
+// ---- Render task ----
+
+void LEDController::renderTask(void* arg) {
+    static_cast<LEDController*>(arg)->renderLoop();
+}
+
+bool LEDController::applyCommands() {
+    bool dirty = false;
+    bool rampPosted = false;
+    CRGB color = _renderColor;
+    LightRamp ramp = _renderRamp;
+    Command command;
+    // Drain everything queued; only the latest value of each kind matters
+    while (_commands.pop(command)) {
+        switch (command.type) {
+        case Command::Type::SetColor:
+            color = command.color;
+            ramp = LightRamp();
+            break;
+        case Command::Type::SetRamp:
+            color = command.color;
+            ramp = command.ramp;
+            rampPosted = true;
+            break;
+        case Command::Type::SetBrightness:
+            dirty |= _renderBrightness != command.value;
+            _renderBrightness = command.value;
+            break;
+        case Command::Type::SetWhiteBalance:
+            dirty |= _renderWhiteBalance != command.color;
+            _renderWhiteBalance = command.color;
+            break;
+        case Command::Type::Update:
+            if (command.hasColor) {
+                color = command.color;
+                ramp = LightRamp();
+            }
+            if (command.hasBrightness) {
+                dirty |= _renderBrightness != command.value;
+                _renderBrightness = command.value;
+            }
+            break;
+        }
+    }
+    if (_resync.exchange(false, std::memory_order_acquire)) {
+        color = CRGB((uint32_t)_currentColor);
+        ramp = requestedRamp();
+        _renderBrightness = _brightness;
+        _renderWhiteBalance = CRGB((uint32_t)_whiteBalance);
+        dirty = true;
+    }
+    if (dirty) {
+        _output.setBrightnessPercent(_renderBrightness);
+        _output.setWhiteBalance(_renderWhiteBalance);
+    }
+
+    bool rampChanged = ramp.kind != _renderRamp.kind || ramp.startMs != _renderRamp.startMs ||
+                       ramp.durationMs != _renderRamp.durationMs;
+    if (color != _renderColor || rampChanged) {
+        // Fade from what is on the strip now, even if that is mid-fade
+        _renderColor = color;
+        _renderRamp = ramp;
+        CRGB target = ramp.kind != RampKind::None ? ramp.colorAt(wallClockMs()) : color;
+        _fade.start(_shown, target, millis(), _fadeMs, _fadeEasing);
+        dirty = true;
+    } else if (rampPosted) {
+        // Same ramp re-sent (e.g. after a clock step): re-place it in time
+        _rampNextMs = 0;
+    }
+    return dirty;
+}
+
+void LEDController::renderFrame() {
+    if (_fade.active()) _shown = _fade.step(millis());
+    _rampNextMs = -1;
+    if (!_fade.active() && _renderRamp.kind != RampKind::None) {
+        int64_t now = wallClockMs();
+        _shown = _renderRamp.colorAt(now);
+        _rampNextMs = _renderRamp.nextChangeMs(now);
+    }
+    // Every zone shows the same color for now
+    fill_solid(_scene, _strip.totalPixels(), _shown);
+    _dithering = _output.render(_scene, _leds, _strip.totalPixels(), _ditherPhase++);
+}
+
+void LEDController::renderLoop() {
+    // The first frame always goes out so the strip matches our state
+    _resync = true;
+    TickType_t lastShow = xTaskGetTickCount() - pdMS_TO_TICKS(LED_FRAME_INTERVAL_MS);
+    uint32_t lastFrameEnd = micros();
+
+    for (;;) {
+        // Sleep until a command arrives; a running fade or a dithered
+        // color needs the next frame, a ramp only its next visible step.
+        // Outside the dim band an idle strip costs no frames at all.
+        TickType_t interval = pdMS_TO_TICKS(_dithering ? _ditherIntervalMs : LED_FRAME_INTERVAL_MS);
+        TickType_t wait = portMAX_DELAY;
+        if (_resync.load(std::memory_order_relaxed)) {
+            wait = 0;
+        } else if (_fade.active() || _dithering) {
+            TickType_t sinceShow = xTaskGetTickCount() - lastShow;
+            wait = sinceShow < interval ? interval - sinceShow : 0;
+        } else if (_rampNextMs >= 0) {
+            int64_t untilMs = _rampNextMs - wallClockMs();
+            wait = untilMs > 0 ? pdMS_TO_TICKS((uint32_t)untilMs) : 0;
+        }
+        ulTaskNotifyTake(pdTRUE, wait);
+
+        // Rate-limit frames; anything posted meanwhile is folded in
+        TickType_t sinceShow = xTaskGetTickCount() - lastShow;
+        if (sinceShow < interval) {
+            vTaskDelay(interval - sinceShow);
+        }
+
+        uint32_t frameStart = micros();
+        bool dirty = applyCommands();
+        bool rampDue = _rampNextMs >= 0 && wallClockMs() >= _rampNextMs;
+        bool ditherOnly = !dirty && !_fade.active() && !rampDue;
+        if (ditherOnly && !_dithering) continue;
+
+        TRACE_BEGIN(LedFrame);
+        bool wasDithering = _dithering;
+        renderFrame();
+        uint32_t showStart = micros();
+        TRACE_BEGIN(LedShow);
+        FastLED.show();
+        TRACE_END(LedShow);
+        uint32_t now = micros();
+        lastShow = xTaskGetTickCount();
+
+        uint32_t showUs = now - showStart;
+        uint32_t frameUs = now - frameStart;
+        bool firstFrame;
+        {
+            // Held only for the copy: getFrameStats() snapshots from other tasks
+            std::lock_guard<std::mutex> lock(_statsMutex);
+            _stats.frames++;
+            firstFrame = _stats.frames == 1;
+            _stats.lastShowUs = showUs;
+            _stats.lastFrameUs = frameUs;
+            if (showUs > _stats.maxShowUs) _stats.maxShowUs = showUs;
+            if (frameUs > _stats.maxFrameUs) _stats.maxFrameUs = frameUs;
+            _stats.busyUs += frameUs;
+            if (ditherOnly) {
+                _stats.ditherFrames++;
+                _stats.ditherBusyUs += frameUs;
+            }
+            if (wasDithering) _stats.ditherUs += now - lastFrameEnd;
+        }
+        if (firstFrame) Telemetry::markBoot(BootPhase::Light);
+        _showHistogram.observe(showUs);
+        lastFrameEnd = now;
+        TRACE_END(LedFrame);
+    }
 }
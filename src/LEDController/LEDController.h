@@ -3,28 +3,145 @@
 #define LED_CONTROLLER_H
 
 #include <FastLED.h>
-#include <Preferences.h>
+#include <atomic>
+#include <mutex>
+#include "ColorFade.h"
+#include "CommandRing.h"
+#include "LightRamp.h"
+#include "OutputStage.h"
+#include "StripConfig.h"
+#include "Telemetry/LatencyHistogram.h"
 
-#define LED_PIN      23
-#define NUM_LEDS     1
-#define BRIGHTNESS   255
-#define LED_TYPE     WS2812
-#define COLOR_ORDER  GRB
+// Strip used until another one is configured (see setStripConfig)
+#define LED_DEFAULT_PIN     23
+#define LED_DEFAULT_COUNT   1
+#define LED_DEFAULT_CHIPSET LedChipset::WS2812
+#define BRIGHTNESS   255   // FastLED global; dimming happens in OutputStage
 
+// Render task placement: app core, above the Arduino loop
+#define LED_TASK_CORE     1
+#define LED_TASK_PRIORITY 2
+#define LED_TASK_STACK    4096
+// Minimum time between two show() calls; bursts inside it coalesce.
+// While a fade runs this is also the frame period.
+#define LED_FRAME_INTERVAL_MS 10
+// Frame period while a color is being dithered (see OutputStage), or the
+// strip's own wire time if that is longer. LED_DITHER_FRAMES of them make
+// a 16 ms (62.5 Hz) cycle; a strip whose wire time stretches the cycle
+// past LED_DITHER_MAX_CYCLE_MS is not dithered at all.
+#define LED_DITHER_INTERVAL_MS 4
+// Color changes cross-fade over this long unless configured otherwise
+#define LED_FADE_DEFAULT_MS 800
+#define LED_FADE_MAX_MS     60000
+
+struct LEDFrameStats {
+    uint32_t frames;            // show() calls
+    uint32_t lastShowUs;        // duration of the last show()
+    uint32_t maxShowUs;
+    uint32_t lastFrameUs;       // drain + render + show, last frame
+    uint32_t maxFrameUs;
+    uint32_t droppedCommands;   // ring full; recovered by a resync
+    uint32_t ditherFrames;      // frames sent only to keep dithering going
+    uint64_t busyUs;            // render task time over all frames
+    uint64_t ditherBusyUs;      // of that, spent on ditherFrames
+    uint64_t ditherUs;          // time spent in the dim band
+};
+
+// Several changes for LEDController::apply(); unset fields keep their value
+struct LEDUpdate {
+    bool hasColor;
+    CRGB color;
+    bool hasBrightness;
+    uint8_t brightness;   // percent 0-100
+};
+
+// The render task owns the pixel buffer and is the only caller of
+// FastLED. The public setters only record the request and post it to the
+// command ring, so they return in microseconds from any task.
 class LEDController {
 private:
-    CRGB _leds[NUM_LEDS];
-    String _currentColor;
-    uint8_t _brightness; // 0-255
-    Preferences _prefs;
+    struct Command {
+        enum class Type : uint8_t { SetColor, SetBrightness, SetRamp, SetWhiteBalance, Update };
+        Type type;
+        uint8_t value;    // Type::SetBrightness, Type::Update: percent
+        CRGB color;       // Type::SetColor, Type::SetRamp, Type::SetWhiteBalance, Type::Update
+        LightRamp ramp;   // Type::SetRamp
+        bool hasColor;    // Type::Update: which of color/value it carries
+        bool hasBrightness;
+    };
+
+    StripConfig _strip;               // fixed after setup()
+    CRGB* _scene;                     // _strip.totalPixels(), allocated once in setup()
+    CRGB* _leds;                      // same size, wire values handed to FastLED
+    volatile uint32_t _currentColor;  // last requested as 0xRRGGBB, for getters
+    volatile uint8_t _brightness;     // 0-100, last requested
+    volatile uint32_t _whiteBalance;  // 0xRRGGBB gain per channel
+    std::atomic<uint32_t> _stateVersion; // bumped on every color/brightness change, from any task
+    volatile uint16_t _fadeMs;        // read by the render task when a fade starts
+    volatile LedEasing _fadeEasing;
+    LightRamp _requestedRamp;         // producer side, under _rampMutex; written from any task
+    mutable std::mutex _rampMutex;
+
+    CommandRing<Command, 16> _commands;
+    TaskHandle_t _task;
+    std::atomic<bool> _resync;        // set after the getter fields, so the render task sees them
+    std::atomic<uint32_t> _droppedCommands; // post() runs on any task
+    LEDFrameStats _stats;             // written by the render task under _statsMutex; droppedCommands is filled in by getFrameStats()
+    mutable std::mutex _statsMutex;
+    LatencyHistogram _showHistogram;
+
+    // Render task state
+    CRGB _renderColor;
+    uint8_t _renderBrightness;
+    CRGB _renderWhiteBalance;
+    OutputStage _output;
+    CRGB _shown;        // scene color, before the output stage
+    ColorFade _fade;
+    LightRamp _renderRamp;
+    int64_t _rampNextMs; // wall-clock ms of the ramp's next visible step, -1 = none
+    uint16_t _ditherIntervalMs;
+    uint8_t _ditherPhase;
+    bool _dithering;     // the last frame only averages out if refreshed
+
+    void post(const Command& command);
+    void setRequestedRamp(const LightRamp& ramp);
+    LightRamp requestedRamp() const;
+    bool applyCommands();
+    void renderFrame();
+    void renderLoop();
+    static void renderTask(void* arg);
 
 public:
     LEDController();
     void setup();
-    void setColor(const String& color);
-    String getColor() const;
+    void setColor(const CRGB& color);
+    // Any text parseColor() accepts; anything else is rejected and the
+    // color stays as it is
+    bool setColor(const String& color);
+    // Plays a wall-clock ramp; getters report `color` meanwhile. Any
+    // setColor() ends it.
+    void startRamp(const CRGB& color, const LightRamp& ramp);
+    RampKind getRampKind() const;       // ramp running right now, if any
+    CRGB getColor() const;
     void setBrightnessPercent(uint8_t percent); // 0-100
+    // Changes everything in the update at once: one state version, and
+    // the render task picks it all up in a single frame (one fade)
+    void apply(const LEDUpdate& update);
     uint8_t getBrightnessPercent() const;       // 0-100
+    // Per-channel gain for the strip's tint; 255 = unchanged
+    void setWhiteBalance(const CRGB& balance);
+    CRGB getWhiteBalance() const;
+    void setTransition(uint16_t durationMs, LedEasing easing); // 0 = instant
+    uint16_t getTransitionMs() const;
+    LedEasing getTransitionEasing() const;
+    uint32_t getStateVersion() const;
+    LEDFrameStats getFrameStats() const;
+    const LatencyHistogram& getShowHistogram() const;
+    uint32_t getTaskStackFree() const;  // render task's stack high-water mark
+    const StripConfig& getStripConfig() const;
+    // Stores the strip for the next boot; the running strip is unchanged.
+    // Returns false for an unsupported pin, chipset or length.
+    static bool setStripConfig(const StripConfig& config);
 };
 
 #endif // LED_CONTROLLER_H
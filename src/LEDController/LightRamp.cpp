@@ -0,0 +1,84 @@
+// LightRamp.cpp
+#include "LightRamp.h"
+
+namespace {
+    struct Key16 {
+        uint16_t r, g, b;
+    };
+
+    // Evenly spaced in phase; every channel is non-decreasing, which
+    // nextChangeMs() relies on
+    const Key16 SUNRISE_KEYS[] = {
+        { 65535,     0,     0 },   // sleep red
+        { 65535, 17476,     0 },   // ~1000 K
+        { 65535, 28013,     0 },   // ~1500 K
+        { 65535, 35209,  3598 },   // ~2000 K
+        { 65535, 43433, 22359 },   // ~2700 K
+    };
+    const uint8_t SEGMENTS = sizeof(SUNRISE_KEYS) / sizeof(SUNRISE_KEYS[0]) - 1;
+
+    // Nearest 8-bit value of a 16-bit one (v * 255 / 65535, rounded)
+    inline uint8_t round16(uint16_t value) {
+        return (uint8_t)(((uint32_t)value - (value >> 8) + 0x80) >> 8);
+    }
+}
+
+const char* rampKindName(RampKind kind) {
+    switch (kind) {
+    case RampKind::Sunrise: return "sunrise";
+    case RampKind::Sunset:  return "sunset";
+    default:                return "none";
+    }
+}
+
+CRGB sunriseColor(uint16_t phase) {
+    // Segment index and the 16-bit fraction within it
+    uint32_t scaled = (uint32_t)phase * SEGMENTS;
+    uint8_t segment = scaled >> 16;
+    fract16 frac = scaled & 0xFFFF;
+
+    const Key16& a = SUNRISE_KEYS[segment];
+    const Key16& b = SUNRISE_KEYS[segment + 1];
+    return CRGB(round16(lerp16by16(a.r, b.r, frac)),
+                round16(lerp16by16(a.g, b.g, frac)),
+                round16(lerp16by16(a.b, b.b, frac)));
+}
+
+uint16_t LightRamp::phaseAt(int64_t nowMs) const {
+    if (nowMs <= startMs) return durationMs ? 0 : 65535;
+    uint64_t elapsed = (uint64_t)(nowMs - startMs);
+    if (elapsed >= durationMs) return 65535;
+    return (uint16_t)((elapsed << 16) / durationMs);
+}
+
+CRGB LightRamp::colorAt(int64_t nowMs) const {
+    uint16_t phase = phaseAt(nowMs);
+    return kind == RampKind::Sunset ? sunriseColor(65535 - phase) : sunriseColor(phase);
+}
+
+bool LightRamp::activeAt(int64_t nowMs) const {
+    return kind != RampKind::None && nowMs >= startMs && nowMs < startMs + (int64_t)durationMs;
+}
+
+int64_t LightRamp::nextChangeMs(int64_t nowMs) const {
+    int64_t endMs = startMs + (int64_t)durationMs;
+    if (kind == RampKind::None || nowMs >= endMs) return -1;
+
+    CRGB current = colorAt(nowMs);
+    if (colorAt(endMs) == current) return -1;
+
+    // The curve is monotonic per channel, so "differs from now" flips
+    // exactly once between now and the end: bisect for it
+    int64_t lo = nowMs < startMs ? startMs : nowMs;
+    int64_t hi = endMs;
+    if (colorAt(lo) != current) return lo;
+    while (hi - lo > 1) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (colorAt(mid) == current) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return hi;
+}
@@ -0,0 +1,34 @@
+// LightRamp.h
+#ifndef LIGHT_RAMP_H
+#define LIGHT_RAMP_H
+
+#include <FastLED.h>
+#include <stdint.h>
+
+enum class RampKind : uint8_t { None, Sunrise, Sunset };
+
+const char* rampKindName(RampKind kind);
+
+// A slow color ramp pinned to the wall clock. The frame for any instant is
+// a pure function of the ramp and the time, so a reboot mid-ramp resumes
+// exactly where it would have been.
+struct LightRamp {
+    RampKind kind;
+    int64_t startMs;      // epoch milliseconds
+    uint32_t durationMs;
+
+    // 0 up to the start, 65535 from the end on
+    uint16_t phaseAt(int64_t nowMs) const;
+    CRGB colorAt(int64_t nowMs) const;
+    bool activeAt(int64_t nowMs) const;
+    // First instant after nowMs at which colorAt() changes, or -1 once the
+    // final color is reached. Lets the renderer sleep between visible steps.
+    int64_t nextChangeMs(int64_t nowMs) const;
+};
+
+// Sunrise curve: the sleep red warming through ~1000 K, 1500 K and 2000 K
+// to 2700 K warm white. Interpolated in 16 bits and rounded once, so the
+// slow low-value channels step evenly and never go backwards.
+CRGB sunriseColor(uint16_t phase);
+
+#endif // LIGHT_RAMP_H
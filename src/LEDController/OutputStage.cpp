@@ -0,0 +1,140 @@
+// OutputStage.cpp
+#include "OutputStage.h"
+
+namespace {
+    // 65535 * (i / 255)^2.2, generated offline
+    constexpr uint16_t GAMMA_16[256] = {
+            0,     0,     2,     4,     7,    11,    17,    24,
+           32,    42,    53,    65,    79,    94,   111,   129,
+          148,   169,   192,   216,   242,   270,   299,   330,
+          362,   396,   432,   469,   508,   549,   591,   635,
+          681,   729,   779,   830,   883,   938,   995,  1053,
+         1113,  1175,  1239,  1305,  1373,  1443,  1514,  1587,
+         1663,  1740,  1819,  1900,  1983,  2068,  2155,  2243,
+         2334,  2427,  2521,  2618,  2717,  2817,  2920,  3024,
+         3131,  3240,  3350,  3463,  3578,  3694,  3813,  3934,
+         4057,  4182,  4309,  4438,  4570,  4703,  4838,  4976,
+         5115,  5257,  5401,  5547,  5695,  5845,  5998,  6152,
+         6309,  6468,  6629,  6792,  6957,  7124,  7294,  7466,
+         7640,  7816,  7994,  8175,  8358,  8543,  8730,  8919,
+         9111,  9305,  9501,  9699,  9900, 10102, 10307, 10515,
+        10724, 10936, 11150, 11366, 11585, 11806, 12029, 12254,
+        12482, 12712, 12944, 13179, 13416, 13655, 13896, 14140,
+        14386, 14635, 14885, 15138, 15394, 15652, 15912, 16174,
+        16439, 16706, 16975, 17247, 17521, 17798, 18077, 18358,
+        18642, 18928, 19216, 19507, 19800, 20095, 20393, 20694,
+        20996, 21301, 21609, 21919, 22231, 22546, 22863, 23182,
+        23504, 23829, 24156, 24485, 24817, 25151, 25487, 25826,
+        26168, 26512, 26858, 27207, 27558, 27912, 28268, 28627,
+        28988, 29351, 29717, 30086, 30457, 30830, 31206, 31585,
+        31966, 32349, 32735, 33124, 33514, 33908, 34304, 34702,
+        35103, 35507, 35913, 36321, 36732, 37146, 37562, 37981,
+        38402, 38825, 39252, 39680, 40112, 40546, 40982, 41421,
+        41862, 42306, 42753, 43202, 43654, 44108, 44565, 45025,
+        45487, 45951, 46418, 46888, 47360, 47835, 48313, 48793,
+        49275, 49761, 50249, 50739, 51232, 51728, 52226, 52727,
+        53230, 53736, 54245, 54756, 55270, 55787, 56306, 56828,
+        57352, 57879, 58409, 58941, 59476, 60014, 60554, 61097,
+        61642, 62190, 62741, 63295, 63851, 64410, 64971, 65535,
+    };
+
+    // Brightness percent to linear light through CIE L*, so every slider
+    // step looks like the same change. The low end is linear in L*, which
+    // keeps 1% visibly distinct from off. Generated offline.
+    constexpr uint16_t LSTAR_16[101] = {
+            0,    73,   145,   218,   290,   363,   435,   508,   580,   656,  // 0%
+          738,   826,   922,  1024,  1134,  1251,  1376,  1509,  1650,  1800,  // 10%
+         1959,  2127,  2304,  2491,  2687,  2894,  3111,  3338,  3576,  3826,  // 20%
+         4087,  4359,  4643,  4940,  5248,  5569,  5903,  6251,  6611,  6985,  // 30%
+         7373,  7775,  8192,  8623,  9069,  9530, 10006, 10498, 11006, 11530,  // 40%
+        12071, 12628, 13202, 13793, 14401, 15027, 15671, 16333, 17014, 17713,  // 50%
+        18431, 19168, 19924, 20700, 21497, 22313, 23149, 24007, 24885, 25784,  // 60%
+        26705, 27648, 28612, 29598, 30607, 31639, 32694, 33771, 34872, 35997,  // 70%
+        37146, 38319, 39516, 40738, 41986, 43258, 44555, 45879, 47228, 48603,  // 80%
+        50005, 51434, 52890, 54372, 55883, 57421, 58987, 60581, 62203, 63855,  // 90%
+        65535,  // 100%
+    };
+    static_assert(sizeof(LSTAR_16) / sizeof(LSTAR_16[0]) == 101, "one entry per percent");
+
+    // Bit-reversed frame order, so the frames a channel spends on its
+    // upper step are spread evenly through the cycle
+    constexpr uint8_t DITHER_THRESHOLDS[LED_DITHER_FRAMES] = { 32, 160, 96, 224 };
+
+    inline uint8_t dither8(uint32_t value16, uint8_t threshold) {
+        return (uint8_t)((value16 >> 8) + ((value16 & 0xFF) >= threshold));
+    }
+
+    // Round to 8 bits; 0xFF80 and up would round to 256
+    inline uint8_t to8(uint32_t value16) {
+        return value16 >= 0xFF80 ? 255 : (uint8_t)((value16 + 0x80) >> 8);
+    }
+}
+
+uint16_t gamma16(uint8_t value) {
+    return GAMMA_16[value];
+}
+
+OutputStage::OutputStage()
+    : _level(65535), _whiteBalance(LED_DEFAULT_WHITE_BALANCE), _scale{}, _dither(true) {
+    updateScale();
+}
+
+void OutputStage::setBrightnessPercent(uint8_t percent) {
+    if (percent > 100) percent = 100;
+    _level = LSTAR_16[percent];
+    updateScale();
+}
+
+void OutputStage::setWhiteBalance(const CRGB& balance) {
+    _whiteBalance = balance;
+    updateScale();
+}
+
+void OutputStage::updateScale() {
+    // level x balance / 65535 fits 32 bits; the per-pixel multiply then
+    // uses scale + 1 so full scale passes values through unchanged
+    for (int c = 0; c < 3; c++) {
+        uint32_t balance16 = (uint32_t)_whiteBalance.raw[c] * 257;
+        _scale[c] = (uint32_t)_level * balance16 / 65535 + 1;
+    }
+}
+
+bool OutputStage::render(const CRGB* scene, CRGB* out, uint16_t count, uint8_t phase) const {
+    // Zones are mostly runs of one color: convert each run once
+    CRGB last = CRGB::Black;
+    CRGB rounded = CRGB::Black;
+    uint32_t r = 0, g = 0, b = 0;
+    bool dim = false;
+    bool dithered = false;
+    for (uint16_t i = 0; i < count; i++) {
+        const CRGB& in = scene[i];
+        if (i == 0 || in != last) {
+            last = in;
+            r = GAMMA_16[in.r] * _scale[0] >> 16;
+            g = GAMMA_16[in.g] * _scale[1] >> 16;
+            b = GAMMA_16[in.b] * _scale[2] >> 16;
+            uint32_t peak = r > g ? (r > b ? r : b) : (g > b ? g : b);
+            // Below the first threshold nothing would ever light; a
+            // remainder of zero has nothing to spread
+            dim = _dither && peak >= DITHER_THRESHOLDS[0] && peak < ((uint32_t)LED_DITHER_BAND << 8) && ((r | g | b) & 0xFF);
+            rounded = CRGB(to8(r), to8(g), to8(b));
+            if (!rounded && peak) {
+                // Below half a step on every channel: keep the strongest one
+                // at 1 rather than going dark
+                if (r == peak) rounded.r = 1;
+                else if (g == peak) rounded.g = 1;
+                else rounded.b = 1;
+            }
+        }
+        if (dim) {
+            // Neighbours start the cycle at different frames so the strip
+            // never pulses as a whole
+            uint8_t threshold = DITHER_THRESHOLDS[(uint8_t)(phase + i) % LED_DITHER_FRAMES];
+            out[i] = CRGB(dither8(r, threshold), dither8(g, threshold), dither8(b, threshold));
+            dithered = true;
+        } else {
+            out[i] = rounded;
+        }
+    }
+    return dithered;
+}
@@ -0,0 +1,55 @@
+// OutputStage.h
+#ifndef OUTPUT_STAGE_H
+#define OUTPUT_STAGE_H
+
+#include <FastLED.h>
+
+// Per-channel gain applied on the way out; FastLED's usual strip
+// correction until another one is configured
+#define LED_DEFAULT_WHITE_BALANCE CRGB(255, 176, 240)
+// Colors whose brightest channel is below this many 8-bit steps are
+// temporally dithered; above it one step is too small to see
+#define LED_DITHER_BAND 32
+// Frames in one dither cycle; a channel resolves to 1/4 of a step. The
+// whole cycle has to repeat at ~60 Hz or more to average out instead of
+// flickering, so frames x frame period must stay within
+// LED_DITHER_MAX_CYCLE_MS (LEDController turns dithering off otherwise).
+#define LED_DITHER_FRAMES 4
+#define LED_DITHER_MAX_CYCLE_MS 16
+
+// 8-bit scene colors (sRGB-like, as parsed and faded) to wire values.
+// Gamma, brightness and white balance are combined in 16 bits and rounded
+// to 8 bits once, so a dim setting keeps the precision a linear 0-255
+// brightness throws away. Owned by the render task.
+class OutputStage {
+private:
+    uint16_t _level;        // brightness as linear light, 0-65535
+    CRGB _whiteBalance;
+    uint32_t _scale[3];     // _level x white balance + 1, per channel
+    bool _dither;
+
+    void updateScale();
+
+public:
+    OutputStage();
+    // Slider position; perceptually even steps (CIE L*)
+    void setBrightnessPercent(uint8_t percent);
+    void setWhiteBalance(const CRGB& balance);
+    // Off: dim colors are rounded like the rest (a strip too slow to
+    // run the cycle at LED_DITHER_MAX_CYCLE_MS)
+    void setDithering(bool enabled) { _dither = enabled; }
+    uint16_t level() const { return _level; }
+
+    // One pass over count pixels, scene -> out. Colors in the dim band
+    // keep the 16-bit remainder: over LED_DITHER_FRAMES calls with phase
+    // counting up, each channel is on its upper step for the right share
+    // of frames. Returns true if any pixel was dithered, i.e. the frame
+    // only averages out when it keeps being refreshed. A pixel that is lit
+    // in the scene stays lit, at the lowest level, however dim the result.
+    bool render(const CRGB* scene, CRGB* out, uint16_t count, uint8_t phase) const;
+};
+
+// Linear light for an 8-bit channel, gamma 2.2
+uint16_t gamma16(uint8_t value);
+
+#endif // OUTPUT_STAGE_H
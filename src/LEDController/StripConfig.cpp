@@ -0,0 +1,127 @@
+// StripConfig.cpp
+#include "StripConfig.h"
+#include <strings.h>
+#include "config.h"
+
+namespace {
+    // FastLED takes pin and chipset as template arguments, so every
+    // supported combination is instantiated once and picked at runtime.
+    // Each one is a static controller with its own code, which is why the
+    // pins are limited to LED_STRIP_PINS.
+    typedef CLEDController& (*AddStripFn)(CRGB* leds, int count);
+
+    template <template <uint8_t, EOrder> class CHIPSET, EOrder ORDER, uint8_t PIN>
+    CLEDController& addStripAt(CRGB* leds, int count) {
+        return FastLED.addLeds<CHIPSET, PIN, ORDER>(leds, count);
+    }
+
+    // One chipset's entries, in LED_STRIP_PINS order
+    template <template <uint8_t, EOrder> class CHIPSET, EOrder ORDER, uint8_t... PINS>
+    struct StripRow {
+        static const AddStripFn table[sizeof...(PINS)];
+    };
+
+    template <template <uint8_t, EOrder> class CHIPSET, EOrder ORDER, uint8_t... PINS>
+    const AddStripFn StripRow<CHIPSET, ORDER, PINS...>::table[sizeof...(PINS)] = { addStripAt<CHIPSET, ORDER, PINS>... };
+
+    const uint8_t STRIP_PINS[] = { LED_STRIP_PINS };
+    const size_t STRIP_PIN_COUNT = sizeof(STRIP_PINS) / sizeof(STRIP_PINS[0]);
+
+    // Rows follow LedChipset, columns follow STRIP_PINS
+    const AddStripFn* const ADD_STRIP[] = {
+        StripRow<WS2812, GRB, LED_STRIP_PINS>::table,
+        StripRow<WS2811, RGB, LED_STRIP_PINS>::table,
+        StripRow<WS2813, GRB, LED_STRIP_PINS>::table,
+        StripRow<SK6812, GRB, LED_STRIP_PINS>::table,
+    };
+
+    const char* const CHIPSET_NAMES[] = { "ws2812", "ws2811", "ws2813", "sk6812" };
+    const size_t CHIPSET_COUNT = sizeof(CHIPSET_NAMES) / sizeof(CHIPSET_NAMES[0]);
+    static_assert(sizeof(ADD_STRIP) / sizeof(ADD_STRIP[0]) == CHIPSET_COUNT, "one row per chipset");
+
+    // Wire model. All four chipsets clock at 800 kHz: 24 bits x 1.25 us.
+    const uint32_t PIXEL_WIRE_US = 30;
+    const uint16_t LATCH_US[] = { 280, 280, 300, 80 };
+    // FastLED's RMT driver: 8 channels at 2 memory blocks each leaves 4
+    // transmitting at once; each refills half its 128-pulse buffer from
+    // an interrupt, i.e. every 64 bits
+    static_assert(sizeof(LATCH_US) / sizeof(LATCH_US[0]) == CHIPSET_COUNT, "one latch time per chipset");
+    const uint8_t RMT_PARALLEL = 4;
+    const uint32_t RMT_BITS_PER_REFILL = 64;
+
+    int pinIndex(uint8_t pin) {
+        for (size_t i = 0; i < STRIP_PIN_COUNT; i++) {
+            if (STRIP_PINS[i] == pin) return (int)i;
+        }
+        return -1;
+    }
+}
+
+const char* ledDriverName(LedDriver driver) {
+    return driver == LedDriver::I2s ? "i2s" : "rmt";
+}
+
+const char* ledChipsetName(LedChipset chipset) {
+    size_t index = (size_t)chipset;
+    return index < CHIPSET_COUNT ? CHIPSET_NAMES[index] : "unknown";
+}
+
+bool parseLedChipset(const char* data, size_t length, LedChipset& out) {
+    if (length != 6) return false;
+    for (size_t i = 0; i < CHIPSET_COUNT; i++) {
+        if (strncasecmp(data, CHIPSET_NAMES[i], length) == 0) {
+            out = (LedChipset)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool isValidStripPin(uint8_t pin) {
+    return pinIndex(pin) >= 0;
+}
+
+bool isValidStripConfig(const StripConfig& config) {
+    if (config.count < 1 || config.count > LED_MAX_COUNT) return false;
+    if (config.outputs < 1 || config.outputs > LED_MAX_OUTPUTS) return false;
+    if ((size_t)config.chipset >= CHIPSET_COUNT) return false;
+    for (uint8_t i = 0; i < config.outputs; i++) {
+        if (!isValidStripPin(config.pins[i])) return false;
+        for (uint8_t j = 0; j < i; j++) {
+            if (config.pins[j] == config.pins[i]) return false;
+        }
+    }
+    return true;
+}
+
+bool addStrips(const StripConfig& config, CRGB* leds) {
+    if (!isValidStripConfig(config)) return false;
+    // With the I2S driver FastLED holds back the DMA transfer until the
+    // last registered output has been handed its pixels, so one show()
+    // sends every zone in a single pass
+    const AddStripFn* row = ADD_STRIP[(size_t)config.chipset];
+    for (uint8_t i = 0; i < config.outputs; i++) {
+        // Color correction is OutputStage's white balance; FastLED gets
+        // finished wire values
+        row[pinIndex(config.pins[i])](leds + (size_t)i * config.count, config.count);
+    }
+    return true;
+}
+
+WireTiming modelWireTiming(LedDriver driver, LedChipset chipset, uint8_t outputs, uint16_t count) {
+    WireTiming timing = { 0, 0 };
+    if (outputs == 0 || count == 0 || (size_t)chipset >= CHIPSET_COUNT) return timing;
+
+    uint32_t stripUs = (uint32_t)count * PIXEL_WIRE_US;
+    if (driver == LedDriver::I2s) {
+        // Every output shifts out together; the CPU transposes one pixel
+        // row (one pixel of each output) per DMA buffer
+        timing.frameUs = stripUs + LATCH_US[(size_t)chipset];
+        timing.interrupts = count;
+    } else {
+        uint32_t rounds = (outputs + RMT_PARALLEL - 1) / RMT_PARALLEL;
+        timing.frameUs = rounds * stripUs + LATCH_US[(size_t)chipset];
+        timing.interrupts = outputs * (((uint32_t)count * 24 + RMT_BITS_PER_REFILL - 1) / RMT_BITS_PER_REFILL);
+    }
+    return timing;
+}
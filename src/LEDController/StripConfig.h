@@ -0,0 +1,56 @@
+// StripConfig.h
+#ifndef STRIP_CONFIG_H
+#define STRIP_CONFIG_H
+
+#include <FastLED.h>
+
+// Largest strip the firmware will allocate a buffer for, per output
+#define LED_MAX_COUNT 300
+// Parallel outputs (zones); every output carries the same length and chipset
+#define LED_MAX_OUTPUTS 8
+
+// Each chipset carries its usual wire color order
+enum class LedChipset : uint8_t { WS2812, WS2811, WS2813, SK6812 };
+
+const char* ledChipsetName(LedChipset chipset);
+// ws2812 | ws2811 | ws2813 | sk6812 (case-insensitive)
+bool parseLedChipset(const char* data, size_t length, LedChipset& out);
+
+// Output driver, fixed at build time: FastLED swaps its clockless
+// controller for the I2S parallel one when FASTLED_ESP32_I2S is defined
+enum class LedDriver : uint8_t { Rmt, I2s };
+
+#ifdef FASTLED_ESP32_I2S
+#define LED_DRIVER LedDriver::I2s
+#else
+#define LED_DRIVER LedDriver::Rmt
+#endif
+
+const char* ledDriverName(LedDriver driver);
+
+// Pixel buffer layout: output z owns leds[z * count, (z + 1) * count)
+struct StripConfig {
+    uint16_t count;                   // pixels per output, 1-LED_MAX_COUNT
+    uint8_t outputs;                  // 1-LED_MAX_OUTPUTS
+    uint8_t pins[LED_MAX_OUTPUTS];    // GPIO per output, distinct
+    LedChipset chipset;
+
+    uint16_t totalPixels() const { return (uint16_t)count * outputs; }
+};
+
+bool isValidStripPin(uint8_t pin);
+bool isValidStripConfig(const StripConfig& config);
+// Registers every output with FastLED through the pin/chipset dispatch
+// table. `leds` must hold config.totalPixels() and outlive the
+// controllers. Returns false for a config that is not in the table.
+bool addStrips(const StripConfig& config, CRGB* leds);
+
+// Modelled cost of pushing one frame out, for comparing drivers
+struct WireTiming {
+    uint32_t frameUs;     // first bit out until the last output has latched
+    uint32_t interrupts;  // buffer refills the CPU services per frame
+};
+
+WireTiming modelWireTiming(LedDriver driver, LedChipset chipset, uint8_t outputs, uint16_t count);
+
+#endif // STRIP_CONFIG_H
@@ -0,0 +1,50 @@
+// TextParse.h
+#ifndef TEXT_PARSE_H
+#define TEXT_PARSE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Span helpers shared by the command, color, easing and batch parsers.
+// None of them allocate or expect a NUL terminator.
+namespace TextParse {
+    inline char lower(char c) {
+        return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+    }
+
+    inline bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    // literal must be lower case and exactly `length` long
+    inline bool matches(const char* data, const char* literal, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            if (lower(data[i]) != literal[i]) return false;
+        }
+        return true;
+    }
+
+    inline void trimLeft(const char*& data, size_t& length) {
+        while (length > 0 && isSpace(*data)) { data++; length--; }
+    }
+
+    inline void trim(const char*& data, size_t& length) {
+        trimLeft(data, length);
+        while (length > 0 && isSpace(data[length - 1])) length--;
+    }
+
+    // The whole span as a decimal number no greater than max
+    inline bool parseDecimal(const char* data, size_t length, uint16_t max, uint16_t& out) {
+        if (length == 0) return false;
+        uint32_t value = 0;
+        for (size_t i = 0; i < length; i++) {
+            if (data[i] < '0' || data[i] > '9') return false;
+            value = value * 10 + (data[i] - '0');
+            if (value > max) return false;
+        }
+        out = (uint16_t)value;
+        return true;
+    }
+}
+
+#endif
@@ -1,66 +1,224 @@
 // MQTTManager.cpp
 #include "MQTTManager.h"
+#include "CommandBatch/CommandBatch.h"
+#include "LEDController/LEDCommand.h"
+#include "LEDController/ColorParser.h"
+#include "TaskScheduler/TaskScheduler.h"
+#include "Telemetry/Telemetry.h"
+#include "Trace/Trace.h"
+
+// Reconnect backoff: doubles per failure, randomised so a fleet that lost
+// the same broker does not come back in lock-step
+#define MQTT_BACKOFF_MIN_MS 1000
+#define MQTT_BACKOFF_MAX_MS 60000
+// Bounds the CONNACK wait of a single connect step (PubSubClient default is 15 s)
+#define MQTT_SOCKET_TIMEOUT_S 2
+// Retained state is republished at most this often; changes in between
+// coalesce into the next one
+#define MQTT_STATE_INTERVAL_MS 250
+// Commands may end in "@<device id>"; the sender ignores its own echo
+#define MQTT_ORIGIN_SEPARATOR '@'
+// Fixed header + topic length + the longest topic and payload we send
+#define MQTT_BUFFER_SIZE (7 + MQTT_TOPIC_SIZE + TELEMETRY_PAYLOAD_SIZE)
 
 MQTTManager* MQTTManager::_instance = nullptr;
 
 MQTTManager::MQTTManager(const char* broker, int port, const char* topic, LEDController* ledController,
                          const char* username, const char* password)
     : _client(_espClient), _broker(broker), _port(port), _topic(topic), 
-      _username(username), _password(password), _ledController(ledController), _connected(false)
+      _username(username), _password(password), _ledController(ledController), _connected(false),
+      _publishedVersion(0), _publishedAutoMode(true), _statePending(true), _lastStatePublish(0),
+      _lastTelemetry(0),
+      _state(State::Idle), _backoffMs(MQTT_BACKOFF_MIN_MS), _stateSince(0), _waitMs(0),
+      _disconnectedSince(0), _everConnected(false), _stats()
 {
     _instance = this;
+    _clientId[0] = '\0';
+    _deviceId[0] = '\0';
+    _setTopic[0] = '\0';
+    _stateTopic[0] = '\0';
+    _availabilityTopic[0] = '\0';
+    _telemetryTopic[0] = '\0';
 }
 
 void MQTTManager::setup()
 {
-    _client.setServer(_broker, _port);
     _client.setCallback(callback);
+    _client.setSocketTimeout(MQTT_SOCKET_TIMEOUT_S);
+    _client.setBufferSize(MQTT_BUFFER_SIZE);
+
+    uint8_t mac[6];
+    WiFi.macAddress(mac);
+    snprintf(_deviceId, sizeof(_deviceId), "%02X%02X%02X%02X%02X%02X",
+             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    snprintf(_clientId, sizeof(_clientId), "ESP32_Client_%s", _deviceId);
+    // <topic>/set is shared by the fleet; state and availability are per
+    // device and retained, so a new subscriber sees them at once
+    snprintf(_setTopic, sizeof(_setTopic), "%s/set", _topic);
+    snprintf(_stateTopic, sizeof(_stateTopic), "%s/%s/state", _topic, _deviceId);
+    snprintf(_availabilityTopic, sizeof(_availabilityTopic), "%s/%s/availability", _topic, _deviceId);
+    snprintf(_telemetryTopic, sizeof(_telemetryTopic), "%s/%s/telemetry", _topic, _deviceId);
+    _lastTelemetry = millis();
+
+    _disconnectedSince = millis();
+    enterState(State::Resolving);
+}
 
-    connect();
+void MQTTManager::enterState(State state)
+{
+    _state = state;
+    _stateSince = millis();
+}
+
+void MQTTManager::scheduleRetry()
+{
+    // "Equal jitter": wait somewhere in [backoff/2, backoff)
+    uint32_t half = _backoffMs / 2;
+    _waitMs = half + (esp_random() % (half ? half : 1));
+    _backoffMs = _backoffMs * 2 > MQTT_BACKOFF_MAX_MS ? MQTT_BACKOFF_MAX_MS : _backoffMs * 2;
+    Serial.printf("MQTT retry in %lu ms\n", _waitMs);
+    enterState(State::Backoff);
 }
 
-void MQTTManager::connect()
+void MQTTManager::onConnected()
 {
-    while (!_client.connected()) {
-        String clientId = "ESP32_Client_" + WiFi.macAddress();
-        Serial.printf("Connecting to MQTT as %s...\n", clientId.c_str());
+    unsigned long outage = millis() - _disconnectedSince;
+    _stats.disconnectedMs += outage;
+    if (_everConnected) {
+        _stats.reconnects++;
+        _stats.lastReconnectMs = outage;
+    }
+    _everConnected = true;
+    Telemetry::markBoot(BootPhase::Mqtt);
+    _backoffMs = MQTT_BACKOFF_MIN_MS;
+    _connected = true;
+
+    Serial.printf("Connected to MQTT after %lu ms offline\n", outage);
+    _client.publish(_availabilityTopic, "online", true);
+    _client.subscribe(_setTopic);
+    // Senders that predate the /set topic
+    _client.subscribe(_topic);
+    _statePending = true;
+    enterState(State::Connected);
+}
+
+void MQTTManager::stepConnection()
+{
+    switch (_state) {
+    case State::Idle:
+        return;
+
+    case State::Backoff:
+        if (millis() - _stateSince >= _waitMs) {
+            enterState(State::Resolving);
+        }
+        return;
+
+    case State::Resolving: {
+        // DNS gets its own step so a connect step never pays for it too
+        TRACE_BEGIN(MqttResolve);
+        bool resolved = WiFi.hostByName(_broker, _brokerIP);
+        TRACE_END(MqttResolve);
+        if (resolved) {
+            _client.setServer(_brokerIP, _port);
+            enterState(State::Connecting);
+        } else {
+            Serial.printf("MQTT broker %s did not resolve\n", _broker);
+            _stats.failures++;
+            scheduleRetry();
+        }
+        return;
+    }
 
-        if (_client.connect(clientId.c_str(), _username, _password)) {
-            Serial.println("Connected to MQTT!");
-            _client.subscribe(_topic);
-            _connected = true;
+    case State::Connecting: {
+        _stats.attempts++;
+        Serial.printf("Connecting to MQTT as %s...\n", _clientId);
+        // The broker marks us offline (retained) if the session dies
+        TRACE_BEGIN(MqttConnect);
+        bool connected = _client.connect(_clientId, _username, _password, _availabilityTopic, 0, true, "offline");
+        TRACE_END(MqttConnect);
+        if (connected) {
+            onConnected();
         } else {
             Serial.printf("MQTT connection failed, error code: %d\n", _client.state());
-            Serial.println("Retrying in 5 seconds...");
-            delay(5000);
+            _stats.failures++;
+            scheduleRetry();
         }
+        return;
+    }
+
+    case State::Connected:
+        if (!_client.connected()) {
+            TRACE_INSTANT(MqttLost);
+            Serial.println("MQTT connection lost");
+            _connected = false;
+            _disconnectedSince = millis();
+            scheduleRetry();
+        }
+        return;
     }
 }
 
 void MQTTManager::loop()
 {
-    if (!_client.connected()) {
-        static unsigned long lastReconnectAttempt = 0;
-        if (millis() - lastReconnectAttempt > 5000) {
-            lastReconnectAttempt = millis();
-            Serial.println("Trying to reconnect to MQTT...");
-            connect();
-        }
-    } else {
-        _client.loop();
+    stepConnection();
+    if (_state != State::Connected) return;
+
+    _client.loop();
+
+    uint16_t telemetryS = Telemetry::getIntervalS();
+    if (telemetryS && millis() - _lastTelemetry >= (unsigned long)telemetryS * 1000) {
+        publishTelemetry();
+    }
+
+    if (!_ledController) return;
+    uint32_t version = _ledController->getStateVersion();
+    bool autoMode = isScheduleAutoMode();
+    if (!_statePending && version == _publishedVersion && autoMode == _publishedAutoMode) return;
+    if (millis() - _lastStatePublish < MQTT_STATE_INTERVAL_MS) return;
+    _publishedVersion = version;
+    _publishedAutoMode = autoMode;
+    publishState();
+}
+
+void MQTTManager::publishState()
+{
+    TRACE_SCOPE(MqttPublishState);
+    char color[COLOR_TEXT_SIZE];
+    char payload[80];
+    int length = snprintf(payload, sizeof(payload), "{\"color\":\"%s\",\"brightness\":%u,\"mode\":\"%s\"}",
+                          formatColor(_ledController->getColor(), color), _ledController->getBrightnessPercent(),
+                          _publishedAutoMode ? "auto" : "manual");
+    if (length < 0 || length >= (int)sizeof(payload)) return;
+    if (_client.publish(_stateTopic, (const uint8_t*)payload, (unsigned int)length, true)) {
+        _stats.statePublishes++;
+        _statePending = false;
     }
+    _lastStatePublish = millis();
+}
 
-    static unsigned long lastPing = 0;
-    if (_client.connected() && millis() - lastPing > 10000) {
-        _client.publish(_topic, "ping");
-        lastPing = millis();
+void MQTTManager::publishTelemetry()
+{
+    TRACE_SCOPE(MqttPublishTelemetry);
+    TelemetrySample sample;
+    Telemetry::sample(sample);
+    sample.mqttReconnects = _stats.reconnects;
+    sample.mqttFailures = _stats.failures;
+    char payload[TELEMETRY_PAYLOAD_SIZE];
+    size_t length = Telemetry::format(sample, payload, sizeof(payload));
+    if (length && _client.publish(_telemetryTopic, (const uint8_t*)payload, (unsigned int)length)) {
+        _stats.telemetryPublishes++;
     }
+    _lastTelemetry = millis();
 }
 
 void MQTTManager::publishMessage(const char* message)
 {
-    Serial.printf("Publishing message: %s\n", message);
-    if (_client.publish(_topic, message)) {
+    char payload[64];
+    int length = snprintf(payload, sizeof(payload), "%s%c%s", message, MQTT_ORIGIN_SEPARATOR, _deviceId);
+    if (length < 0 || length >= (int)sizeof(payload)) return;
+    Serial.printf("Publishing message: %s\n", payload);
+    if (_client.publish(_setTopic, (const uint8_t*)payload, (unsigned int)length)) {
         Serial.println("Message published successfully");
     } else {
         Serial.println("Failed to publish message");
@@ -77,21 +235,88 @@ bool MQTTManager::isConnected()
     return _client.connected();
 }
 
+MQTTStats MQTTManager::getStats() const
+{
+    MQTTStats stats = _stats;
+    if (_state != State::Connected && _state != State::Idle) {
+        stats.disconnectedMs += millis() - _disconnectedSince;
+    }
+    return stats;
+}
+
+const LatencyHistogram& MQTTManager::getCallbackHistogram() const
+{
+    return _callbackHistogram;
+}
+
 void MQTTManager::callback(char* topic, byte* payload, unsigned int length)
 {
-    String receivedMessage;
-    for (unsigned int i = 0; i < length; i++) {
-        receivedMessage += static_cast<char>(payload[i]);
+    if (!_instance) return;
+    TRACE_SCOPE(MqttMessage);
+    uint32_t start = micros();
+    _instance->handleMessage(topic, reinterpret_cast<const char*>(payload), length);
+    _instance->_callbackHistogram.observe(micros() - start);
+}
+
+void MQTTManager::handleMessage(const char* topic, const char* message, unsigned int length)
+{
+    // Split off the origin tag; our own commands were applied when sent
+    for (unsigned int i = length; i > 0; i--) {
+        if (message[i - 1] != MQTT_ORIGIN_SEPARATOR) continue;
+        const char* origin = message + i;
+        size_t originLength = length - i;
+        if (originLength == strlen(_deviceId) && memcmp(origin, _deviceId, originLength) == 0) {
+            _stats.echoesIgnored++;
+            return;
+        }
+        length = i - 1;
+        break;
+    }
+
+    // "batch:<op>;<op>;..." applies several changes at once, see CommandBatch.h
+    static const char BATCH_PREFIX[] = "batch:";
+    const size_t prefixLength = sizeof(BATCH_PREFIX) - 1;
+    if (length > prefixLength && strncasecmp(message, BATCH_PREFIX, prefixLength) == 0) {
+        CommandBatch batch;
+        uint8_t failed;
+        if (!parseCommandBatch(message + prefixLength, length - prefixLength, batch, failed)) {
+            Serial.printf("Ignoring MQTT batch on %s, operation %u is invalid: %.*s\n", topic, failed, (int)length, message);
+            return;
+        }
+        Serial.printf("MQTT batch on %s: %u operations\n", topic, batch.operations);
+        if (!_ledController) return;
+        _stats.commands++;
+        uint8_t superseded = applyCommandBatch(batch, *_ledController);
+        if (superseded) Serial.printf("MQTT batch color (operation %u) superseded by the schedule\n", superseded);
+        return;
     }
-    receivedMessage.trim();
 
-    if (receivedMessage == "ping") {
+    LEDCommand command;
+    if (!parseLEDCommand(message, length, command)) {
+        Serial.printf("Ignoring MQTT message on %s: %.*s\n", topic, (int)length, message);
         return;
     }
-    
-    Serial.printf("MQTT message on %s: %s\n", topic, receivedMessage.c_str());
 
-    if (_instance && _instance->_ledController) {
-        _instance->_ledController->setColor(receivedMessage);
+    if (command.type == LEDCommand::Type::Ping) {
+        return;
     }
-}
\ No newline at end of file
+
+    Serial.printf("MQTT message on %s: %.*s\n", topic, (int)length, message);
+
+    if (!_ledController) return;
+    _stats.commands++;
+
+    switch (command.type) {
+    case LEDCommand::Type::Color:
+        _ledController->setColor(command.color);
+        break;
+    case LEDCommand::Type::Brightness:
+        _ledController->setBrightnessPercent(command.brightness);
+        break;
+    case LEDCommand::Type::Mode:
+        setScheduleAutoMode(command.autoMode);
+        break;
+    default:
+        break;
+    }
+}
@@ -5,10 +5,31 @@
 #include <WiFi.h>
 #include <PubSubClient.h>
 #include "LEDController/LEDController.h"
+#include "Telemetry/LatencyHistogram.h"
+
+struct MQTTStats {
+    uint32_t attempts;         // connect attempts made
+    uint32_t failures;         // attempts that did not reach CONNACK
+    uint32_t reconnects;       // successful connects after a drop
+    uint32_t disconnectedMs;   // total time spent without a session
+    uint32_t lastReconnectMs;  // drop -> connected, most recent outage
+    uint32_t commands;         // commands applied
+    uint32_t echoesIgnored;    // our own commands coming back from the broker
+    uint32_t statePublishes;   // retained state updates sent
+    uint32_t telemetryPublishes;
+};
+
+// Device id (MAC, 12 hex digits) plus the terminator
+#define MQTT_DEVICE_ID_SIZE 13
+// Longest topic built from the base topic and the device id
+#define MQTT_TOPIC_SIZE 96
 
 class MQTTManager
 {
 private:
+    // One bounded step per loop() call, never a blocking retry loop
+    enum class State { Idle, Backoff, Resolving, Connecting, Connected };
+
     static MQTTManager* _instance;
 
     LEDController* _ledController;
@@ -21,7 +42,35 @@ private:
     const char* _password;
     bool _connected;
 
-    void connect();
+    char _deviceId[MQTT_DEVICE_ID_SIZE];
+    char _setTopic[MQTT_TOPIC_SIZE];
+    char _stateTopic[MQTT_TOPIC_SIZE];
+    char _availabilityTopic[MQTT_TOPIC_SIZE];
+    char _telemetryTopic[MQTT_TOPIC_SIZE];
+    uint32_t _publishedVersion;
+    bool _publishedAutoMode;
+    bool _statePending;         // forces the next publish, e.g. after a reconnect
+    unsigned long _lastStatePublish;
+    unsigned long _lastTelemetry;
+
+    State _state;
+    IPAddress _brokerIP;
+    char _clientId[32];
+    uint32_t _backoffMs;
+    unsigned long _stateSince;
+    unsigned long _waitMs;
+    unsigned long _disconnectedSince;
+    bool _everConnected;
+    MQTTStats _stats;
+    LatencyHistogram _callbackHistogram;
+
+    void enterState(State state);
+    void scheduleRetry();
+    void stepConnection();
+    void onConnected();
+    void publishState();
+    void publishTelemetry();
+    void handleMessage(const char* topic, const char* message, unsigned int length);
 
 public:
     MQTTManager(const char* broker, int port, const char* topic, LEDController* ledController,
@@ -29,9 +78,13 @@ public:
 
     void setup();
     void loop();
+    // Sends a command to the fleet on <topic>/set, tagged with our id so
+    // our own copy is ignored when the broker echoes it back
     void publishMessage(const char* message);
     void publishColor(const char* color);
     bool isConnected();
+    MQTTStats getStats() const;
+    const LatencyHistogram& getCallbackHistogram() const;
 
     static void callback(char* topic, byte* payload, unsigned int length);
 };
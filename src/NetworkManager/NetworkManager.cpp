@@ -3,12 +3,24 @@
 #include <WiFi.h>
 #include <ESPmDNS.h>
 #include <time.h>
-#include "./Config.h"
+#include "config.h"
 #include "CaptivePortalManager/CaptivePortalManager.h"
 #include "LEDController/LEDController.h"
 #include "MQTTManager/MQTTManager.h"
 #include "WebServerManager/WebServerManager.h"
-#include "Globals.h"
+#include "globals.h"
+#include "Telemetry/Telemetry.h"
+#include "Trace/Trace.h"
+
+// A join to the remembered access point that has not come up by then
+// falls back to a scan (the AP may have moved channel or been replaced)
+#define WIFI_FAST_JOIN_TIMEOUT_MS 3000
+// Overall budget before giving up and opening the captive portal
+#define WIFI_JOIN_TIMEOUT_MS 15000
+// With a network saved, failing to join at boot is usually the router
+// still starting after the same power cut: try it again this often, with
+// the portal kept up alongside, unless someone is using the portal
+#define WIFI_PORTAL_RETRY_MS (10UL * 60UL * 1000UL)
 
 extern LEDController ledController;
 extern MQTTManager mqttManager;
@@ -17,30 +29,70 @@ extern CaptivePortalManager captivePortal;
 
 namespace NetworkManager
 {
-
-    void setupWiFiAndServices()
+    namespace
     {
+        // Nothing here blocks: each stage is advanced from loop(), so the
+        // LED, the schedule and (once up) MQTT and the web server keep
+        // running while WiFi joins
+        enum class Stage { Joining, Portal, Online };
 
-        bool connected = captivePortal.connectToWiFi();
+        Stage stage = Stage::Joining;
+        WiFiJoin join = WiFiJoin::NoCredentials;
+        unsigned long joinStart = 0;
+        unsigned long portalStart = 0;
+        bool wasConnected = false;
+        bool everConnected = false;
+        uint32_t wifiReconnects = 0;
 
-        if (!connected)
+        void startPortal()
         {
-            Serial.println("⚠️ Not connected to WiFi. Running in Access Point mode.");
-            return;
+            if (captivePortal.isActive())
+            {
+                Serial.println("⚠️ Still not connected to WiFi, portal stays up.");
+            }
+            else
+            {
+                Serial.println("🔄 Switching to AP mode and starting Captive Portal...");
+                captivePortal.start();
+                Serial.println("⚠️ Not connected to WiFi. Running in Access Point mode.");
+            }
+            stage = Stage::Portal;
+            portalStart = millis();
         }
 
-        Serial.println("✅ Connected to WiFi!");
-
-        unsigned long startTime = millis();
-        while (WiFi.status() != WL_CONNECTED && millis() - startTime < 10000)
+        void stepPortal()
         {
-            delay(500);
-            Serial.print(".");
+            captivePortal.processDNSRequests();
+            if (join == WiFiJoin::NoCredentials || millis() - portalStart < WIFI_PORTAL_RETRY_MS)
+            {
+                return;
+            }
+            portalStart = millis();
+            if (WiFi.softAPgetStationNum() > 0)
+            {
+                return;
+            }
+            // In place: a restart would cost the render state, the
+            // counters and the trace for nothing
+            Serial.println("🔄 Retrying the saved network...");
+            joinStart = millis();
+            join = captivePortal.beginConnect(true);
+            stage = Stage::Joining;
         }
 
-        if (WiFi.status() == WL_CONNECTED)
+        // First link up: everything that needs the network starts here and
+        // comes up on its own from loop()
+        void startServices()
         {
-            Serial.println("\n🚀 Starting MQTT and Web Server...");
+            TRACE_SCOPE(NetworkSetup);
+            Telemetry::markBoot(BootPhase::WiFi);
+            Serial.printf("✅ Connected to WiFi in %lu ms (%s join)\n", millis() - joinStart,
+                          join == WiFiJoin::Fast ? "fast" : "full");
+            Serial.print("📡 IP Address: ");
+            Serial.println(WiFi.localIP());
+            captivePortal.rememberConnection();
+            // Joined on a retry: the web server takes port 80 back
+            captivePortal.stop();
 
             if (MDNS.begin("otw"))
             {
@@ -51,36 +103,87 @@ namespace NetworkManager
                 Serial.println("❌ Failed to start mDNS");
             }
 
-            configTime(3 * 3600, 0, "pool.ntp.org", "time.nist.gov");
-            Serial.println("⏳ Waiting for time sync...");
-            unsigned long start = millis();
-            while (time(nullptr) < 100000 && millis() - start < 10000)
-            {
-                delay(500);
-                Serial.print(".");
-            }
-            Serial.println("\n⏰ Time synced!");
+            // SNTP syncs in the background; Timekeeper picks the time up
+            // when it arrives
+            configTzTime(TIME_ZONE, NTP_SERVER_1, NTP_SERVER_2);
 
-            ledController.setup();
+            Serial.println("🚀 Starting MQTT and Web Server...");
             mqttManager.setup();
             webServerManager.setup();
+            stage = Stage::Online;
         }
-        else
+
+        void stepJoin()
         {
-            Serial.println("\n⚠️ No internet connection, skipping MQTT setup.");
+            if (WiFi.status() == WL_CONNECTED)
+            {
+                startServices();
+                return;
+            }
+            unsigned long elapsed = millis() - joinStart;
+            if (join == WiFiJoin::Fast && elapsed >= WIFI_FAST_JOIN_TIMEOUT_MS)
+            {
+                Serial.println("⚠️ Fast reconnect failed, scanning instead.");
+                WiFi.disconnect();
+                join = captivePortal.beginConnect(false);
+            }
+            else if (elapsed >= WIFI_JOIN_TIMEOUT_MS)
+            {
+                Serial.println("❌ Failed to connect within timeout.");
+                startPortal();
+            }
+        }
+    }
+
+    void setupWiFiAndServices()
+    {
+        joinStart = millis();
+        join = captivePortal.beginConnect(true);
+        if (join == WiFiJoin::NoCredentials)
+        {
+            startPortal();
         }
     }
 
     void handleWiFiTasks()
     {
-        if (WiFi.status() == WL_CONNECTED && mqttManager.isConnected())
+        if (stage == Stage::Joining)
         {
-            mqttManager.loop();
+            // A retry from the portal leaves it (and its scans) alone for
+            // the few seconds the join takes
+            stepJoin();
+        }
+        if (stage == Stage::Portal)
+        {
+            stepPortal();
+            return;
         }
-        else
+        if (stage != Stage::Online)
         {
+            return;
+        }
+
+        // loop() also drives (re)connecting, so it must run while disconnected
+        bool connected = WiFi.status() == WL_CONNECTED;
+        if (connected && !wasConnected)
+        {
+            TRACE_INSTANT(WiFiUp);
+            if (everConnected) wifiReconnects++;
+            everConnected = true;
+        }
+        else if (!connected && wasConnected)
+        {
+            // Once per drop, not on every pass until WiFi is back
+            TRACE_INSTANT(WiFiDown);
             Serial.println("⚠️ MQTT not running - No WiFi connection.");
         }
+        wasConnected = connected;
+
+        if (connected)
+        {
+            mqttManager.loop();
+            webServerManager.loop();
+        }
 
         if (WiFi.status() != WL_CONNECTED)
         {
@@ -88,4 +191,9 @@ namespace NetworkManager
         }
     }
 
+    uint32_t getWiFiReconnects()
+    {
+        return wifiReconnects;
+    }
+
 } // namespace NetworkManager
@@ -3,8 +3,12 @@
 #define NETWORK_MANAGER_H
 
 namespace NetworkManager {
+    // Starts joining WiFi and returns at once; handleWiFiTasks() brings
+    // mDNS, NTP, MQTT and the web server up when the link is there
     void setupWiFiAndServices();
     void handleWiFiTasks();
+    // Times the link came back after dropping since boot
+    uint32_t getWiFiReconnects();
 }
 
 #endif // NETWORK_MANAGER_H
@@ -1,40 +1,186 @@
 // ScheduleManager.cpp
 #include "ScheduleManager.h"
 #include <Preferences.h>
+#include <mutex>
+
+#define PREF_NAMESPACE "schedule"
+#define PREF_KEY_GREEN "green"
+#define PREF_KEY_RED "red"
+#define PREF_KEY_WINDOWS "greenWindows"
+#define PREF_KEY_SUNRISE "sunriseMin"
+#define PREF_KEY_SUNSET "sunsetMin"
+
+namespace {
+    // Reads come from the scheduler (loop task) and the web handlers
+    // (async_tcp task), so the cached Strings are guarded.
+    std::mutex cacheMutex;
+    bool loaded = false;
+    String greenTime;
+    String redTime;
+    String greenWindows;
+    uint8_t sunriseMinutes = 0;
+    uint8_t sunsetMinutes = 0;
+    volatile uint32_t generation = 0;
+    void (*volatile changeListener)() = nullptr;
+
+    void bumpGeneration() {
+        generation = generation + 1;
+        if (changeListener) changeListener();
+    }
+    ScheduleTable table;
+
+    // Green windows win; without any, fall back to the legacy single
+    // green/red times as one window so the device still follows them.
+    void compileTable() {
+        table.compile(greenWindows.c_str());
+        if (!table.isEmpty()) return;
+
+        uint16_t start, stop;
+        if (ScheduleTable::parseTime(greenTime.c_str(), start) &&
+            ScheduleTable::parseTime(redTime.c_str(), stop)) {
+            table.addWindow(start, stop);
+        }
+    }
+}
+
+void ScheduleManager::begin() {
+    ensureLoaded();
+}
+
+void ScheduleManager::ensureLoaded() {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    if (loaded) return;
 
-String ScheduleManager::getScheduledTime(const String& key) {
     Preferences pref;
-    pref.begin("schedule", true);
-    String value = pref.getString(key.c_str(), key == "green" ? "07:00" : "21:00");
+    pref.begin(PREF_NAMESPACE, true);
+    greenTime = pref.getString(PREF_KEY_GREEN, "07:00");
+    redTime = pref.getString(PREF_KEY_RED, "21:00");
+    greenWindows = pref.getString(PREF_KEY_WINDOWS, "");
+    sunriseMinutes = pref.getUChar(PREF_KEY_SUNRISE, 0);
+    sunsetMinutes = pref.getUChar(PREF_KEY_SUNSET, 0);
     pref.end();
-    return value;
+    if (!isValidRampMinutes(sunriseMinutes)) sunriseMinutes = 0;
+    if (!isValidRampMinutes(sunsetMinutes)) sunsetMinutes = 0;
+
+    compileTable();
+    loaded = true;
+    bumpGeneration();
+}
+
+String ScheduleManager::getScheduledTime(const String& key) {
+    ensureLoaded();
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return key == PREF_KEY_GREEN ? greenTime : redTime;
 }
 
 void ScheduleManager::saveScheduledTime(const String& key, const String& time) {
+    ensureLoaded();
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    String& cached = key == PREF_KEY_GREEN ? greenTime : redTime;
+    if (cached == time) return;
+
     Preferences pref;
-    pref.begin("schedule", false);
+    pref.begin(PREF_NAMESPACE, false);
     pref.putString(key.c_str(), time);
     pref.end();
+
+    cached = time;
+    compileTable();
+    bumpGeneration();
 }
 
 String ScheduleManager::getGreenWindows() {
-    Preferences pref;
-    pref.begin("schedule", true);
-    String windows = pref.getString("greenWindows", "");
-    pref.end();
-    return windows;
+    ensureLoaded();
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return greenWindows;
 }
 
 void ScheduleManager::saveGreenWindows(const String& windows) {
+    ensureLoaded();
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    if (greenWindows == windows) return;
+
     Preferences pref;
-    pref.begin("schedule", false);
-    pref.putString("greenWindows", windows);
+    pref.begin(PREF_NAMESPACE, false);
+    pref.putString(PREF_KEY_WINDOWS, windows);
     pref.end();
+
+    greenWindows = windows;
+    compileTable();
+    bumpGeneration();
 }
 
 void ScheduleManager::clearGreenWindows() {
+    saveGreenWindows("");
+}
+
+bool ScheduleManager::isValidRampMinutes(uint8_t minutes) {
+    return minutes == 0 || (minutes >= RAMP_MIN_MINUTES && minutes <= RAMP_MAX_MINUTES);
+}
+
+void ScheduleManager::getRampMinutes(uint8_t& sunrise, uint8_t& sunset) {
+    ensureLoaded();
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    sunrise = sunriseMinutes;
+    sunset = sunsetMinutes;
+}
+
+bool ScheduleManager::saveRampMinutes(uint8_t sunrise, uint8_t sunset) {
+    if (!isValidRampMinutes(sunrise) || !isValidRampMinutes(sunset)) return false;
+    ensureLoaded();
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    if (sunrise == sunriseMinutes && sunset == sunsetMinutes) return true;
+
+    Preferences pref;
+    pref.begin(PREF_NAMESPACE, false);
+    pref.putUChar(PREF_KEY_SUNRISE, sunrise);
+    pref.putUChar(PREF_KEY_SUNSET, sunset);
+    pref.end();
+
+    sunriseMinutes = sunrise;
+    sunsetMinutes = sunset;
+    bumpGeneration();
+    return true;
+}
+
+bool ScheduleManager::saveSchedule(const String& windows, uint8_t sunrise, uint8_t sunset) {
+    if (!isValidRampMinutes(sunrise) || !isValidRampMinutes(sunset)) return false;
+    ensureLoaded();
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    bool windowsChanged = windows != greenWindows;
+    bool rampsChanged = sunrise != sunriseMinutes || sunset != sunsetMinutes;
+    if (!windowsChanged && !rampsChanged) return true;
+
     Preferences pref;
-    pref.begin("schedule", false);
-    pref.putString("greenWindows", "");
+    pref.begin(PREF_NAMESPACE, false);
+    if (windowsChanged) pref.putString(PREF_KEY_WINDOWS, windows);
+    if (rampsChanged) {
+        pref.putUChar(PREF_KEY_SUNRISE, sunrise);
+        pref.putUChar(PREF_KEY_SUNSET, sunset);
+    }
     pref.end();
+
+    if (windowsChanged) {
+        greenWindows = windows;
+        compileTable();
+    }
+    sunriseMinutes = sunrise;
+    sunsetMinutes = sunset;
+    bumpGeneration();
+    return true;
+}
+
+void ScheduleManager::setChangeListener(void (*listener)()) {
+    changeListener = listener;
+}
+
+uint32_t ScheduleManager::getGeneration() {
+    ensureLoaded();
+    return generation;
+}
+
+void ScheduleManager::getTable(ScheduleTable& out) {
+    ensureLoaded();
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    out = table;
 }
@@ -3,14 +3,40 @@
 #define SCHEDULE_MANAGER_H
 
 #include <Arduino.h>
+#include "ScheduleTable.h"
 
+// Schedule settings are loaded from NVS once and then served from RAM.
+// Every save writes through to NVS and bumps the generation counter so
+// consumers can tell when to refresh their own derived state. The green
+// windows are compiled into a ScheduleTable on every change.
 class ScheduleManager {
 public:
+    static const uint8_t RAMP_MIN_MINUTES = 10;
+    static const uint8_t RAMP_MAX_MINUTES = 60;
+
+    static void begin();
     static String getScheduledTime(const String& key);
     static void saveScheduledTime(const String& key, const String& time);
     static String getGreenWindows();
     static void saveGreenWindows(const String& windows);
     static void clearGreenWindows();
+    // Sunrise/sunset ramp lengths in minutes; 0 = off, otherwise
+    // RAMP_MIN_MINUTES..RAMP_MAX_MINUTES. Returns false if out of range.
+    static void getRampMinutes(uint8_t& sunrise, uint8_t& sunset);
+    static bool saveRampMinutes(uint8_t sunrise, uint8_t sunset);
+    static bool isValidRampMinutes(uint8_t minutes);
+    // Windows and ramps together, in one NVS session and one generation
+    // bump. Returns false (and saves nothing) for invalid ramp minutes.
+    static bool saveSchedule(const String& windows, uint8_t sunrise, uint8_t sunset);
+    static uint32_t getGeneration();
+    // Called after every generation bump, from the saving task and with
+    // the schedule locked: it should only signal, not read the schedule
+    static void setChangeListener(void (*listener)());
+    // Copies the compiled table so callers can query it without locking.
+    static void getTable(ScheduleTable& table);
+
+private:
+    static void ensureLoaded();
 };
 
-#endif // SCHEDULE_MANAGER_H
\ No newline at end of file
+#endif // SCHEDULE_MANAGER_H
@@ -0,0 +1,103 @@
+// ScheduleTable.cpp
+#include "ScheduleTable.h"
+#include <string.h>
+
+ScheduleTable::ScheduleTable() {
+    clear();
+}
+
+void ScheduleTable::clear() {
+    memset(_bits, 0, sizeof(_bits));
+    _empty = true;
+}
+
+bool ScheduleTable::parseTime(const char* text, uint16_t& minuteOfDay) {
+    // Strict "HH:MM"
+    for (int i = 0; i < 5; i++) {
+        if (i == 2 ? text[i] != ':' : (text[i] < '0' || text[i] > '9')) return false;
+    }
+    uint16_t hours = (text[0] - '0') * 10 + (text[1] - '0');
+    uint16_t minutes = (text[3] - '0') * 10 + (text[4] - '0');
+    if (hours > 23 || minutes > 59) return false;
+    minuteOfDay = hours * 60 + minutes;
+    return true;
+}
+
+bool ScheduleTable::compile(const char* windows) {
+    clear();
+    if (!windows) return true;
+
+    bool ok = true;
+    const char* p = windows;
+    while (*p) {
+        while (*p == ' ') p++;
+        const char* end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        while (len > 0 && p[len - 1] == ' ') len--;
+
+        uint16_t start, stop;
+        if (len == 11 && p[5] == '-' && parseTime(p, start) && parseTime(p + 6, stop)) {
+            addWindow(start, stop);
+        } else if (len > 0) {
+            ok = false;
+        }
+
+        if (!end) break;
+        p = end + 1;
+    }
+    return ok;
+}
+
+void ScheduleTable::addWindow(uint16_t startMinute, uint16_t endMinute) {
+    if (startMinute >= MINUTES_PER_DAY || endMinute >= MINUTES_PER_DAY) return;
+    if (startMinute == endMinute) return; // empty range, same as the web UI
+
+    for (uint16_t m = startMinute; m != endMinute; m = (m + 1) % MINUTES_PER_DAY) {
+        _bits[m >> 5] |= (1UL << (m & 31));
+    }
+    _empty = false;
+}
+
+bool ScheduleTable::isGreen(uint16_t minuteOfDay) const {
+    if (minuteOfDay >= MINUTES_PER_DAY) return false;
+    return (_bits[minuteOfDay >> 5] >> (minuteOfDay & 31)) & 1;
+}
+
+uint16_t ScheduleTable::nextTransition(uint16_t minuteOfDay) const {
+    if (minuteOfDay >= MINUTES_PER_DAY) return NO_TRANSITION;
+
+    // XOR every word against the current state so the first set bit after
+    // minuteOfDay is the next change; scan one full day with wraparound.
+    const uint32_t flip = isGreen(minuteOfDay) ? 0xFFFFFFFFUL : 0;
+    uint16_t word = minuteOfDay >> 5;
+    uint32_t diff = (_bits[word] ^ flip) & ~((2UL << (minuteOfDay & 31)) - 1);
+
+    for (uint16_t scanned = 0; scanned <= WORDS; scanned++) {
+        if (diff) {
+            return (word << 5) + __builtin_ctzl(diff);
+        }
+        word = (word + 1) % WORDS;
+        diff = _bits[word] ^ flip;
+    }
+    return NO_TRANSITION;
+}
+
+uint16_t ScheduleTable::previousTransition(uint16_t minuteOfDay) const {
+    if (minuteOfDay >= MINUTES_PER_DAY) return NO_TRANSITION;
+
+    // Mirror of nextTransition: the highest differing bit at or before
+    // minuteOfDay is the last minute of the previous run.
+    const uint32_t flip = isGreen(minuteOfDay) ? 0xFFFFFFFFUL : 0;
+    uint16_t word = minuteOfDay >> 5;
+    uint32_t diff = (_bits[word] ^ flip) & (uint32_t)((2UL << (minuteOfDay & 31)) - 1);
+
+    for (uint16_t scanned = 0; scanned <= WORDS; scanned++) {
+        if (diff) {
+            uint16_t last = (word << 5) + 31 - __builtin_clz(diff);
+            return (last + 1) % MINUTES_PER_DAY;
+        }
+        word = (word + WORDS - 1) % WORDS;
+        diff = _bits[word] ^ flip;
+    }
+    return NO_TRANSITION;
+}
@@ -0,0 +1,42 @@
+// ScheduleTable.h
+#ifndef SCHEDULE_TABLE_H
+#define SCHEDULE_TABLE_H
+
+#include <stdint.h>
+
+// Green windows compiled into a packed minute-of-day bitmap (1 bit per
+// minute, set = green). Lookups are a single shift/mask; no parsing or
+// String work happens after compile().
+class ScheduleTable {
+public:
+    static const uint16_t MINUTES_PER_DAY = 1440;
+    static const uint16_t NO_TRANSITION = 0xFFFF;
+
+    ScheduleTable();
+
+    void clear();
+    // Parses "HH:MM-HH:MM,HH:MM-HH:MM,..." (windows may wrap midnight).
+    // Malformed entries are skipped; returns false if any were.
+    bool compile(const char* windows);
+    // Marks [startMinute, endMinute) green, wrapping past midnight.
+    void addWindow(uint16_t startMinute, uint16_t endMinute);
+
+    bool isEmpty() const { return _empty; }
+    bool isGreen(uint16_t minuteOfDay) const;
+    // Minute of day at which the color next differs from the color at
+    // minuteOfDay, or NO_TRANSITION when the whole day is one color.
+    uint16_t nextTransition(uint16_t minuteOfDay) const;
+    // Minute of day at which the color at minuteOfDay began, or
+    // NO_TRANSITION when the whole day is one color.
+    uint16_t previousTransition(uint16_t minuteOfDay) const;
+
+    static bool parseTime(const char* text, uint16_t& minuteOfDay);
+
+private:
+    static const uint16_t WORDS = MINUTES_PER_DAY / 32;
+
+    uint32_t _bits[WORDS];
+    bool _empty;
+};
+
+#endif // SCHEDULE_TABLE_H
@@ -0,0 +1,206 @@
+// SettingsStore.cpp
+#include "SettingsStore.h"
+#include <Preferences.h>
+#include <mutex>
+#include "Trace/Trace.h"
+
+// Room for a few keys nobody counted yet
+#define SETTINGS_MAX_ENTRIES (SETTINGS_KEY_COUNT + 4)
+#define SETTINGS_QUIET_MS 2000
+#define SETTINGS_MAX_DELAY_MS 15000
+
+static_assert(SETTINGS_MAX_ENTRIES <= 255, "entryCount is a uint8_t");
+
+namespace {
+    enum class Kind : uint8_t { UChar, UInt, Int };
+
+    struct Entry {
+        const char* ns;
+        const char* key;
+        Kind kind;
+        uint32_t value;
+        bool dirty;
+    };
+
+    std::mutex storeMutex;
+    Entry entries[SETTINGS_MAX_ENTRIES];
+    uint8_t entryCount = 0;
+    bool anyDirty = false;
+    unsigned long firstDirtyAt = 0;
+    unsigned long lastWriteAt = 0;
+    volatile uint32_t commitCount = 0;
+    bool fullReported = false;
+
+    // Caller holds storeMutex
+    Entry* find(const char* ns, const char* key) {
+        for (uint8_t i = 0; i < entryCount; i++) {
+            if (strcmp(entries[i].ns, ns) == 0 && strcmp(entries[i].key, key) == 0) {
+                return &entries[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Caller holds storeMutex. nullptr when the table is full.
+    Entry* add(const char* ns, const char* key, Kind kind, uint32_t value) {
+        if (entryCount == SETTINGS_MAX_ENTRIES) {
+            if (!fullReported) Serial.printf("⚠️ SettingsStore full, writing %s/%s through\n", ns, key);
+            fullReported = true;
+            return nullptr;
+        }
+        Entry& entry = entries[entryCount++];
+        entry = { ns, key, kind, value, false };
+        return &entry;
+    }
+
+    // Caller holds storeMutex
+    void markDirty(Entry& entry) {
+        entry.dirty = true;
+        lastWriteAt = millis();
+        if (!anyDirty) {
+            anyDirty = true;
+            firstDirtyAt = lastWriteAt;
+        }
+    }
+
+    // Caller holds storeMutex
+    void update(Entry& entry, uint32_t value) {
+        if (entry.value == value) return;
+        entry.value = value;
+        markDirty(entry);
+    }
+
+    // Flash access; never called with storeMutex held, so setters on other
+    // tasks do not wait on it. False if the key is not stored yet.
+    bool load(const char* ns, const char* key, Kind kind, uint32_t& value) {
+        Preferences pref;
+        if (!pref.begin(ns, true)) return false;
+        bool found = pref.isKey(key);
+        if (found) {
+            switch (kind) {
+            case Kind::UChar: value = pref.getUChar(key); break;
+            case Kind::UInt:  value = pref.getUInt(key); break;
+            case Kind::Int:   value = (uint32_t)pref.getInt(key); break;
+            }
+        }
+        pref.end();
+        return found;
+    }
+
+    void store(Preferences& pref, const Entry& entry) {
+        switch (entry.kind) {
+        case Kind::UChar: pref.putUChar(entry.key, (uint8_t)entry.value); break;
+        case Kind::UInt:  pref.putUInt(entry.key, entry.value); break;
+        case Kind::Int:   pref.putInt(entry.key, (int32_t)entry.value); break;
+        }
+        commitCount = commitCount + 1;
+    }
+
+    uint32_t get(const char* ns, const char* key, Kind kind, uint32_t defaultValue) {
+        {
+            std::lock_guard<std::mutex> lock(storeMutex);
+            if (Entry* entry = find(ns, key)) return entry->value;
+        }
+        uint32_t value = defaultValue;
+        load(ns, key, kind, value);
+        std::lock_guard<std::mutex> lock(storeMutex);
+        // Another task may have added it meanwhile; its value is newer
+        Entry* entry = find(ns, key);
+        if (!entry) entry = add(ns, key, kind, value);
+        return entry ? entry->value : value;
+    }
+
+    void put(const char* ns, const char* key, Kind kind, uint32_t value) {
+        {
+            std::lock_guard<std::mutex> lock(storeMutex);
+            if (Entry* entry = find(ns, key)) {
+                update(*entry, value);
+                return;
+            }
+        }
+        uint32_t stored = 0;
+        bool inFlash = load(ns, key, kind, stored);
+        {
+            std::lock_guard<std::mutex> lock(storeMutex);
+            if (Entry* entry = find(ns, key)) {
+                update(*entry, value);
+                return;
+            }
+            // A key not in flash yet is written even if it is the default
+            if (Entry* entry = add(ns, key, kind, value)) {
+                if (!inFlash || stored != value) markDirty(*entry);
+                return;
+            }
+        }
+        if (inFlash && stored == value) return;
+        Entry entry = { ns, key, kind, value, true };
+        Preferences pref;
+        if (!pref.begin(ns, false)) return;
+        store(pref, entry);
+        pref.end();
+    }
+}
+
+uint8_t SettingsStore::getUChar(const char* ns, const char* key, uint8_t defaultValue) {
+    return (uint8_t)get(ns, key, Kind::UChar, defaultValue);
+}
+
+void SettingsStore::putUChar(const char* ns, const char* key, uint8_t value) {
+    put(ns, key, Kind::UChar, value);
+}
+
+uint32_t SettingsStore::getUInt(const char* ns, const char* key, uint32_t defaultValue) {
+    return get(ns, key, Kind::UInt, defaultValue);
+}
+
+void SettingsStore::putUInt(const char* ns, const char* key, uint32_t value) {
+    put(ns, key, Kind::UInt, value);
+}
+
+int32_t SettingsStore::getInt(const char* ns, const char* key, int32_t defaultValue) {
+    return (int32_t)get(ns, key, Kind::Int, (uint32_t)defaultValue);
+}
+
+void SettingsStore::putInt(const char* ns, const char* key, int32_t value) {
+    put(ns, key, Kind::Int, (uint32_t)value);
+}
+
+void SettingsStore::loop() {
+    {
+        std::lock_guard<std::mutex> lock(storeMutex);
+        if (!anyDirty) return;
+        unsigned long now = millis();
+        if (now - lastWriteAt < SETTINGS_QUIET_MS && now - firstDirtyAt < SETTINGS_MAX_DELAY_MS) return;
+    }
+    flush();
+}
+
+void SettingsStore::flush() {
+    // Snapshot under the lock, write to NVS outside it so setters from
+    // other tasks never wait on flash
+    Entry pending[SETTINGS_MAX_ENTRIES];
+    uint8_t pendingCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(storeMutex);
+        if (!anyDirty) return;
+        for (uint8_t i = 0; i < entryCount; i++) {
+            if (!entries[i].dirty) continue;
+            pending[pendingCount++] = entries[i];
+            entries[i].dirty = false;
+        }
+        anyDirty = false;
+    }
+
+    TRACE_SCOPE(NvsCommit);
+    Preferences pref;
+    for (uint8_t i = 0; i < pendingCount; i++) {
+        const Entry& entry = pending[i];
+        if (!pref.begin(entry.ns, false)) continue;
+        store(pref, entry);
+        pref.end();
+    }
+}
+
+uint32_t SettingsStore::getCommitCount() {
+    return commitCount;
+}
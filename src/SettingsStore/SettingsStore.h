@@ -0,0 +1,38 @@
+// SettingsStore.h
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+#include <Arduino.h>
+
+// Small integer settings with deferred NVS commits. Writes land in RAM
+// immediately; dirty values are flushed once writes have been quiet for
+// SETTINGS_QUIET_MS, at the latest SETTINGS_MAX_DELAY_MS after the first
+// unflushed write, or on flush() (call it before restarting).
+//
+// Namespace and key must be string literals (the pointers are kept).
+//
+// Every key gets a RAM entry on first use, so the table is sized from the
+// keys below; a key beyond it still works, written through to NVS on
+// every put.
+#define SETTINGS_KEYS_LED       18  // LEDController.cpp, pin keys included
+#define SETTINGS_KEYS_WIFI      7   // CaptivePortalManager.cpp, last join
+#define SETTINGS_KEYS_TELEMETRY 1
+#define SETTINGS_KEYS_TIME      2   // Timekeeper.cpp
+#define SETTINGS_KEY_COUNT \
+    (SETTINGS_KEYS_LED + SETTINGS_KEYS_WIFI + SETTINGS_KEYS_TELEMETRY + SETTINGS_KEYS_TIME)
+
+class SettingsStore {
+public:
+    static uint8_t getUChar(const char* ns, const char* key, uint8_t defaultValue);
+    static void putUChar(const char* ns, const char* key, uint8_t value);
+    static uint32_t getUInt(const char* ns, const char* key, uint32_t defaultValue);
+    static void putUInt(const char* ns, const char* key, uint32_t value);
+    static int32_t getInt(const char* ns, const char* key, int32_t defaultValue);
+    static void putInt(const char* ns, const char* key, int32_t value);
+
+    static void loop();
+    static void flush();
+    static uint32_t getCommitCount(); // NVS writes actually performed
+};
+
+#endif // SETTINGS_STORE_H
@@ -2,28 +2,241 @@
 #include "TaskScheduler.h"
 #include "ScheduleManager/ScheduleManager.h"
 #include "LEDController/LEDController.h"
+#include "Timekeeper/Timekeeper.h"
+#include "Trace/Trace.h"
+#include <esp_timer.h>
+#include <sys/time.h>
 #include <time.h>
+#include <atomic>
+#include <mutex>
 
 extern LEDController ledController;
 
-void handleScheduledLighting() {
-    static unsigned long lastCheck = 0;
-    if (millis() - lastCheck < 1000) return;
-    lastCheck = millis();
+// Anything before this is an unsynced clock (same threshold as NTP wait)
+#define MIN_VALID_EPOCH 100000
+// Upper bound on a single sleep so DST shifts and RTC drift get corrected
+#define MAX_SLEEP_US (3600ULL * 1000000ULL)
+#define STATS_WINDOW_MS (3600UL * 1000UL)
+// The scheduler task sleeps until the transition timer, a schedule edit,
+// a clock change or a mode change notifies it
+#define SCHEDULER_TASK_CORE     1
+#define SCHEDULER_TASK_PRIORITY 1
+#define SCHEDULER_TASK_STACK    4096
 
-    String greenTime = ScheduleManager::getScheduledTime("green");
-    String redTime = ScheduleManager::getScheduledTime("red");
+namespace {
+    esp_timer_handle_t transitionTimer = nullptr;
+    TaskHandle_t schedulerTask = nullptr;
+    // Set by whoever wakes the task, taken by the task
+    std::atomic<bool> transitionDue(false);
+    std::atomic<bool> scheduleChanged(true);
+    std::atomic<bool> clockChanged(false);
+    std::atomic<bool> reapplyRequested(false);
+    volatile bool autoMode = true;
+    int64_t dueAtUs = 0;
+    bool armed = false;
 
-    time_t now = time(nullptr);
-    struct tm *timeinfo = localtime(&now);
+    // Red/green come straight from the table; the ramps are the last
+    // sunriseMinutes before a green window and the first sunsetMinutes
+    // after one, both inside the red run.
+    enum class Segment : uint8_t { Red, Green, Sunrise, Sunset };
 
-    char currentTime[6];
-    sprintf(currentTime, "%02d:%02d", timeinfo->tm_hour, timeinfo->tm_min);
-    String nowStr(currentTime);
+    struct Position {
+        Segment segment;
+        LightRamp ramp;           // Sunrise/Sunset only
+        uint32_t secondsToChange; // until the segment changes, 0 = never
+    };
 
-    if (nowStr == greenTime) {
-        ledController.setColor("green");
-    } else if (nowStr == redTime) {
-        ledController.setColor("red");
+    ScheduleTable table;
+    uint8_t sunriseMinutes = 0;
+    uint8_t sunsetMinutes = 0;
+    bool forceApply = true;
+    Segment lastSegment = Segment::Red;
+
+    SchedulerStats stats = {};
+    std::mutex statsMutex;
+    uint32_t wakeupsThisHour = 0;
+    unsigned long hourStart = 0;
+
+    void wake() {
+        if (schedulerTask) xTaskNotifyGive(schedulerTask);
+    }
+
+    void onTransitionTimer(void*) {
+        transitionDue = true;
+        wake();
+    }
+
+    void onScheduleChange() {
+        scheduleChanged = true;
+        wake();
+    }
+
+    // Set from flash or NTP: boundaries need re-placing
+    void onClockChange() {
+        clockChanged = true;
+        wake();
+    }
+
+    Position locate(time_t now) {
+        struct tm timeinfo;
+        localtime_r(&now, &timeinfo);
+        uint16_t minuteOfDay = timeinfo.tm_hour * 60 + timeinfo.tm_min;
+        int64_t minuteStart = (int64_t)(now - timeinfo.tm_sec);
+        const uint16_t day = ScheduleTable::MINUTES_PER_DAY;
+
+        Position pos = { table.isGreen(minuteOfDay) ? Segment::Green : Segment::Red, LightRamp(), 0 };
+        uint16_t next = table.nextTransition(minuteOfDay);
+        if (next == ScheduleTable::NO_TRANSITION) return pos;
+
+        uint16_t minutesAhead = (next + day - minuteOfDay) % day;
+        if (minutesAhead == 0) minutesAhead = day;
+        uint16_t changeIn = minutesAhead;
+
+        if (pos.segment == Segment::Red) {
+            uint16_t since = (minuteOfDay + day - table.previousTransition(minuteOfDay)) % day;
+            if (sunriseMinutes && minutesAhead <= sunriseMinutes) {
+                // Sunrise wins over an overlapping sunset on a short night
+                int64_t wake = minuteStart + (int64_t)minutesAhead * 60;
+                pos.segment = Segment::Sunrise;
+                pos.ramp = { RampKind::Sunrise, (wake - sunriseMinutes * 60) * 1000, (uint32_t)sunriseMinutes * 60000 };
+            } else if (sunsetMinutes && since < sunsetMinutes) {
+                pos.segment = Segment::Sunset;
+                pos.ramp = { RampKind::Sunset, (minuteStart - (int64_t)since * 60) * 1000, (uint32_t)sunsetMinutes * 60000 };
+                changeIn = sunsetMinutes - since;
+            }
+            if (pos.segment != Segment::Sunrise && sunriseMinutes && minutesAhead > sunriseMinutes &&
+                minutesAhead - sunriseMinutes < changeIn) {
+                changeIn = minutesAhead - sunriseMinutes;
+            }
+        }
+        pos.secondsToChange = (uint32_t)changeIn * 60 - timeinfo.tm_sec;
+        return pos;
+    }
+
+    // Sleeps until the next segment boundary (or MAX_SLEEP_US, whichever
+    // is sooner). Returns false if the clock is not usable yet.
+    bool armNextTransition() {
+        struct timeval tv;
+        gettimeofday(&tv, nullptr);
+        if (tv.tv_sec < MIN_VALID_EPOCH) return false;
+
+        uint64_t sleepUs = MAX_SLEEP_US;
+        Position pos = locate(tv.tv_sec);
+        if (pos.secondsToChange) {
+            uint64_t untilUs = (uint64_t)pos.secondsToChange * 1000000ULL - tv.tv_usec;
+            if (untilUs < sleepUs) sleepUs = untilUs;
+        }
+
+        esp_timer_stop(transitionTimer);
+        esp_timer_start_once(transitionTimer, sleepUs);
+        dueAtUs = esp_timer_get_time() + sleepUs;
+        return true;
+    }
+
+    void evaluate(bool fromTimer, bool clockStepped) {
+        TRACE_SCOPE(ScheduleEvaluate);
+
+        // Act on edges only, so a manual color survives until the next
+        // scheduled change. The first evaluation after boot or a schedule
+        // edit always applies, which restores the right color (or the
+        // right point of a ramp) mid-window.
+        Position pos = locate(time(nullptr));
+        bool isRamp = pos.segment == Segment::Sunrise || pos.segment == Segment::Sunset;
+        if (pos.segment == lastSegment && !forceApply) {
+            // A clock step mid-ramp re-places the ramp on the new clock,
+            // unless someone has taken the LED over since
+            if (clockStepped && isRamp && autoMode && ledController.getRampKind() != RampKind::None) {
+                ledController.startRamp(CRGB::Red, pos.ramp);
+            }
+            return;
+        }
+        lastSegment = pos.segment;
+        forceApply = false;
+        if (!autoMode) return;
+
+        if (isRamp) {
+            ledController.startRamp(CRGB::Red, pos.ramp);
+        } else {
+            ledController.setColor(pos.segment == Segment::Green ? CRGB::Green : CRGB::Red);
+        }
+        TRACE_INSTANT(ScheduleTransition);
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.transitions++;
+        if (fromTimer) {
+            int64_t lateUs = esp_timer_get_time() - dueAtUs;
+            stats.lastLatencyUs = lateUs > 0 ? (uint32_t)lateUs : 0;
+        }
+    }
+
+    void countWakeup() {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        if (millis() - hourStart >= STATS_WINDOW_MS) {
+            stats.wakeupsLastHour = wakeupsThisHour;
+            wakeupsThisHour = 0;
+            hourStart = millis();
+            Serial.printf("⏱️ Scheduler: %u wakeups in the last hour\n", stats.wakeupsLastHour);
+        }
+        stats.wakeups++;
+        wakeupsThisHour++;
+    }
+
+    void step() {
+        if (scheduleChanged.exchange(false)) {
+            ScheduleManager::getTable(table);
+            ScheduleManager::getRampMinutes(sunriseMinutes, sunsetMinutes);
+            forceApply = true;
+        }
+        if (reapplyRequested.exchange(false) && autoMode) forceApply = true;
+        bool fromTimer = transitionDue.exchange(false);
+        bool clockStepped = clockChanged.exchange(false);
+
+        // Nothing to do between boundaries unless the schedule or clock moved
+        if (armed && !fromTimer && !forceApply && !clockStepped) return;
+        // Unsynced: there is nothing to arm against until the clock is set
+        if (time(nullptr) < MIN_VALID_EPOCH) {
+            armed = false;
+            return;
+        }
+
+        evaluate(fromTimer, clockStepped);
+        armed = armNextTransition();
+    }
+
+    void schedulerLoop(void*) {
+        for (;;) {
+            step();
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            countWakeup();
+        }
     }
 }
+
+void setupScheduledLighting() {
+    esp_timer_create_args_t args = {};
+    args.callback = &onTransitionTimer;
+    args.name = "schedule";
+    esp_timer_create(&args, &transitionTimer);
+    hourStart = millis();
+    ScheduleManager::setChangeListener(onScheduleChange);
+    Timekeeper::setClockListener(onClockChange);
+    xTaskCreatePinnedToCore(schedulerLoop, "sched", SCHEDULER_TASK_STACK, nullptr, SCHEDULER_TASK_PRIORITY,
+                            &schedulerTask, SCHEDULER_TASK_CORE);
+}
+
+void setScheduleAutoMode(bool enabled) {
+    bool reapply = enabled && !autoMode;
+    autoMode = enabled;
+    if (reapply) {
+        reapplyRequested = true;
+        wake();
+    }
+}
+
+bool isScheduleAutoMode() {
+    return autoMode;
+}
+
+SchedulerStats getSchedulerStats() {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return stats;
+}
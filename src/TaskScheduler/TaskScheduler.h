@@ -2,6 +2,23 @@
 #ifndef TASK_SCHEDULER_H
 #define TASK_SCHEDULER_H
 
-void handleScheduledLighting();
+#include <stdint.h>
+
+struct SchedulerStats {
+    uint32_t wakeups;          // times the scheduler task woke up
+    uint32_t transitions;      // color changes applied by the schedule
+    uint32_t lastLatencyUs;    // boundary -> color applied, last transition
+    uint32_t wakeupsLastHour;  // task wakeups during the previous full hour
+};
+
+// Starts the scheduler task. It blocks until the transition timer, a
+// schedule edit, a clock change or a return to auto mode wakes it, so
+// between transitions it costs no CPU at all.
+void setupScheduledLighting();
+// Manual mode stops schedule edges from changing the color; returning to
+// auto mode re-applies the current scheduled color.
+void setScheduleAutoMode(bool autoMode);
+bool isScheduleAutoMode();
+SchedulerStats getSchedulerStats();
 
 #endif // TASK_SCHEDULER_H
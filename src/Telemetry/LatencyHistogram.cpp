@@ -0,0 +1,35 @@
+// LatencyHistogram.cpp
+#include "LatencyHistogram.h"
+
+const uint32_t LatencyHistogram::BOUNDS_US[BUCKETS - 1] = {
+    50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000,
+};
+
+namespace {
+    // BOUNDS_US as Prometheus writes them, so a scrape formats no floats
+    const char* const BOUND_LABELS[LatencyHistogram::BUCKETS - 1] = {
+        "5e-05", "0.0001", "0.00025", "0.0005", "0.001", "0.0025", "0.005", "0.01", "0.025", "0.05", "0.1",
+    };
+}
+
+LatencyHistogram::LatencyHistogram() : _buckets{}, _count(0), _sumUs(0) {}
+
+void LatencyHistogram::observe(uint32_t us) {
+    size_t bucket = 0;
+    while (bucket < BUCKETS - 1 && us > BOUNDS_US[bucket]) bucket++;
+    _buckets[bucket] = _buckets[bucket] + 1;
+    _sumUs = _sumUs + us;
+    _count = _count + 1;
+}
+
+void LatencyHistogram::writePrometheus(Print& out, const char* name, const char* help) const {
+    out.printf("# HELP %s %s\n# TYPE %s histogram\n", name, help, name);
+    uint32_t cumulative = 0;
+    for (size_t i = 0; i < BUCKETS; i++) {
+        cumulative += _buckets[i];
+        out.printf("%s_bucket{le=\"%s\"} %u\n", name, i < BUCKETS - 1 ? BOUND_LABELS[i] : "+Inf", (unsigned)cumulative);
+    }
+    uint64_t sumUs = _sumUs;
+    out.printf("%s_sum %u.%06u\n%s_count %u\n", name, (unsigned)(sumUs / 1000000), (unsigned)(sumUs % 1000000), name,
+               (unsigned)cumulative);
+}
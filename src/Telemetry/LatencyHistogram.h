@@ -0,0 +1,30 @@
+// LatencyHistogram.h
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <Arduino.h>
+
+// Fixed-bucket duration histogram in the shape Prometheus expects. Each
+// histogram has one writing task; a scrape running concurrently may see
+// one observation half-applied, which the next scrape corrects.
+class LatencyHistogram {
+public:
+    // 50 us .. 100 ms, plus +Inf
+    static const size_t BUCKETS = 12;
+    static const uint32_t BOUNDS_US[BUCKETS - 1];
+
+    LatencyHistogram();
+    void observe(uint32_t us);
+    uint32_t count() const { return _count; }
+
+    // <name>_bucket{le="..."} (cumulative), <name>_sum and <name>_count,
+    // in seconds
+    void writePrometheus(Print& out, const char* name, const char* help) const;
+
+private:
+    volatile uint32_t _buckets[BUCKETS];
+    volatile uint32_t _count;
+    volatile uint64_t _sumUs;
+};
+
+#endif // LATENCY_HISTOGRAM_H
@@ -0,0 +1,159 @@
+// Telemetry.cpp
+#include "Telemetry.h"
+#include <WiFi.h>
+#include <esp_timer.h>
+#include <stdio.h>
+#include <string.h>
+#include "SettingsStore/SettingsStore.h"
+
+#define PREF_NAMESPACE "telemetry"
+#define PREF_KEY_INTERVAL "intervalS"
+
+namespace {
+    constexpr char PAYLOAD_FORMAT[] =
+        "{\"up\":%u,\"heap\":%u,\"minHeap\":%u,\"block\":%u,"
+        "\"loop\":{\"n\":%u,\"p50\":%u,\"p90\":%u,\"p99\":%u,\"max\":%u},"
+        "\"rssi\":%d,\"mqtt\":{\"reconnects\":%u,\"failures\":%u},"
+        "\"boot\":{\"light\":%ld,\"wifi\":%ld,\"time\":%ld,\"mqtt\":%ld}}";
+    // Eleven "%u", one "%d" and four "%ld" are not part of the output text
+    static_assert(sizeof(PAYLOAD_FORMAT) - 1 - (11 * 2 + 2 + 4 * 3) == TELEMETRY_PAYLOAD_TEXT,
+                  "TELEMETRY_PAYLOAD_TEXT does not match PAYLOAD_FORMAT");
+
+    // Four linear sub-buckets per power of two: values 0-3 get a bucket
+    // each, then [4,5) [5,6) ... [8,10) [10,12) ... up to 2^24 us
+    const uint8_t SUB_BITS = 2;
+    const uint8_t SUB_BUCKETS = 1 << SUB_BITS;
+    const uint8_t MAX_EXPONENT = 24;
+    const size_t BUCKET_COUNT = (MAX_EXPONENT - SUB_BITS + 2) * SUB_BUCKETS;
+
+    uint32_t buckets[BUCKET_COUNT];
+    uint32_t loops = 0;
+    uint32_t maxUs = 0;
+
+    size_t bucketOf(uint32_t us) {
+        if (us < SUB_BUCKETS) return us;
+        uint8_t exponent = 31 - __builtin_clz(us);
+        if (exponent > MAX_EXPONENT) return BUCKET_COUNT - 1;
+        uint32_t sub = (us >> (exponent - SUB_BITS)) & (SUB_BUCKETS - 1);
+        return (exponent - SUB_BITS + 1) * SUB_BUCKETS + sub;
+    }
+
+    // Largest value that lands in the bucket
+    uint32_t bucketLimit(size_t index) {
+        if (index < SUB_BUCKETS) return index;
+        uint8_t exponent = index / SUB_BUCKETS + SUB_BITS - 1;
+        uint32_t sub = index % SUB_BUCKETS;
+        return ((SUB_BUCKETS + sub + 1) << (exponent - SUB_BITS)) - 1;
+    }
+
+    uint32_t percentile(uint32_t perMille) {
+        if (loops == 0) return 0;
+        uint32_t rank = (uint32_t)(((uint64_t)loops * perMille + 999) / 1000);
+        uint32_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                uint32_t limit = bucketLimit(i);
+                return limit < maxUs ? limit : maxUs;
+            }
+        }
+        return maxUs;
+    }
+
+    LatencyHistogram loopHistogram;
+    TaskHandle_t loopTask = nullptr;
+
+    const char* const BOOT_PHASE_NAMES[] = { "light", "wifi", "time", "mqtt" };
+    static_assert(sizeof(BOOT_PHASE_NAMES) / sizeof(BOOT_PHASE_NAMES[0]) == (size_t)BootPhase::Count,
+                  "one name per boot phase");
+    volatile int32_t bootMs[(size_t)BootPhase::Count] = { -1, -1, -1, -1 };
+
+    uint16_t intervalS = 0;
+    bool intervalLoaded = false;
+}
+
+void Telemetry::recordLoop(uint32_t us) {
+    buckets[bucketOf(us)]++;
+    loops++;
+    if (us > maxUs) maxUs = us;
+    loopHistogram.observe(us);
+}
+
+const LatencyHistogram& Telemetry::getLoopHistogram() {
+    return loopHistogram;
+}
+
+void Telemetry::setLoopTask(TaskHandle_t task) {
+    loopTask = task;
+}
+
+uint32_t Telemetry::getLoopStackFree() {
+    return loopTask ? uxTaskGetStackHighWaterMark(loopTask) : 0;
+}
+
+void Telemetry::sample(TelemetrySample& out) {
+    out.uptimeS = (uint32_t)(esp_timer_get_time() / 1000000);
+    out.freeHeap = ESP.getFreeHeap();
+    out.minFreeHeap = ESP.getMinFreeHeap();
+    out.largestBlock = ESP.getMaxAllocHeap();
+    out.loops = loops;
+    out.loopP50Us = percentile(500);
+    out.loopP90Us = percentile(900);
+    out.loopP99Us = percentile(990);
+    out.loopMaxUs = maxUs;
+    out.rssi = WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0;
+    for (size_t i = 0; i < (size_t)BootPhase::Count; i++) out.bootMs[i] = bootMs[i];
+
+    memset(buckets, 0, sizeof(buckets));
+    loops = 0;
+    maxUs = 0;
+}
+
+size_t Telemetry::format(const TelemetrySample& sample, char* buffer, size_t size) {
+    static_assert((size_t)BootPhase::Count == 4, "format() lists every boot phase");
+    int length = snprintf(buffer, size, PAYLOAD_FORMAT,
+                          (unsigned)sample.uptimeS, (unsigned)sample.freeHeap, (unsigned)sample.minFreeHeap,
+                          (unsigned)sample.largestBlock, (unsigned)sample.loops, (unsigned)sample.loopP50Us,
+                          (unsigned)sample.loopP90Us, (unsigned)sample.loopP99Us, (unsigned)sample.loopMaxUs,
+                          sample.rssi, (unsigned)sample.mqttReconnects, (unsigned)sample.mqttFailures,
+                          (long)sample.bootMs[0], (long)sample.bootMs[1], (long)sample.bootMs[2],
+                          (long)sample.bootMs[3]);
+    if (length < 0 || (size_t)length >= size) return 0;
+    return (size_t)length;
+}
+
+void Telemetry::markBoot(BootPhase phase) {
+    size_t index = (size_t)phase;
+    if (index >= (size_t)BootPhase::Count || bootMs[index] >= 0) return;
+    bootMs[index] = (int32_t)(esp_timer_get_time() / 1000);
+}
+
+int32_t Telemetry::getBootMs(BootPhase phase) {
+    return (size_t)phase < (size_t)BootPhase::Count ? bootMs[(size_t)phase] : -1;
+}
+
+const char* Telemetry::bootPhaseName(BootPhase phase) {
+    return (size_t)phase < (size_t)BootPhase::Count ? BOOT_PHASE_NAMES[(size_t)phase] : "unknown";
+}
+
+uint16_t Telemetry::getIntervalS() {
+    if (!intervalLoaded) {
+        uint32_t stored = SettingsStore::getUInt(PREF_NAMESPACE, PREF_KEY_INTERVAL, TELEMETRY_DEFAULT_INTERVAL_S);
+        intervalS = stored <= TELEMETRY_MAX_INTERVAL_S && isValidIntervalS((uint16_t)stored)
+                        ? (uint16_t)stored : TELEMETRY_DEFAULT_INTERVAL_S;
+        intervalLoaded = true;
+    }
+    return intervalS;
+}
+
+bool Telemetry::setIntervalS(uint16_t seconds) {
+    if (!isValidIntervalS(seconds)) return false;
+    intervalS = seconds;
+    intervalLoaded = true;
+    SettingsStore::putUInt(PREF_NAMESPACE, PREF_KEY_INTERVAL, seconds);
+    return true;
+}
+
+bool Telemetry::isValidIntervalS(uint16_t seconds) {
+    return seconds == 0 || (seconds >= TELEMETRY_MIN_INTERVAL_S && seconds <= TELEMETRY_MAX_INTERVAL_S);
+}
@@ -0,0 +1,74 @@
+// Telemetry.h
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include "LatencyHistogram.h"
+
+#define TELEMETRY_DEFAULT_INTERVAL_S 60
+#define TELEMETRY_MIN_INTERVAL_S     10
+#define TELEMETRY_MAX_INTERVAL_S     3600
+// Largest payload format() produces, plus the terminator: the fixed JSON
+// text, 11 uint32 fields of up to 10 digits, rssi as "-128" and four
+// boot times as "-2147483648". Telemetry.cpp checks the text length.
+#define TELEMETRY_PAYLOAD_TEXT 162
+#define TELEMETRY_PAYLOAD_SIZE (TELEMETRY_PAYLOAD_TEXT + 11 * 10 + 4 + 4 * 11 + 1)
+
+// Milestones of one boot, in the order they normally happen
+enum class BootPhase : uint8_t {
+    Light,   // first frame on the strip
+    WiFi,    // station link up
+    Time,    // first NTP sync
+    Mqtt,    // first broker session
+    Count
+};
+
+// One snapshot of device health; loop figures cover the window since the
+// previous snapshot
+struct TelemetrySample {
+    uint32_t uptimeS;
+    uint32_t freeHeap;
+    uint32_t minFreeHeap;      // low-water mark since boot
+    uint32_t largestBlock;     // biggest single allocation possible
+    uint32_t loops;            // loop() iterations in the window
+    uint32_t loopP50Us;        // percentiles are bucket upper bounds,
+    uint32_t loopP90Us;        // within 25% of the true value
+    uint32_t loopP99Us;
+    uint32_t loopMaxUs;        // exact
+    int8_t rssi;               // 0 while WiFi is down
+    uint32_t mqttReconnects;
+    uint32_t mqttFailures;
+    int32_t bootMs[(size_t)BootPhase::Count];   // -1 = not reached yet
+};
+
+// Samples health figures for the MQTT telemetry topic. Loop timings go
+// into a fixed log-scale histogram, so recording is O(1) and nothing is
+// allocated.
+class Telemetry {
+public:
+    // Time spent in one loop() pass, excluding its idle delay
+    static void recordLoop(uint32_t us);
+    // Every recorded pass since boot, for /metrics
+    static const LatencyHistogram& getLoopHistogram();
+    // The task running loop(); call from setup()
+    static void setLoopTask(TaskHandle_t task);
+    static uint32_t getLoopStackFree();
+    // Fills everything but the MQTT counters and starts a new window
+    static void sample(TelemetrySample& out);
+    // Compact JSON into buffer (TELEMETRY_PAYLOAD_SIZE bytes); returns the length
+    static size_t format(const TelemetrySample& sample, char* buffer, size_t size);
+
+    // Records when a boot milestone was first reached; later calls are
+    // ignored. Safe from any task.
+    static void markBoot(BootPhase phase);
+    // Milliseconds since boot, -1 if not reached yet
+    static int32_t getBootMs(BootPhase phase);
+    static const char* bootPhaseName(BootPhase phase);
+
+    // Seconds between publishes; 0 = off. Persisted.
+    static uint16_t getIntervalS();
+    static bool setIntervalS(uint16_t seconds);
+    static bool isValidIntervalS(uint16_t seconds);
+};
+
+#endif // TELEMETRY_H
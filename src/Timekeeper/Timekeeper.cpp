@@ -0,0 +1,198 @@
+// Timekeeper.cpp
+#include "Timekeeper.h"
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <time.h>
+#include "config.h"
+#include "SettingsStore/SettingsStore.h"
+#include "Telemetry/Telemetry.h"
+
+#define PREF_NAMESPACE "time"
+#define PREF_KEY_EPOCH "epoch"     // last sync, or offline the last checkpoint
+#define PREF_KEY_DRIFT "driftPpb"
+
+// Anything before this is an unset clock (same threshold as the scheduler)
+#define MIN_VALID_EPOCH 100000
+// How stale the flash copy of the time may get
+#define CHECKPOINT_INTERVAL_MS (3600UL * 1000UL)
+// A sync older than this means the clock is in holdover
+#define SYNC_FRESH_US (2 * 3600LL * 1000000LL)
+// Drift is measured between syncs at least this far apart...
+#define DRIFT_MIN_SPAN_US (1800LL * 1000000LL)
+// ...and anything faster than 500 ppm is a clock step, not a crystal
+#define DRIFT_MAX_RATIO 2000
+// Written back to flash once it has moved this much
+#define DRIFT_PERSIST_PPB 1000
+#define DRIFT_UNKNOWN INT32_MIN
+// Holdover corrections go in once they add up to this
+#define CORRECTION_STEP_US 20000
+#define CORRECTION_CHECK_MS 10000
+
+namespace {
+    // Filled in by the SNTP callback (lwIP task), consumed by loop()
+    volatile bool syncPending = false;
+    volatile int64_t pendingMonoUs = 0;
+    volatile int64_t pendingEpochUs = 0;
+    volatile uint32_t clockGeneration = 0;
+    void (*volatile clockListener)() = nullptr;
+
+    TimeSource source = TimeSource::None;
+    // Last point where the clock was known (or assumed) good, on this
+    // boot's esp_timer; the clock since then is anchor + elapsed + correction
+    bool anchored = false;
+    bool anchorIsSync = false;
+    int64_t anchorMonoUs = 0;
+    int64_t anchorEpochUs = 0;
+    int64_t correctedUs = 0;
+
+    int32_t driftPpb = DRIFT_UNKNOWN;
+    int32_t storedDriftPpb = DRIFT_UNKNOWN;
+    int32_t lastStepMs = 0;
+    uint32_t syncs = 0;
+    unsigned long lastCheckpoint = 0;
+    unsigned long lastCorrectionCheck = 0;
+
+    const char* const SOURCE_NAMES[] = { "none", "restored", "holdover", "ntp" };
+
+    int64_t nowEpochUs() {
+        struct timeval tv;
+        gettimeofday(&tv, nullptr);
+        return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+    }
+
+    void setClock(int64_t epochUs) {
+        struct timeval tv;
+        tv.tv_sec = (time_t)(epochUs / 1000000);
+        tv.tv_usec = (suseconds_t)(epochUs % 1000000);
+        settimeofday(&tv, nullptr);
+    }
+
+    void bumpClockGeneration() {
+        clockGeneration = clockGeneration + 1;
+        if (clockListener) clockListener();
+    }
+
+    void anchor(bool isSync, int64_t monoUs, int64_t epochUs) {
+        anchored = true;
+        anchorIsSync = isSync;
+        anchorMonoUs = monoUs;
+        anchorEpochUs = epochUs;
+        correctedUs = 0;
+    }
+
+    void checkpoint() {
+        SettingsStore::putUInt(PREF_NAMESPACE, PREF_KEY_EPOCH, (uint32_t)time(nullptr));
+        lastCheckpoint = millis();
+    }
+
+    void onTimeSync(struct timeval* tv) {
+        pendingMonoUs = esp_timer_get_time();
+        pendingEpochUs = (int64_t)tv->tv_sec * 1000000 + tv->tv_usec;
+        syncPending = true;
+        bumpClockGeneration();
+        Telemetry::markBoot(BootPhase::Time);
+    }
+
+    // Compares the sync with where the RTC alone would have put the clock
+    void measureDrift(int64_t spanUs, int64_t errorUs) {
+        if (spanUs < DRIFT_MIN_SPAN_US || llabs(errorUs) > spanUs / DRIFT_MAX_RATIO) return;
+        int32_t measured = (int32_t)(errorUs * 1000000000LL / spanUs);
+        // Smooth over a few hours so one slow NTP answer does not swing it
+        driftPpb = driftPpb == DRIFT_UNKNOWN ? measured : (int32_t)(((int64_t)driftPpb * 3 + measured) / 4);
+        if (storedDriftPpb == DRIFT_UNKNOWN || abs(driftPpb - storedDriftPpb) >= DRIFT_PERSIST_PPB) {
+            SettingsStore::putInt(PREF_NAMESPACE, PREF_KEY_DRIFT, driftPpb);
+            storedDriftPpb = driftPpb;
+        }
+    }
+
+    void applySync() {
+        syncPending = false;
+        int64_t monoUs = pendingMonoUs;
+        int64_t epochUs = pendingEpochUs;
+        if (anchored) {
+            int64_t spanUs = monoUs - anchorMonoUs;
+            lastStepMs = (int32_t)((epochUs - (anchorEpochUs + spanUs + correctedUs)) / 1000);
+            if (anchorIsSync) measureDrift(spanUs, anchorEpochUs + spanUs - epochUs);
+        }
+        anchor(true, monoUs, epochUs);
+        source = TimeSource::Ntp;
+        syncs++;
+        if (syncs == 1 || millis() - lastCheckpoint >= CHECKPOINT_INTERVAL_MS) checkpoint();
+    }
+
+    // Moves the clock towards anchor + elapsed * (1 - drift)
+    void correctDrift() {
+        if (!anchored || driftPpb == DRIFT_UNKNOWN) return;
+        int64_t targetUs = -(esp_timer_get_time() - anchorMonoUs) * driftPpb / 1000000000LL;
+        int64_t deltaUs = targetUs - correctedUs;
+        if (llabs(deltaUs) < CORRECTION_STEP_US) return;
+        setClock(nowEpochUs() + deltaUs);
+        correctedUs = targetUs;
+    }
+}
+
+void Timekeeper::begin() {
+    // The schedule is local time whether or not NTP is ever reached
+    setenv("TZ", TIME_ZONE, 1);
+    tzset();
+    driftPpb = storedDriftPpb = SettingsStore::getInt(PREF_NAMESPACE, PREF_KEY_DRIFT, DRIFT_UNKNOWN);
+
+    if (time(nullptr) >= MIN_VALID_EPOCH) {
+        // A reset rather than a power loss: the RTC kept counting
+        source = TimeSource::Holdover;
+    }
+#if TIME_RESTORE_FROM_FLASH
+    else {
+        uint32_t epoch = SettingsStore::getUInt(PREF_NAMESPACE, PREF_KEY_EPOCH, 0);
+        if (epoch >= MIN_VALID_EPOCH) {
+            setClock((int64_t)epoch * 1000000);
+            source = TimeSource::Restored;
+        }
+    }
+#endif
+    if (source != TimeSource::None) {
+        anchor(false, esp_timer_get_time(), nowEpochUs());
+        bumpClockGeneration();
+        time_t now = time(nullptr);
+        struct tm local;
+        localtime_r(&now, &local);
+        Serial.printf("🕒 Clock %s at %02d:%02d, drift %ld ppb\n", sourceName(source), local.tm_hour, local.tm_min,
+                      driftPpb == DRIFT_UNKNOWN ? 0L : (long)driftPpb);
+    }
+    sntp_set_time_sync_notification_cb(onTimeSync);
+    lastCheckpoint = millis();
+}
+
+void Timekeeper::loop() {
+    if (syncPending) applySync();
+    if (millis() - lastCorrectionCheck >= CORRECTION_CHECK_MS) {
+        lastCorrectionCheck = millis();
+        correctDrift();
+    }
+    if (source != TimeSource::None && millis() - lastCheckpoint >= CHECKPOINT_INTERVAL_MS) checkpoint();
+}
+
+void Timekeeper::setClockListener(void (*listener)()) {
+    clockListener = listener;
+}
+
+uint32_t Timekeeper::getClockGeneration() {
+    return clockGeneration;
+}
+
+TimeStatus Timekeeper::getStatus() {
+    TimeStatus status;
+    int64_t sinceSyncUs = anchorIsSync ? esp_timer_get_time() - anchorMonoUs : 0;
+    status.source = source == TimeSource::Ntp && sinceSyncUs > SYNC_FRESH_US ? TimeSource::Holdover : source;
+    status.syncs = syncs;
+    status.sinceSyncS = (uint32_t)(sinceSyncUs / 1000000);
+    status.driftPpb = driftPpb == DRIFT_UNKNOWN ? 0 : driftPpb;
+    status.lastStepMs = lastStepMs;
+    return status;
+}
+
+const char* Timekeeper::sourceName(TimeSource source) {
+    return (size_t)source < sizeof(SOURCE_NAMES) / sizeof(SOURCE_NAMES[0]) ? SOURCE_NAMES[(size_t)source] : "unknown";
+}
@@ -0,0 +1,42 @@
+// Timekeeper.h
+#ifndef TIMEKEEPER_H
+#define TIMEKEEPER_H
+
+#include <Arduino.h>
+
+// Where the wall clock currently comes from
+enum class TimeSource : uint8_t {
+    None,      // never set: the schedule waits
+    Restored,  // last checkpoint from flash after a power loss; behind by the outage
+    Holdover,  // free-running on the RTC since the last sync (or a reset), drift-corrected
+    Ntp        // synced recently
+};
+
+struct TimeStatus {
+    TimeSource source;
+    uint32_t syncs;       // NTP syncs since boot
+    uint32_t sinceSyncS;  // 0 before the first sync
+    int32_t driftPpb;     // RTC rate error, positive = runs fast
+    int32_t lastStepMs;   // correction made by the last sync: the holdover error
+};
+
+// Keeps the wall clock usable without the network. The RTC runs the
+// clock; every NTP sync re-disciplines it and refines the drift estimate,
+// and in between the drift is corrected in small steps. The drift and a
+// checkpoint of the time are kept in flash, so the clock survives a power
+// loss (approximately) and starts out corrected after a reset.
+class Timekeeper {
+public:
+    // Before the scheduler and the network: time zone, restored clock
+    static void begin();
+    static void loop();
+    // Bumped whenever the clock is set (restore, NTP sync), not for the
+    // small drift corrections
+    static uint32_t getClockGeneration();
+    // Called on every clock generation bump, possibly from the SNTP task
+    static void setClockListener(void (*listener)());
+    static TimeStatus getStatus();
+    static const char* sourceName(TimeSource source);
+};
+
+#endif // TIMEKEEPER_H
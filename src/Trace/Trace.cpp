@@ -0,0 +1,171 @@
+// Trace.cpp
+#include "Trace.h"
+
+#if OTWU_TRACE
+
+#include <esp_timer.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+
+namespace {
+    const char* const NAMES[] = {
+        "network.setup",
+        "wifi.up",
+        "wifi.down",
+        "mqtt.resolve",
+        "mqtt.connect",
+        "mqtt.lost",
+        "mqtt.message",
+        "mqtt.publishState",
+        "mqtt.publishTelemetry",
+        "led.frame",
+        "led.show",
+        "schedule.evaluate",
+        "schedule.transition",
+        "http.request",
+        "nvs.commit",
+    };
+    static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == (size_t)TraceName::Count, "one name per trace point");
+    static_assert((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0, "ring size must be a power of two");
+
+    // sequence is the slot's claim number + 1 once the event is complete,
+    // 0 while it is being written
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        TraceEvent event;
+    };
+
+    struct Ring {
+        std::atomic<uint32_t> head;
+        Slot slots[TRACE_RING_SIZE];
+    };
+
+    Ring rings[TRACE_CORES];
+
+    const char* const PHASES[] = { "B", "E", "i" };
+}
+
+const char* traceNameText(TraceName name) {
+    return (size_t)name < (size_t)TraceName::Count ? NAMES[(size_t)name] : "unknown";
+}
+
+void Trace::record(TracePhase phase, TraceName name) {
+    uint8_t core = (uint8_t)xPortGetCoreID();
+    Ring& ring = rings[core];
+    uint32_t claim = ring.head.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = ring.slots[claim & (TRACE_RING_SIZE - 1)];
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.event.timestampUs = micros();
+    slot.event.task = xTaskGetCurrentTaskHandle();
+    slot.event.phase = phase;
+    slot.event.name = name;
+    slot.event.core = core;
+    slot.sequence.store(claim + 1, std::memory_order_release);
+}
+
+size_t Trace::snapshot(TraceEvent* out, size_t capacity) {
+    size_t count = 0;
+    for (Ring& ring : rings) {
+        uint32_t head = ring.head.load(std::memory_order_acquire);
+        uint32_t claim = head > TRACE_RING_SIZE ? head - TRACE_RING_SIZE : 0;
+        for (; claim != head && count < capacity; claim++) {
+            Slot& slot = ring.slots[claim & (TRACE_RING_SIZE - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != claim + 1) continue;
+            TraceEvent event = slot.event;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // Overwritten while it was copied
+            if (slot.sequence.load(std::memory_order_relaxed) != claim + 1) continue;
+            out[count++] = event;
+        }
+    }
+    return count;
+}
+
+TraceJsonWriter::TraceJsonWriter()
+    : _events(new TraceEvent[TRACE_CORES * TRACE_RING_SIZE]), _count(0), _next(0), _stage(0),
+      _nowUs((uint64_t)esp_timer_get_time()), _nowMicros(micros()), _taskCount(0), _lineLength(0), _lineSent(0) {
+    _count = Trace::snapshot(_events, TRACE_CORES * TRACE_RING_SIZE);
+}
+
+TraceJsonWriter::~TraceJsonWriter() {
+    delete[] _events;
+}
+
+void TraceJsonWriter::append(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(_line + _lineLength, sizeof(_line) - _lineLength, format, args);
+    va_end(args);
+    if (length > 0) _lineLength += (size_t)length;
+    if (_lineLength >= sizeof(_line)) _lineLength = sizeof(_line) - 1;
+}
+
+// One JSON record (or the header/footer) into _line
+bool TraceJsonWriter::formatNext() {
+    _lineLength = 0;
+    _lineSent = 0;
+    switch (_stage) {
+    case 0:
+        append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        for (uint8_t core = 0; core < TRACE_CORES; core++) {
+            append("%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"core %u\"}}",
+                   core ? "," : "", core, core);
+        }
+        _stage = 1;
+        return true;
+
+    case 1: {
+        if (_next == _count) {
+            append("]}");
+            _stage = 2;
+            return true;
+        }
+        const TraceEvent& event = _events[_next];
+        uint8_t tid = 0;
+        while (tid < _taskCount && (_tasks[tid] != event.task || _taskCores[tid] != event.core)) tid++;
+        if (tid == _taskCount && tid < MAX_TASKS) {
+            // First event of this task on this core: name its thread
+            // before the event itself goes out on the next call
+            _tasks[tid] = event.task;
+            _taskCores[tid] = event.core;
+            _taskCount++;
+            append(",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                   event.core, tid + 1, pcTaskGetName(event.task));
+            return true;
+        }
+        // Tasks past MAX_TASKS share thread 0
+        unsigned thread = tid < MAX_TASKS ? tid + 1 : 0;
+        uint64_t ts = _nowUs - (uint32_t)(_nowMicros - event.timestampUs);
+        uint32_t seconds = (uint32_t)(ts / 1000000);
+        uint32_t fraction = (uint32_t)(ts % 1000000);
+        append(",{\"name\":\"%s\",\"ph\":\"%s\",", traceNameText(event.name), PHASES[(uint8_t)event.phase]);
+        if (seconds) append("\"ts\":%u%06u,", (unsigned)seconds, (unsigned)fraction);
+        else append("\"ts\":%u,", (unsigned)fraction);
+        append("\"pid\":%u,\"tid\":%u%s}", event.core, thread,
+               event.phase == TracePhase::Instant ? ",\"s\":\"t\"" : "");
+        _next++;
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+size_t TraceJsonWriter::fill(char* buffer, size_t size) {
+    size_t written = 0;
+    while (written < size) {
+        if (_lineSent == _lineLength && !formatNext()) break;
+        size_t chunk = _lineLength - _lineSent;
+        if (chunk > size - written) chunk = size - written;
+        memcpy(buffer + written, _line + _lineSent, chunk);
+        _lineSent += chunk;
+        written += chunk;
+    }
+    return written;
+}
+
+#endif // OTWU_TRACE
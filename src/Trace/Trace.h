@@ -0,0 +1,113 @@
+// Trace.h
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+
+// Build with -D OTWU_TRACE=1 (the esp32doit-devkit-v1-trace environment)
+// to record trace points; otherwise every TRACE_* macro compiles to
+// nothing and no ring is allocated.
+#ifndef OTWU_TRACE
+#define OTWU_TRACE 0
+#endif
+
+// Events kept per core, oldest overwritten first; a power of two
+#define TRACE_RING_SIZE 512
+#define TRACE_CORES     2
+
+// Static trace point names, so an event stores one byte instead of a string
+enum class TraceName : uint8_t {
+    NetworkSetup,
+    WiFiUp,
+    WiFiDown,
+    MqttResolve,
+    MqttConnect,
+    MqttLost,
+    MqttMessage,
+    MqttPublishState,
+    MqttPublishTelemetry,
+    LedFrame,
+    LedShow,
+    ScheduleEvaluate,
+    ScheduleTransition,
+    HttpRequest,
+    NvsCommit,
+    Count
+};
+
+enum class TracePhase : uint8_t { Begin, End, Instant };
+
+struct TraceEvent {
+    uint32_t timestampUs;   // micros(); wraps every 71 minutes
+    TaskHandle_t task;
+    TracePhase phase;
+    TraceName name;
+    uint8_t core;
+};
+
+// "<category>.<event>", e.g. "led.show"
+const char* traceNameText(TraceName name);
+
+// One lock-free ring per core. Writers only contend with tasks on their
+// own core, and a slot is claimed with one atomic add, so recording is
+// safe from any task and never blocks.
+class Trace {
+public:
+    static void record(TracePhase phase, TraceName name);
+    // Copies every complete event, each core's oldest first; returns the
+    // number written to out (room for TRACE_CORES * TRACE_RING_SIZE)
+    static size_t snapshot(TraceEvent* out, size_t capacity);
+};
+
+// Streams a snapshot as Chrome trace JSON (chrome://tracing, Perfetto):
+// one process per core, one thread per task
+class TraceJsonWriter {
+public:
+    TraceJsonWriter();
+    ~TraceJsonWriter();
+    // Next piece of the document, at most size bytes; 0 once it is complete
+    size_t fill(char* buffer, size_t size);
+
+private:
+    static const uint8_t MAX_TASKS = 8;
+
+    TraceEvent* _events;
+    size_t _count;
+    size_t _next;            // event to format next
+    uint8_t _stage;          // header, events, footer, done
+    uint64_t _nowUs;         // anchors 32-bit timestamps to uptime
+    uint32_t _nowMicros;
+    TaskHandle_t _tasks[MAX_TASKS];
+    uint8_t _taskCores[MAX_TASKS];
+    uint8_t _taskCount;
+    char _line[192];
+    size_t _lineLength;
+    size_t _lineSent;
+
+    bool formatNext();
+    void append(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+// Begin on construction, end when the scope exits
+class TraceScope {
+public:
+    explicit TraceScope(TraceName name) : _name(name) { Trace::record(TracePhase::Begin, name); }
+    ~TraceScope() { Trace::record(TracePhase::End, _name); }
+
+private:
+    TraceName _name;
+};
+
+#if OTWU_TRACE
+#define TRACE_BEGIN(name)   Trace::record(TracePhase::Begin, TraceName::name)
+#define TRACE_END(name)     Trace::record(TracePhase::End, TraceName::name)
+#define TRACE_INSTANT(name) Trace::record(TracePhase::Instant, TraceName::name)
+#define TRACE_SCOPE(name)   TraceScope traceScope##name(TraceName::name)
+#else
+#define TRACE_BEGIN(name)   do {} while (0)
+#define TRACE_END(name)     do {} while (0)
+#define TRACE_INSTANT(name) do {} while (0)
+#define TRACE_SCOPE(name)   do {} while (0)
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,552 @@
+// IndexHtml.h
+// Generated by scripts/embed_web.py from web/index.html - do not edit.
+#ifndef INDEX_HTML_H
+#define INDEX_HTML_H
+
+#include <Arduino.h>
+
+#define INDEX_HTML_ETAG "\"8189847b8249e5c2\""
+#define INDEX_HTML_GZ_LEN 8595
+
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3d, 0xdb, 0x92, 0x1b, 0xc7,
+    0x75, 0xef, 0xfb, 0x15, 0x4d, 0x88, 0xf4, 0x00, 0xd1, 0x00, 0x3b, 0xc0, 0x5e, 0xb4, 0x04, 0xb8,
+    0x2b, 0x93, 0x4b, 0xd2, 0x62, 0x2c, 0x8a, 0xb4, 0x76, 0x19, 0x95, 0x8a, 0x56, 0xa2, 0x01, 0xa6,
+    0x01, 0x8c, 0x38, 0x98, 0x81, 0x67, 0x06, 0x0b, 0xae, 0x61, 0x54, 0xf9, 0x45, 0x7e, 0x72, 0x55,
+    0x12, 0x4b, 0xae, 0xc4, 0x2e, 0x27, 0xae, 0xe4, 0xc9, 0xa9, 0xbc, 0x3a, 0xa9, 0x3c, 0xe5, 0x21,
+    0x9f, 0xa2, 0x1f, 0x48, 0x3e, 0x21, 0xe7, 0xd2, 0x3d, 0xd3, 0x73, 0x01, 0x16, 0x2b, 0xdb, 0x95,
+    0xac, 0xcd, 0x5d, 0x4c, 0x5f, 0xce, 0x39, 0x7d, 0xfa, 0xdc, 0xbb, 0x07, 0x7a, 0x70, 0xe7, 0xf1,
+    0x8b, 0xf3, 0xcb, 0x4f, 0x5f, 0x3e, 0x11, 0xd3, 0x74, 0x16, 0x9c, 0xed, 0x3d, 0xc0, 0x3f, 0x22,
+    0x70, 0xc3, 0xc9, 0x69, 0x43, 0x86, 0x0d, 0x6c, 0x90, 0xae, 0x07, 0x7f, 0x66, 0x32, 0x75, 0xc5,
+    0x68, 0xea, 0xc6, 0x89, 0x4c, 0x4f, 0x1b, 0xaf, 0x2e, 0x9f, 0xb6, 0x4f, 0x1a, 0x62, 0x5f, 0x77,
+    0x84, 0xee, 0x4c, 0x9e, 0x36, 0xae, 0x7c, 0xb9, 0x9c, 0x47, 0x71, 0xda, 0x10, 0xa3, 0x28, 0x4c,
+    0x65, 0x08, 0x03, 0x97, 0xbe, 0x97, 0x4e, 0x4f, 0x3d, 0x79, 0xe5, 0x8f, 0x64, 0x9b, 0x1e, 0x6c,
+    0xe1, 0x87, 0x7e, 0xea, 0xbb, 0x41, 0x3b, 0x19, 0xb9, 0x81, 0x3c, 0xed, 0xda, 0x42, 0xcf, 0x6b,
+    0x8f, 0xfd, 0xf4, 0x74, 0x14, 0x5d, 0xc9, 0x98, 0x41, 0xa7, 0x7e, 0x1a, 0xc8, 0xb3, 0x17, 0xdf,
+    0x17, 0x97, 0x2f, 0xc4, 0x27, 0x0f, 0xbf, 0xff, 0x44, 0x7c, 0xf3, 0xd3, 0xaf, 0xc4, 0x39, 0x80,
+    0x8e, 0xa3, 0x40, 0xbc, 0x74, 0x43, 0x19, 0x3c, 0xd8, 0xe7, 0x31, 0x05, 0x32, 0xd2, 0xa9, 0x9c,
+    0xc9, 0xf6, 0x28, 0x0a, 0xa2, 0xd8, 0xa0, 0xe4, 0x1d, 0x47, 0xba, 0x47, 0xee, 0x11, 0x43, 0x4e,
+    0x46, 0xb1, 0x3f, 0x4f, 0x45, 0x12, 0x8f, 0x4e, 0x1b, 0xd3, 0x34, 0x9d, 0x27, 0xfd, 0xfd, 0xfd,
+    0x91, 0x17, 0x76, 0xbe, 0x48, 0x3c, 0x19, 0xf8, 0x57, 0x71, 0x27, 0x94, 0xe9, 0x7e, 0x38, 0x9f,
+    0xed, 0x27, 0x4b, 0x09, 0x80, 0x03, 0x19, 0xa7, 0xbd, 0xef, 0x76, 0xbb, 0x8d, 0xb3, 0x07, 0xfb,
+    0x3c, 0x15, 0x61, 0xa4, 0xd7, 0x88, 0xb9, 0x1f, 0x47, 0x51, 0xba, 0x6a, 0xb7, 0x87, 0x93, 0xb6,
+    0xd3, 0x9f, 0x26, 0x41, 0xb3, 0x77, 0xe4, 0xd8, 0x47, 0xce, 0x3d, 0xfb, 0xfe, 0xc9, 0xbd, 0xd6,
+    0x80, 0xda, 0xbb, 0xdc, 0x7e, 0xe0, 0xd8, 0x87, 0x47, 0xd0, 0xfe, 0x1e, 0xb5, 0x8f, 0xdc, 0xd8,
+    0xeb, 0xbf, 0x33, 0x1e, 0x8f, 0xe1, 0xf3, 0x78, 0xc2, 0x23, 0xba, 0x8e, 0xdd, 0x83, 0x99, 0x5d,
+    0x9e, 0x39, 0x5b, 0xa4, 0xd2, 0xe3, 0x8e, 0x1e, 0x77, 0xdc, 0x3f, 0xcc, 0x3b, 0xf2, 0x49, 0x47,
+    0x76, 0x17, 0xc0, 0x02, 0x4a, 0x42, 0x17, 0xc5, 0x9e, 0x8c, 0xb3, 0x59, 0xdd, 0xe3, 0x7b, 0xf6,
+    0x09, 0x83, 0x8b, 0xfd, 0x30, 0x47, 0xd3, 0x75, 0x00, 0xdc, 0xf1, 0x11, 0x75, 0x2c, 0xdd, 0x37,
+    0x92, 0x3a, 0xba, 0x30, 0xe1, 0x3d, 0x68, 0x3f, 0xcc, 0xdb, 0xdb, 0x4b, 0xe9, 0xbe, 0xc9, 0x3a,
+    0x71, 0x59, 0x27, 0xdc, 0x99, 0x04, 0x52, 0xce, 0xa9, 0xc3, 0xb1, 0x8f, 0xa1, 0xf9, 0xc8, 0x68,
+    0xce, 0x27, 0xc1, 0x8a, 0x9d, 0x8c, 0x80, 0xd4, 0x9f, 0xc9, 0x8c, 0x80, 0x13, 0x9c, 0x93, 0xb7,
+    0xe7, 0x53, 0xb0, 0x13, 0x01, 0xde, 0xe7, 0xf5, 0xb8, 0xa3, 0x11, 0x6c, 0x5f, 0xff, 0xca, 0x8d,
+    0x9b, 0x3c, 0x32, 0x6f, 0xe4, 0x39, 0x79, 0x0f, 0x3d, 0x63, 0xf7, 0xa4, 0xed, 0x2e, 0xe2, 0x28,
+    0x76, 0xfb, 0xb1, 0xeb, 0xa1, 0xa0, 0x4d, 0xf0, 0x2f, 0x4c, 0x68, 0x02, 0x5c, 0x81, 0xff, 0xdc,
+    0x54, 0x00, 0x3b, 0xf1, 0x9f, 0x4d, 0x4b, 0x3b, 0x71, 0x10, 0x1d, 0xa1, 0x14, 0xf0, 0x37, 0x8d,
+    0xdd, 0x30, 0x99, 0xbb, 0x31, 0x4c, 0xc1, 0xe1, 0x2d, 0xbb, 0x0c, 0x07, 0xf8, 0x20, 0x8e, 0x18,
+    0x0e, 0xac, 0x43, 0x1c, 0x28, 0x38, 0xbd, 0x63, 0x05, 0xa7, 0xb7, 0x23, 0x1c, 0x60, 0x8e, 0x38,
+    0x64, 0x38, 0x48, 0xd6, 0x89, 0xa6, 0xa7, 0xb7, 0x9d, 0x1e, 0x5a, 0x62, 0xb2, 0x88, 0xc7, 0xee,
+    0x48, 0xf6, 0x03, 0x3f, 0x94, 0x6e, 0x9c, 0xc3, 0xec, 0x1e, 0x1e, 0x79, 0x72, 0x62, 0xa3, 0x64,
+    0xd9, 0x05, 0xd9, 0x01, 0x66, 0xf3, 0x4c, 0xda, 0xef, 0xca, 0xb4, 0x03, 0x9a, 0x56, 0x16, 0x83,
+    0xac, 0xe1, 0x58, 0xc9, 0x8b, 0x42, 0x4e, 0xbb, 0xbf, 0x05, 0x46, 0x2e, 0x14, 0xea, 0x11, 0x45,
+    0x07, 0x80, 0xaa, 0xf9, 0x6a, 0x57, 0x37, 0x00, 0xe0, 0x2d, 0xe5, 0x31, 0x3c, 0x3f, 0x13, 0x59,
+    0x0d, 0x02, 0x67, 0x2c, 0x92, 0x76, 0x30, 0xe9, 0x77, 0x4f, 0xe6, 0x6f, 0xf3, 0x86, 0x99, 0xd7,
+    0xef, 0xf6, 0xcc, 0x86, 0x64, 0xd6, 0xef, 0x3a, 0xd4, 0x90, 0x4c, 0x5d, 0x2f, 0x5a, 0xb6, 0x93,
+    0x68, 0x9c, 0xf6, 0x1d, 0x01, 0xb3, 0x44, 0xef, 0x10, 0x7e, 0x29, 0x1d, 0xc2, 0x4d, 0x24, 0xa1,
+    0xd8, 0x17, 0x1d, 0xe7, 0xa4, 0x95, 0x8f, 0x1f, 0x07, 0x91, 0x8b, 0x13, 0x10, 0xac, 0x38, 0x38,
+    0xae, 0x9f, 0xd1, 0x3d, 0x34, 0x66, 0x4c, 0x82, 0x68, 0x09, 0x13, 0x1c, 0xd8, 0xda, 0x6c, 0x34,
+    0xcc, 0x77, 0x78, 0x87, 0x71, 0x38, 0x8d, 0x96, 0x6e, 0x22, 0xfb, 0xa3, 0xc5, 0xd0, 0x1f, 0xb5,
+    0x87, 0xf2, 0xc7, 0xbe, 0x8c, 0x9b, 0x9d, 0x5e, 0xcf, 0xee, 0xda, 0x9d, 0x83, 0x63, 0xbb, 0x4b,
+    0x7a, 0xd1, 0x1e, 0xbb, 0x49, 0x0a, 0x0b, 0x74, 0x66, 0x89, 0x60, 0x9e, 0xe0, 0x1c, 0xee, 0x9a,
+    0x81, 0x69, 0xe8, 0x95, 0x7b, 0xd6, 0x7b, 0x7f, 0xb6, 0x1a, 0x46, 0x6f, 0xdb, 0x89, 0xff, 0x63,
+    0x54, 0x76, 0xb6, 0x05, 0x60, 0x12, 0xde, 0xae, 0xd1, 0xac, 0xdb, 0xc3, 0xc8, 0xbb, 0x5e, 0x4d,
+    0xa5, 0x3f, 0x99, 0x02, 0x54, 0x20, 0x67, 0x4d, 0x0d, 0x33, 0x37, 0x9e, 0xf8, 0x61, 0xdf, 0x19,
+    0x8c, 0xc1, 0x54, 0x02, 0xca, 0x99, 0x1f, 0x5c, 0xf7, 0x17, 0x7e, 0x3b, 0x01, 0xa1, 0x6b, 0x27,
+    0x32, 0xf6, 0xc7, 0x76, 0x72, 0x9d, 0xa4, 0x72, 0xd6, 0x5e, 0xf8, 0x76, 0xdb, 0x9d, 0xcf, 0x03,
+    0xd9, 0xe6, 0x06, 0xfb, 0x42, 0x4e, 0x22, 0x29, 0x5e, 0x3d, 0xb3, 0x3f, 0x8e, 0x86, 0x51, 0x1a,
+    0xd9, 0x1f, 0xc1, 0x2f, 0x71, 0x01, 0xf3, 0xec, 0x57, 0xc3, 0x45, 0x98, 0x2e, 0xec, 0x73, 0x37,
+    0x4c, 0x41, 0x6e, 0x83, 0xc0, 0x7e, 0x18, 0x83, 0xe4, 0xdb, 0x8d, 0x87, 0x38, 0x1d, 0x6c, 0x38,
+    0xd8, 0x66, 0xf1, 0x64, 0x16, 0x7d, 0xe1, 0x37, 0xec, 0x86, 0x86, 0xa2, 0x1a, 0x06, 0x43, 0x77,
+    0xf4, 0x66, 0x12, 0x47, 0x8b, 0xd0, 0xab, 0x0a, 0xc8, 0x89, 0x93, 0x0b, 0x08, 0x5a, 0xdc, 0x56,
+    0xfe, 0xb9, 0xdb, 0xd2, 0x0f, 0x5a, 0xff, 0x5b, 0x03, 0x72, 0x02, 0xca, 0x44, 0x8c, 0x27, 0xad,
+    0x01, 0xc2, 0x6b, 0x6b, 0x0e, 0x74, 0x8e, 0x8e, 0x06, 0x60, 0x33, 0x86, 0x6f, 0xfc, 0xb4, 0x9d,
+    0xba, 0xf3, 0xf6, 0x14, 0x9a, 0x03, 0xec, 0x62, 0xdf, 0xd1, 0x37, 0xd4, 0x6e, 0xbd, 0xd7, 0x61,
+    0x90, 0xab, 0x79, 0x94, 0x80, 0xf7, 0x8a, 0xc2, 0xfe, 0xd8, 0x7f, 0x2b, 0xbd, 0x81, 0x1f, 0x82,
+    0x3f, 0xec, 0xb7, 0x7b, 0xce, 0xd5, 0xcc, 0x7d, 0x6b, 0x52, 0x5e, 0xa6, 0x64, 0xec, 0x07, 0x29,
+    0xd8, 0xe5, 0x61, 0xb0, 0x88, 0x9b, 0x28, 0x17, 0x2d, 0x91, 0xb8, 0xe9, 0x22, 0x76, 0x53, 0x89,
+    0xea, 0x05, 0x3a, 0x1d, 0xcd, 0xdd, 0x91, 0x9f, 0x5e, 0xf7, 0x3b, 0x47, 0x83, 0x79, 0xe4, 0x83,
+    0xd3, 0x8a, 0xdb, 0xf2, 0x0a, 0x50, 0x27, 0xfd, 0x30, 0x0a, 0xe5, 0xc0, 0x0d, 0xfd, 0x99, 0xcb,
+    0x88, 0x51, 0x20, 0x41, 0xf0, 0x12, 0x81, 0x7b, 0xde, 0xf6, 0xc3, 0x76, 0xb4, 0x48, 0xc1, 0xa9,
+    0x8e, 0xd1, 0xaf, 0x4a, 0xe1, 0x22, 0x9e, 0x10, 0xe0, 0xae, 0xf7, 0xbe, 0xfb, 0x46, 0x5e, 0x8f,
+    0x63, 0xf0, 0x89, 0x89, 0xa0, 0x49, 0x2b, 0xe7, 0xde, 0x8a, 0x16, 0x35, 0x8e, 0xe2, 0x19, 0x2f,
+    0x2f, 0x80, 0x81, 0x07, 0x5e, 0xb3, 0xdd, 0xbb, 0x67, 0xb7, 0xbb, 0xf7, 0x6c, 0x07, 0xc8, 0x42,
+    0xaf, 0xdc, 0xec, 0xb6, 0xd6, 0x28, 0x21, 0x1b, 0x86, 0xc3, 0xe8, 0xc2, 0xe0, 0x8e, 0xd3, 0x6b,
+    0xad, 0x01, 0x1f, 0x08, 0xa5, 0xef, 0x8a, 0xe6, 0x3c, 0x96, 0x63, 0x19, 0x27, 0xed, 0x58, 0x7a,
+    0x8b, 0x11, 0x78, 0xaa, 0x59, 0x44, 0x84, 0xf3, 0x63, 0x6b, 0xa5, 0x59, 0x99, 0x2f, 0x09, 0x57,
+    0x08, 0xf3, 0x3b, 0xe8, 0xac, 0x5d, 0xd8, 0xa2, 0x18, 0x84, 0xf2, 0x2d, 0x87, 0x0b, 0xfd, 0xfb,
+    0xc7, 0xa8, 0xbe, 0x5a, 0x48, 0x85, 0xbb, 0x48, 0xa3, 0xc1, 0xdc, 0xf5, 0x3c, 0x14, 0xf0, 0x51,
+    0xe0, 0xce, 0xe6, 0xcd, 0x2e, 0x28, 0xa5, 0x7d, 0xd0, 0x39, 0xba, 0x5a, 0xda, 0x07, 0xa0, 0xa4,
+    0xa0, 0x05, 0x18, 0xb3, 0x00, 0x90, 0x54, 0xbe, 0x4d, 0xdb, 0x2e, 0x6c, 0x69, 0xd8, 0x47, 0x53,
+    0x22, 0x63, 0x05, 0x06, 0x34, 0x22, 0x4d, 0xa3, 0x99, 0x39, 0xfd, 0x58, 0x4f, 0x1e, 0x64, 0x1b,
+    0x0c, 0x62, 0x0b, 0xd4, 0x5d, 0x01, 0x1f, 0x3b, 0x43, 0x58, 0xbb, 0xd7, 0xf6, 0x81, 0xbc, 0x64,
+    0xe5, 0xf9, 0xc9, 0x3c, 0x70, 0xaf, 0x61, 0x1b, 0xe4, 0xdb, 0xc1, 0x17, 0x8b, 0x24, 0xf5, 0xc7,
+    0xd7, 0x6d, 0x15, 0x65, 0x68, 0x34, 0x13, 0x77, 0xce, 0x66, 0xa8, 0x88, 0x8f, 0x0c, 0x51, 0xb6,
+    0xcf, 0xf7, 0x8b, 0x80, 0x45, 0x07, 0xfe, 0xac, 0x48, 0x07, 0x41, 0x7d, 0xa5, 0x22, 0xae, 0x07,
+    0x53, 0x6c, 0x5c, 0x59, 0xef, 0x84, 0x56, 0xd6, 0xa1, 0x78, 0xa7, 0x3a, 0xec, 0x44, 0xad, 0xe1,
+    0xf0, 0x10, 0xd7, 0x40, 0xdd, 0x4b, 0x16, 0xf3, 0x13, 0xc7, 0x19, 0x04, 0x32, 0x45, 0x79, 0x4a,
+    0x10, 0x35, 0xb0, 0xad, 0x03, 0x83, 0x6a, 0x65, 0x95, 0x2d, 0x6e, 0xa6, 0x14, 0xf9, 0x90, 0xf6,
+    0x28, 0xf0, 0xe7, 0x7d, 0xe4, 0xe7, 0xa0, 0xb6, 0x31, 0x53, 0x23, 0xe4, 0x38, 0x88, 0x7a, 0x50,
+    0x55, 0x21, 0xad, 0x01, 0x5e, 0x1c, 0xcd, 0x95, 0xa5, 0x6c, 0x3a, 0x02, 0x8d, 0x6a, 0xd7, 0x34,
+    0x93, 0xf7, 0xd1, 0x4a, 0x1e, 0x91, 0x95, 0x3c, 0x38, 0x02, 0x53, 0x9f, 0x6d, 0x3c, 0x98, 0xd3,
+    0xf9, 0x5b, 0x60, 0x40, 0xb2, 0x18, 0x32, 0x0f, 0x4c, 0xdd, 0xd6, 0x11, 0x91, 0x5a, 0xba, 0xc1,
+    0x99, 0xee, 0x21, 0x09, 0x07, 0xf2, 0x06, 0x3d, 0x45, 0xab, 0x28, 0x49, 0xe8, 0x06, 0x00, 0xa6,
+    0xe7, 0x5f, 0xf9, 0x28, 0x30, 0x2c, 0x71, 0x27, 0xe8, 0x51, 0x94, 0x91, 0x38, 0xcc, 0x65, 0x8f,
+    0xc8, 0xa4, 0x49, 0xce, 0x36, 0xe6, 0x29, 0xa3, 0xcb, 0xee, 0xa7, 0x7f, 0xff, 0xfe, 0x7d, 0xe4,
+    0x35, 0xda, 0x64, 0x5a, 0xb2, 0x1a, 0x6e, 0x78, 0x8a, 0x56, 0x51, 0x22, 0x26, 0xb1, 0xef, 0x65,
+    0x32, 0x86, 0x0f, 0x24, 0x4c, 0x85, 0xb5, 0x90, 0x38, 0x90, 0xac, 0x62, 0x3f, 0xf0, 0x7c, 0x36,
+    0x47, 0xbd, 0x44, 0x96, 0x2f, 0x66, 0x61, 0xd2, 0xef, 0x8e, 0x63, 0xd4, 0x25, 0x88, 0x2f, 0x57,
+    0x35, 0x74, 0xaa, 0xb8, 0x41, 0x13, 0xda, 0xef, 0xc2, 0xaa, 0x92, 0x28, 0xf0, 0x3d, 0xe5, 0x48,
+    0xb8, 0xb9, 0xbc, 0x0e, 0xee, 0xcb, 0xbc, 0x6e, 0x6b, 0xe3, 0x92, 0xd0, 0xbd, 0xb6, 0xea, 0x14,
+    0xf4, 0x10, 0xa9, 0x26, 0xe9, 0x44, 0xa2, 0x48, 0x0a, 0x94, 0x44, 0x14, 0x0d, 0xa1, 0x20, 0x13,
+    0x79, 0x52, 0xab, 0x8a, 0x03, 0xcc, 0x0d, 0xc6, 0xe8, 0x5e, 0x51, 0xf4, 0xd4, 0x22, 0xfb, 0x53,
+    0x6c, 0x5d, 0x6d, 0x22, 0x88, 0x2c, 0x5f, 0x6b, 0x50, 0x63, 0xc8, 0x3e, 0x6d, 0xb6, 0xbb, 0x88,
+    0x86, 0x1a, 0x18, 0x51, 0x36, 0x4a, 0x31, 0x83, 0x5d, 0x70, 0xcb, 0xce, 0x81, 0x67, 0x1d, 0x60,
+    0xeb, 0x5a, 0x8a, 0x82, 0xb6, 0xb2, 0x37, 0x05, 0xd3, 0x40, 0x76, 0xa7, 0x0d, 0x16, 0x79, 0x96,
+    0x68, 0xb3, 0x50, 0xb6, 0x16, 0xa8, 0x8f, 0x12, 0x9c, 0x7f, 0x0a, 0x49, 0x46, 0xb8, 0xd1, 0x68,
+    0xa0, 0x08, 0x22, 0xc4, 0xf6, 0x32, 0x86, 0x11, 0xf8, 0x4b, 0xa3, 0x65, 0x3d, 0xb8, 0x09, 0x2b,
+    0xc1, 0x45, 0xcb, 0x93, 0xab, 0x06, 0xc5, 0x4c, 0xa6, 0x91, 0x78, 0xcf, 0x71, 0x0a, 0x40, 0xcb,
+    0xc6, 0x08, 0xc5, 0x4d, 0x0f, 0xf0, 0x64, 0x32, 0xba, 0x51, 0xf9, 0xba, 0xb9, 0xe2, 0xb4, 0xd3,
+    0x68, 0xde, 0x67, 0xdd, 0x1d, 0x05, 0xd1, 0xe8, 0x4d, 0x8d, 0x59, 0xde, 0xd5, 0xe3, 0x23, 0x7e,
+    0x15, 0x50, 0x42, 0x5c, 0xcc, 0x21, 0x15, 0x18, 0x8a, 0xe3, 0xd6, 0x1f, 0x22, 0xcd, 0x33, 0xaf,
+    0x22, 0xaf, 0x87, 0x5a, 0x5e, 0x1d, 0x92, 0xd7, 0x6d, 0xda, 0xab, 0x57, 0x45, 0x19, 0xc8, 0xaa,
+    0x14, 0x42, 0xcd, 0xa2, 0x30, 0xa2, 0x4d, 0xb6, 0x2f, 0x9e, 0x3e, 0x87, 0xcf, 0xed, 0x8f, 0xe5,
+    0x64, 0x11, 0xb8, 0xb1, 0xfd, 0x5c, 0x86, 0x41, 0x64, 0x43, 0x93, 0x3b, 0x8a, 0x6c, 0xc8, 0x68,
+    0x81, 0x64, 0x37, 0xb1, 0x1b, 0x1f, 0xfa, 0x43, 0x19, 0x93, 0x4b, 0x14, 0x38, 0x1c, 0x62, 0xa3,
+    0xf3, 0x68, 0x11, 0x43, 0x68, 0x28, 0x3e, 0x92, 0xcb, 0x86, 0x9d, 0x81, 0x1b, 0xd4, 0xda, 0xff,
+    0xae, 0x03, 0x24, 0x1f, 0x1d, 0xef, 0xe2, 0x00, 0x9c, 0x13, 0x39, 0x2b, 0x04, 0x47, 0x9c, 0x59,
+    0xd1, 0xce, 0xa8, 0xa5, 0xa2, 0xc5, 0x45, 0x39, 0x29, 0x05, 0xb0, 0x27, 0xda, 0x34, 0x67, 0x0b,
+    0xf7, 0x40, 0x95, 0x56, 0xc6, 0x56, 0x03, 0x01, 0x83, 0x1d, 0x6d, 0xf3, 0x01, 0xd9, 0x33, 0xe4,
+    0x74, 0xf7, 0x88, 0xdd, 0x5b, 0x92, 0x82, 0x31, 0x48, 0x76, 0x92, 0x69, 0x94, 0x61, 0xbd, 0x6f,
+    0x64, 0x9b, 0x49, 0x79, 0x0c, 0x51, 0xaa, 0xc8, 0xc9, 0xd1, 0x2d, 0xc5, 0x84, 0x8c, 0x37, 0xba,
+    0x07, 0x48, 0xf0, 0xd9, 0x35, 0x90, 0x1e, 0x65, 0x11, 0x34, 0x59, 0xf6, 0x1a, 0x6b, 0x5f, 0x36,
+    0xba, 0x39, 0x07, 0x0c, 0x51, 0x42, 0xfe, 0x3a, 0xe2, 0x40, 0x31, 0xb8, 0x24, 0xcf, 0x82, 0xe2,
+    0x4a, 0x46, 0x0d, 0x2e, 0x01, 0xcc, 0x43, 0xd5, 0x94, 0x63, 0x1a, 0xd7, 0x5a, 0xd3, 0x08, 0x88,
+    0xac, 0xaa, 0xfd, 0x94, 0xa3, 0xa9, 0x01, 0x60, 0x53, 0x65, 0x75, 0x04, 0x6d, 0x3a, 0x0f, 0x88,
+    0xc6, 0xe3, 0xd5, 0x66, 0xba, 0xb3, 0x8d, 0x21, 0x07, 0xbf, 0x2a, 0x59, 0x0e, 0x53, 0xed, 0x61,
+    0x1b, 0xd7, 0x7a, 0x2c, 0x78, 0xea, 0x9b, 0xed, 0x04, 0x1b, 0x96, 0x61, 0x6a, 0x44, 0x56, 0xec,
+    0xf5, 0x6a, 0x5d, 0x5b, 0x2c, 0xe7, 0xd2, 0x4d, 0x9b, 0x3d, 0x7b, 0xe6, 0x87, 0x10, 0x22, 0x42,
+    0x5e, 0x09, 0xce, 0x0e, 0xb4, 0x5f, 0xdb, 0xb8, 0x3c, 0x06, 0x85, 0x01, 0x2a, 0x80, 0x3c, 0x22,
+    0x2d, 0x5e, 0x31, 0x8e, 0xad, 0x60, 0x0f, 0x4b, 0x60, 0xd7, 0x4c, 0xd9, 0x4a, 0x47, 0x37, 0x8b,
+    0x04, 0x75, 0x48, 0x06, 0x72, 0x94, 0x72, 0x50, 0x5e, 0x69, 0xb8, 0xad, 0x07, 0xd8, 0x24, 0xce,
+    0x14, 0x16, 0x1d, 0x66, 0xf2, 0xd5, 0xef, 0x65, 0xf2, 0x6a, 0x46, 0x54, 0x45, 0xe1, 0x23, 0xf1,
+    0xdf, 0xb2, 0x35, 0xc7, 0x75, 0xa2, 0x49, 0x16, 0xb5, 0x92, 0x26, 0x7d, 0x3b, 0x8f, 0xa8, 0x3a,
+    0x32, 0x14, 0x95, 0x19, 0x44, 0x2d, 0xe1, 0x2a, 0x75, 0xa9, 0x08, 0xa8, 0xd8, 0x5a, 0x54, 0x16,
+    0xd4, 0x58, 0xa7, 0xaa, 0x2a, 0x27, 0x4a, 0x55, 0x6c, 0x95, 0xd1, 0x3b, 0x1b, 0x32, 0xfa, 0x63,
+    0x08, 0xfc, 0x40, 0x22, 0x74, 0x54, 0x77, 0xa8, 0xa5, 0x4e, 0x05, 0x0f, 0x9b, 0xa3, 0x83, 0x35,
+    0x8d, 0x72, 0x47, 0x18, 0x7e, 0xd4, 0x0f, 0x73, 0xd4, 0x18, 0xd8, 0x7b, 0x77, 0x18, 0x80, 0x26,
+    0x66, 0xf1, 0xdc, 0xb1, 0x11, 0x75, 0x90, 0x78, 0x8c, 0x16, 0x71, 0x02, 0x8c, 0x0e, 0x23, 0xf4,
+    0x7f, 0xe0, 0x3d, 0xa4, 0xc7, 0x54, 0x90, 0x2e, 0xd7, 0x05, 0x6b, 0xa4, 0xe3, 0x6a, 0x7b, 0xa8,
+    0x56, 0x68, 0x32, 0xb1, 0x58, 0xb3, 0xeb, 0xdd, 0x2b, 0x71, 0xac, 0x50, 0xe1, 0x80, 0x61, 0xe2,
+    0x3d, 0x55, 0x6d, 0x02, 0x7e, 0xf4, 0x7a, 0x2d, 0x85, 0x99, 0xac, 0x44, 0x6d, 0x9c, 0x48, 0xe6,
+    0x63, 0x2b, 0x6e, 0x55, 0xe4, 0x71, 0xb6, 0x62, 0x56, 0x78, 0x8f, 0x4a, 0x78, 0xd1, 0x22, 0x89,
+    0xd5, 0x9e, 0x10, 0x06, 0x6a, 0xb1, 0xa1, 0x1e, 0xa4, 0x5d, 0x90, 0x4d, 0x15, 0x32, 0x81, 0x65,
+    0x43, 0xa3, 0x0d, 0x57, 0x2f, 0xb8, 0x34, 0x05, 0xe0, 0x98, 0x3a, 0xb1, 0x9c, 0x82, 0xde, 0xe1,
+    0x73, 0x81, 0xe8, 0x32, 0x20, 0xa4, 0x9c, 0xc6, 0x64, 0xc4, 0x8b, 0x4a, 0x65, 0xc8, 0xa1, 0xa2,
+    0x0d, 0xf3, 0xcd, 0xc1, 0x05, 0x0c, 0xf6, 0xd4, 0x12, 0x36, 0xdb, 0xcc, 0xd6, 0x06, 0x07, 0x58,
+    0x20, 0xa6, 0xe0, 0x79, 0x34, 0xc8, 0x45, 0x8a, 0x3c, 0x30, 0xc1, 0xd6, 0x28, 0x7c, 0xcd, 0xfc,
+    0xb2, 0x0a, 0x17, 0xe1, 0xe9, 0x10, 0x79, 0x8b, 0x6f, 0x3c, 0xd6, 0x53, 0x3c, 0x37, 0x9c, 0x14,
+    0xc7, 0x9a, 0x14, 0x98, 0x68, 0x94, 0x84, 0xd4, 0x10, 0xa5, 0x5c, 0x8f, 0x09, 0xb0, 0x4a, 0x82,
+    0x31, 0x94, 0x2b, 0xb7, 0x98, 0xdd, 0x46, 0x51, 0x30, 0x74, 0xe3, 0x9d, 0x92, 0x6c, 0x23, 0xe4,
+    0xc0, 0x2c, 0x4e, 0xcf, 0x15, 0x64, 0xb2, 0x73, 0xf3, 0xdf, 0x73, 0x1c, 0xce, 0x1b, 0xe7, 0x7e,
+    0x18, 0x66, 0x39, 0x5e, 0xd7, 0xc8, 0xf1, 0xe8, 0xf3, 0x2e, 0x86, 0x16, 0x50, 0xa9, 0x65, 0x82,
+    0x22, 0x63, 0x07, 0xd5, 0xb1, 0x6a, 0x63, 0x80, 0xbc, 0xb6, 0x81, 0x78, 0x45, 0x37, 0x51, 0xb2,
+    0x9d, 0xd5, 0x69, 0x0a, 0xd5, 0x19, 0x1c, 0xb3, 0x4a, 0x23, 0xc3, 0xbe, 0xc4, 0x51, 0x8a, 0x19,
+    0xd1, 0xc1, 0x31, 0x46, 0xbf, 0xe4, 0x88, 0xb0, 0xb9, 0x5d, 0x9f, 0x1d, 0x92, 0x69, 0xdf, 0x92,
+    0x0b, 0x56, 0x7d, 0xe2, 0x7b, 0xca, 0x27, 0xe6, 0x40, 0x6f, 0xe5, 0x6f, 0xd7, 0x94, 0xa8, 0x46,
+    0x8b, 0x79, 0x71, 0xa3, 0x28, 0x4b, 0xf1, 0xfc, 0x18, 0xdc, 0x21, 0xae, 0x9c, 0x81, 0x68, 0xe7,
+    0xb6, 0xee, 0x04, 0xee, 0x50, 0x06, 0x3b, 0x87, 0x76, 0x65, 0x4f, 0x66, 0xca, 0x17, 0x9b, 0xc5,
+    0x52, 0xd8, 0xb1, 0xd7, 0x89, 0xa3, 0x65, 0x11, 0x7c, 0x96, 0xfa, 0x54, 0xf1, 0xac, 0x71, 0xf4,
+    0x59, 0x87, 0x48, 0xee, 0xae, 0xf0, 0x4f, 0xbf, 0x0b, 0x20, 0xfc, 0x70, 0xbe, 0xc8, 0x83, 0x3d,
+    0xe7, 0x5e, 0xc1, 0x25, 0x57, 0xbc, 0x69, 0x59, 0x66, 0x4a, 0xc1, 0x64, 0xbd, 0xb3, 0xdd, 0x92,
+    0x8a, 0x24, 0xb3, 0xaa, 0x2f, 0xd6, 0x2a, 0x4c, 0x0e, 0xc4, 0x70, 0xcc, 0x5b, 0xdc, 0xe9, 0x26,
+    0xdf, 0xac, 0xd7, 0xd7, 0x1f, 0x47, 0x23, 0x08, 0xb2, 0x6b, 0x14, 0x37, 0x2f, 0x62, 0x6c, 0x88,
+    0x53, 0xb3, 0x44, 0xe0, 0x58, 0x15, 0xbe, 0x7b, 0x19, 0xd4, 0x0e, 0x3b, 0xb1, 0x1a, 0x07, 0x45,
+    0x83, 0x8f, 0x1c, 0x9d, 0x39, 0x94, 0x63, 0x74, 0x1c, 0x81, 0xbd, 0xf7, 0x0f, 0x79, 0x04, 0x42,
+    0x9c, 0xca, 0x60, 0xbe, 0x6b, 0xf0, 0xe8, 0x92, 0xb8, 0x25, 0x1b, 0xb6, 0xbe, 0x94, 0x3a, 0xeb,
+    0xd1, 0x6c, 0x26, 0x78, 0xdf, 0x07, 0xb9, 0x62, 0x40, 0xba, 0x49, 0x30, 0xc7, 0x90, 0x8f, 0x4d,
+    0xcd, 0xac, 0x86, 0x60, 0xd5, 0xa4, 0x1b, 0x37, 0x87, 0x60, 0x35, 0xe9, 0x6e, 0x39, 0x09, 0x31,
+    0x6d, 0x8d, 0x8e, 0x1e, 0x9c, 0xfa, 0x92, 0xc5, 0x61, 0xa9, 0x62, 0x01, 0x71, 0x44, 0xb9, 0x24,
+    0x41, 0xb4, 0x77, 0x92, 0x29, 0x68, 0x83, 0x06, 0xd6, 0x1d, 0x6c, 0x0a, 0x5d, 0xb2, 0xe1, 0x0b,
+    0xd8, 0xfa, 0x24, 0xa9, 0x4f, 0x33, 0xd4, 0xc9, 0x5a, 0x55, 0x05, 0x6b, 0x44, 0x88, 0xd3, 0x12,
+    0x0d, 0x56, 0xc6, 0x71, 0xb4, 0xdd, 0xea, 0xdf, 0xd6, 0xa5, 0x2c, 0xdd, 0x38, 0x84, 0x3d, 0xa8,
+    0x3a, 0x33, 0x12, 0xb2, 0xa3, 0x2c, 0xdc, 0xab, 0x30, 0xb9, 0x32, 0x0a, 0x7d, 0xf9, 0x8e, 0x75,
+    0x01, 0x52, 0xf7, 0x92, 0x34, 0xe4, 0xb4, 0x88, 0xe9, 0xc1, 0xca, 0xa8, 0x53, 0x96, 0x13, 0x60,
+    0x9d, 0x88, 0xe9, 0xd1, 0x73, 0x73, 0x30, 0xc9, 0xd5, 0x8d, 0x82, 0x7e, 0x80, 0xe8, 0xc6, 0x51,
+    0x94, 0xd6, 0x56, 0xb5, 0x77, 0x99, 0x9e, 0x2d, 0x85, 0x42, 0x64, 0x87, 0x0b, 0x9f, 0xae, 0x3d,
+    0x5c, 0xa4, 0x69, 0x14, 0xae, 0x54, 0x60, 0xaa, 0x0e, 0x1e, 0x20, 0x83, 0x8b, 0xf3, 0x83, 0x0e,
+    0x77, 0x08, 0xfc, 0x03, 0xa8, 0x03, 0xa5, 0x21, 0x86, 0xe3, 0x34, 0xc0, 0x3a, 0xba, 0x4c, 0x8a,
+    0x51, 0x73, 0x5e, 0xa7, 0x9b, 0xfa, 0x9e, 0x27, 0xc3, 0x01, 0x55, 0x8a, 0xd1, 0x2f, 0x80, 0x07,
+    0xa1, 0xff, 0xb5, 0x06, 0x14, 0xa1, 0x51, 0x45, 0x02, 0x6d, 0x1b, 0xea, 0xa6, 0xde, 0x32, 0x67,
+    0xbd, 0xf7, 0x60, 0x5f, 0x9d, 0xae, 0x3f, 0xd8, 0x57, 0xf7, 0x0f, 0xf0, 0xa8, 0x0a, 0xfe, 0x78,
+    0xfe, 0x95, 0x18, 0x81, 0x64, 0x25, 0xa7, 0x0d, 0x3e, 0x45, 0x68, 0x08, 0x37, 0xf6, 0xdd, 0x36,
+    0xe3, 0x39, 0x6d, 0xa4, 0xf1, 0x42, 0xe2, 0x29, 0x3d, 0x8c, 0x2b, 0x8e, 0xce, 0x8e, 0x16, 0x1a,
+    0x67, 0x10, 0xf1, 0x3d, 0xe0, 0x8a, 0x1d, 0x7e, 0x84, 0x07, 0x63, 0x98, 0x51, 0x90, 0xaf, 0x85,
+    0x4c, 0x13, 0x60, 0x0a, 0xd0, 0x1d, 0xea, 0x39, 0x30, 0xba, 0x71, 0xf6, 0x3f, 0xbf, 0xfd, 0xf9,
+    0xaf, 0x80, 0x6a, 0x68, 0x3e, 0xab, 0x76, 0x7e, 0xf3, 0x9b, 0xdf, 0x6d, 0xec, 0x83, 0x89, 0x5f,
+    0xaa, 0x4e, 0xa6, 0x86, 0x69, 0xa7, 0x8f, 0xd3, 0xae, 0x1e, 0x4a, 0x55, 0xb9, 0x86, 0x71, 0x17,
+    0x02, 0x18, 0xd3, 0x55, 0xa3, 0xe6, 0x7a, 0x90, 0x2e, 0x8d, 0x37, 0xce, 0x2e, 0x60, 0x33, 0x52,
+    0xf1, 0x09, 0xaa, 0xee, 0xab, 0xb9, 0x38, 0xc7, 0x3a, 0xcd, 0x83, 0xfd, 0x79, 0x75, 0xb9, 0xaa,
+    0xf0, 0x9d, 0x71, 0x0c, 0xd1, 0x6b, 0xd6, 0xe0, 0xc3, 0x0c, 0x58, 0xa6, 0xc7, 0x62, 0x84, 0xd0,
+    0x10, 0x71, 0x14, 0xc8, 0xd3, 0x06, 0xb6, 0x2b, 0x66, 0x3c, 0xb8, 0xd3, 0x6e, 0x33, 0x06, 0xd1,
+    0x6e, 0xab, 0xa6, 0x84, 0x23, 0x80, 0x8c, 0xf7, 0xe0, 0xf7, 0x14, 0x37, 0x29, 0x06, 0x80, 0x24,
+    0x69, 0x78, 0x0d, 0xcd, 0xaa, 0x6e, 0x46, 0x14, 0x6b, 0xc6, 0x9a, 0x5b, 0x96, 0x97, 0x56, 0xb3,
+    0x7e, 0x1e, 0x91, 0x3f, 0xd5, 0xcc, 0x60, 0x80, 0xc2, 0xf7, 0x4a, 0x18, 0xea, 0x58, 0xff, 0xcb,
+    0xbf, 0x51, 0xac, 0x17, 0xe7, 0x1c, 0xd1, 0x89, 0x4b, 0x7f, 0x26, 0x8d, 0x2d, 0x50, 0x38, 0xe6,
+    0x05, 0x0c, 0x58, 0x01, 0x6d, 0x9c, 0x3d, 0xa6, 0x4b, 0x2d, 0x02, 0x8b, 0x28, 0x82, 0x0e, 0xbc,
+    0x64, 0x38, 0x92, 0x19, 0x97, 0x4b, 0x5b, 0x59, 0xa6, 0x94, 0x4b, 0x24, 0x9a, 0x29, 0x90, 0x5b,
+    0x9e, 0x36, 0xe6, 0x60, 0xa5, 0x52, 0xd9, 0x28, 0xe0, 0x35, 0x49, 0xf6, 0xa2, 0x14, 0x6b, 0xe3,
+    0x6a, 0x69, 0x0c, 0xe0, 0x71, 0x94, 0xd2, 0x9d, 0x94, 0x4c, 0x7a, 0x6a, 0xe6, 0x19, 0x95, 0x1b,
+    0xc5, 0x15, 0x5e, 0xea, 0x05, 0x93, 0xa0, 0xd7, 0xf1, 0x62, 0x3c, 0x2e, 0x03, 0x2a, 0xd0, 0x5f,
+    0x7c, 0x30, 0x99, 0x8e, 0x4c, 0x6e, 0xd4, 0x2f, 0x33, 0x2f, 0x8d, 0x1a, 0x1b, 0xd2, 0x38, 0x6b,
+    0xb7, 0xfb, 0xf4, 0xff, 0x2d, 0x0c, 0xca, 0x6b, 0x8b, 0x3c, 0x93, 0x3e, 0x9d, 0x7d, 0x18, 0xb9,
+    0x68, 0x6d, 0x3a, 0x9d, 0xce, 0x26, 0xda, 0x60, 0x0d, 0x2c, 0x7c, 0x2c, 0xc0, 0x28, 0x9c, 0x1f,
+    0xa2, 0xb1, 0xca, 0xee, 0x0d, 0xb1, 0x90, 0xee, 0x28, 0xa2, 0x7c, 0x1c, 0xfc, 0xa7, 0x14, 0xd1,
+    0x02, 0x86, 0x3a, 0x11, 0xfd, 0xc5, 0x3f, 0x69, 0x11, 0x2d, 0xac, 0x63, 0x37, 0x19, 0xfd, 0xc1,
+    0xc2, 0x07, 0xbd, 0x4c, 0x64, 0x2a, 0xd4, 0xa6, 0x0b, 0xc2, 0xc7, 0x59, 0xf2, 0x66, 0x59, 0x55,
+    0x0f, 0x35, 0x0b, 0xc6, 0x22, 0x9a, 0x36, 0x02, 0x94, 0x01, 0x98, 0x4c, 0x3b, 0x6d, 0x7c, 0x98,
+    0x43, 0x17, 0xd1, 0x9c, 0x02, 0x2d, 0x93, 0x2f, 0xec, 0x6d, 0x0c, 0x58, 0x42, 0x17, 0x3f, 0x1a,
+    0x22, 0x0a, 0xc1, 0x49, 0x8c, 0xde, 0x00, 0xf9, 0x53, 0x4c, 0x18, 0x29, 0xb5, 0x6a, 0x5a, 0x54,
+    0xfb, 0xb4, 0x5a, 0xcc, 0x2b, 0x18, 0xfc, 0x3d, 0x7c, 0x56, 0x8c, 0x02, 0xe6, 0xfc, 0xf6, 0x9f,
+    0x35, 0x73, 0xd0, 0xd6, 0x89, 0x57, 0xf3, 0x07, 0xfb, 0x8c, 0xe3, 0x46, 0xa4, 0xe4, 0x94, 0x37,
+    0x61, 0x8d, 0xa5, 0x67, 0xe0, 0xfc, 0x58, 0x7a, 0x39, 0xc6, 0xaf, 0x7f, 0xaf, 0x31, 0x5e, 0x20,
+    0x84, 0x9d, 0xf1, 0xb1, 0xe6, 0xd6, 0xa3, 0xc3, 0x3e, 0x03, 0xdf, 0xa3, 0x60, 0x21, 0x0d, 0x84,
+    0xff, 0xa6, 0x11, 0x62, 0xfb, 0xce, 0xf8, 0xa2, 0xf1, 0x78, 0x13, 0x3a, 0xe8, 0x32, 0xb0, 0x81,
+    0xde, 0x6b, 0x64, 0xdf, 0xfc, 0xfa, 0x5f, 0x35, 0xae, 0xcb, 0x45, 0x1c, 0xb2, 0x49, 0x28, 0xe2,
+    0xdb, 0x2c, 0x19, 0x2a, 0xfd, 0xbe, 0x79, 0xbb, 0x55, 0x42, 0xc3, 0x04, 0xcc, 0xdc, 0x70, 0xe1,
+    0x06, 0x4a, 0xa6, 0x1f, 0xa5, 0xa1, 0x41, 0x73, 0x1a, 0x4d, 0x26, 0x81, 0x7c, 0x4e, 0x03, 0x9e,
+    0x47, 0x9e, 0x6c, 0x02, 0xcd, 0xa4, 0x27, 0xa7, 0x8d, 0x4b, 0xea, 0x12, 0xdc, 0xa7, 0x35, 0x62,
+    0xb3, 0xe5, 0x64, 0x1f, 0xfc, 0xeb, 0x5f, 0xfd, 0xf7, 0x7f, 0xfc, 0xb5, 0x5e, 0x1f, 0xf7, 0x57,
+    0x28, 0xb8, 0x44, 0x23, 0x79, 0xf6, 0x24, 0xc4, 0x42, 0x9e, 0x02, 0x5f, 0x35, 0x8a, 0x5b, 0x39,
+    0x82, 0x06, 0xe7, 0x51, 0x8c, 0x6a, 0x10, 0x42, 0x38, 0x2d, 0x9a, 0x7e, 0xe8, 0x41, 0x0e, 0x0d,
+    0xbf, 0x40, 0xf7, 0xa2, 0xb1, 0x98, 0xc1, 0x42, 0x5a, 0x99, 0xa3, 0x54, 0x1c, 0xa4, 0x58, 0x07,
+    0x29, 0xc9, 0xe3, 0x4b, 0x08, 0xcf, 0x4c, 0x4e, 0x92, 0x7a, 0x09, 0x08, 0xdf, 0x31, 0x42, 0xd1,
+    0xc0, 0x2f, 0x02, 0xf2, 0xdd, 0x7a, 0x95, 0x34, 0xa6, 0xa1, 0x81, 0xd5, 0x65, 0x75, 0x3b, 0xa6,
+    0xde, 0xf5, 0x76, 0xe8, 0xeb, 0x9f, 0x65, 0x72, 0x98, 0x51, 0xd0, 0x37, 0xf8, 0x98, 0xd3, 0xf5,
+    0x17, 0x2e, 0x09, 0x30, 0x9a, 0x77, 0x9a, 0x70, 0xef, 0xc1, 0x3e, 0xd1, 0x56, 0x6f, 0xe8, 0xf3,
+    0x79, 0x94, 0xa5, 0xcd, 0x71, 0x45, 0x6a, 0x0d, 0xd5, 0xf3, 0x5f, 0x5d, 0xbf, 0xc5, 0x10, 0xfb,
+    0xa6, 0xd5, 0x14, 0xe5, 0x81, 0x52, 0x54, 0x91, 0x5e, 0xcf, 0x01, 0x6e, 0x8c, 0xca, 0xd0, 0x28,
+    0x51, 0xad, 0xb9, 0x09, 0xb9, 0xe0, 0x69, 0xc3, 0x81, 0xbf, 0xee, 0xdb, 0xd3, 0x06, 0xa4, 0xba,
+    0x0d, 0x48, 0xaf, 0x60, 0x3d, 0xd4, 0xa6, 0xe8, 0x32, 0xca, 0x03, 0x48, 0xb0, 0x0b, 0xf0, 0x46,
+    0x2a, 0x41, 0xd7, 0x91, 0xf1, 0xf1, 0xcd, 0x67, 0x43, 0xe5, 0x62, 0xe7, 0x7d, 0xe3, 0xa0, 0x93,
+    0xab, 0x88, 0x78, 0xf7, 0x4f, 0x14, 0x1a, 0x10, 0x67, 0xa9, 0x24, 0x70, 0xc3, 0x89, 0x56, 0x25,
+    0x3e, 0x77, 0x06, 0x0d, 0x83, 0x2f, 0xa2, 0x60, 0xbe, 0xf3, 0x9d, 0xa5, 0x6b, 0xb2, 0x37, 0xc5,
+    0x01, 0x45, 0x5f, 0xab, 0x84, 0xff, 0x62, 0x34, 0x95, 0xde, 0x02, 0xd4, 0xe7, 0x96, 0xd1, 0x60,
+    0x82, 0xf3, 0x6a, 0x5c, 0xed, 0x86, 0xf0, 0xa0, 0xe4, 0x46, 0x0b, 0xb3, 0xeb, 0xc4, 0xf7, 0xab,
+    0x2f, 0x33, 0xbb, 0xad, 0x09, 0xbc, 0x90, 0x69, 0x0a, 0xac, 0x49, 0xca, 0x51, 0x48, 0x7d, 0xb0,
+    0x37, 0x06, 0x8e, 0x0b, 0x72, 0x3f, 0xe2, 0x13, 0x50, 0xea, 0x68, 0x99, 0x74, 0xc4, 0x8b, 0x45,
+    0x9a, 0x80, 0xd4, 0xa0, 0x62, 0xa7, 0x53, 0x99, 0x48, 0x5b, 0xb9, 0x57, 0x3f, 0x81, 0x88, 0xd0,
+    0xeb, 0x18, 0x0e, 0xb6, 0x64, 0x25, 0xe8, 0x40, 0x25, 0xa3, 0x1b, 0x88, 0x79, 0x0a, 0x0d, 0x0d,
+    0x11, 0x46, 0x20, 0x6b, 0x3e, 0x86, 0x3a, 0xf5, 0xab, 0xce, 0xca, 0x75, 0xbc, 0x68, 0x72, 0x8e,
+    0x8a, 0x98, 0xf3, 0x3c, 0xbf, 0x29, 0xe2, 0x2a, 0x42, 0x50, 0xd5, 0x8f, 0x46, 0x8d, 0xcd, 0xc1,
+    0xfb, 0x35, 0x03, 0x51, 0xbc, 0x7c, 0x20, 0x8a, 0x76, 0x28, 0xb7, 0xe9, 0xac, 0x48, 0xfc, 0xd0,
+    0xd8, 0x6a, 0xe1, 0x41, 0xfe, 0x98, 0x44, 0xb4, 0xee, 0x67, 0x05, 0xd1, 0xab, 0x31, 0xd2, 0xff,
+    0xf8, 0x4b, 0xbd, 0x4d, 0x0f, 0x3d, 0x4f, 0x3b, 0x75, 0xc5, 0x70, 0x93, 0x8c, 0xaa, 0x1b, 0xdc,
+    0x61, 0xd1, 0x9b, 0x17, 0x02, 0x99, 0xd3, 0xcc, 0x4f, 0x1b, 0xf5, 0x91, 0x09, 0xed, 0x93, 0x7b,
+    0x25, 0x77, 0x59, 0x00, 0xc4, 0x6b, 0xff, 0x99, 0x09, 0x1a, 0xcc, 0xc9, 0xa4, 0x6d, 0x2b, 0xf1,
+    0x3b, 0xf2, 0x95, 0x2b, 0xe9, 0xa6, 0x5b, 0x0f, 0xc0, 0x82, 0x68, 0x0c, 0xcd, 0x96, 0x8e, 0xb1,
+    0xa1, 0x71, 0x37, 0x5a, 0xff, 0xee, 0x6f, 0x0d, 0x97, 0x78, 0x8e, 0xf3, 0x32, 0xa5, 0xd8, 0x85,
+    0xd9, 0xb5, 0x22, 0x8a, 0x65, 0x9f, 0x9c, 0x67, 0x2a, 0xc9, 0x50, 0x11, 0xe3, 0x96, 0xac, 0xa7,
+    0x64, 0x63, 0x50, 0xd2, 0xb7, 0x18, 0x99, 0x8f, 0x64, 0xba, 0x8c, 0xe2, 0x5b, 0x67, 0x9c, 0xa1,
+    0xfc, 0xd3, 0x06, 0xf3, 0x06, 0xfc, 0x9b, 0x02, 0x10, 0xbd, 0x82, 0x0d, 0x46, 0x68, 0x83, 0x19,
+    0x82, 0x90, 0xc4, 0x9d, 0x48, 0xc1, 0xef, 0x53, 0x80, 0x5a, 0xb4, 0x9f, 0xfa, 0xf8, 0x86, 0x43,
+    0xc8, 0xab, 0xff, 0x36, 0x01, 0xbd, 0xda, 0x12, 0x63, 0x5e, 0x99, 0xf0, 0xba, 0x32, 0x08, 0xd8,
+    0xd3, 0x7f, 0xaf, 0x04, 0x46, 0x5b, 0x18, 0x65, 0xe6, 0xa0, 0x67, 0xe7, 0x4c, 0xb0, 0xf4, 0x44,
+    0x1a, 0x69, 0x3e, 0x54, 0x97, 0x5f, 0x9d, 0x0d, 0x4a, 0x9a, 0x65, 0xab, 0x60, 0x61, 0xa3, 0x39,
+    0xdd, 0x95, 0x09, 0x27, 0x02, 0xf7, 0x5d, 0xa5, 0x37, 0x61, 0x2d, 0xb8, 0x1d, 0x79, 0xa1, 0x0a,
+    0x74, 0x5a, 0x5a, 0xc3, 0xa8, 0x90, 0x8e, 0x3f, 0x98, 0x1e, 0x9c, 0x7d, 0x2c, 0x31, 0x97, 0x62,
+    0xbe, 0xe7, 0x3b, 0x07, 0x1d, 0x86, 0xf7, 0x38, 0xbb, 0x9c, 0x02, 0x75, 0x4b, 0x3f, 0x08, 0x60,
+    0x9f, 0x02, 0x99, 0x4a, 0x81, 0x8a, 0xe0, 0x69, 0xd2, 0xa0, 0x11, 0x0c, 0x75, 0x90, 0x08, 0x37,
+    0xf4, 0xc0, 0x4b, 0xa4, 0x18, 0x68, 0x83, 0xf3, 0xd0, 0x7b, 0x0a, 0x2c, 0x01, 0x14, 0x8b, 0x39,
+    0x45, 0x8a, 0x9d, 0xe2, 0x8e, 0xd6, 0xc7, 0xd3, 0x15, 0xab, 0x00, 0xba, 0x33, 0x91, 0xe9, 0x27,
+    0xfe, 0x53, 0x5f, 0x9b, 0x84, 0xa5, 0x3f, 0xf6, 0xcb, 0x16, 0xa1, 0xd6, 0x49, 0xea, 0x4d, 0x15,
+    0x4f, 0x09, 0x06, 0xaf, 0xf4, 0xa6, 0xd0, 0xb7, 0xa4, 0xa5, 0xf8, 0x80, 0xf5, 0x21, 0x4e, 0xc0,
+    0xb9, 0x68, 0x79, 0xf6, 0x5f, 0xff, 0x22, 0x7a, 0x4e, 0xef, 0x48, 0x7c, 0x3f, 0x82, 0x6d, 0x12,
+    0x1f, 0xb8, 0x01, 0xac, 0x56, 0x76, 0xc4, 0x43, 0x60, 0x12, 0xc5, 0x1c, 0xe8, 0x30, 0x13, 0x19,
+    0x5f, 0x91, 0xd7, 0x54, 0x73, 0xf6, 0xf4, 0x4e, 0x3d, 0xd0, 0xef, 0xdc, 0x04, 0x79, 0x22, 0xcb,
+    0x57, 0xc8, 0x4f, 0x05, 0x65, 0x33, 0x03, 0xea, 0xf1, 0x13, 0x55, 0x1e, 0x80, 0xe6, 0xb1, 0x1b,
+    0x24, 0x92, 0x9b, 0x4d, 0x2f, 0x09, 0x3d, 0xaf, 0x3f, 0xd3, 0xa3, 0xf3, 0xd4, 0xa2, 0x38, 0x21,
+    0x8f, 0x09, 0xa1, 0x1d, 0x22, 0xae, 0xc1, 0xde, 0x1e, 0xd6, 0x03, 0x53, 0x71, 0x17, 0x9e, 0x9b,
+    0x3e, 0x84, 0x61, 0xa7, 0x67, 0xc2, 0x8b, 0x46, 0x8b, 0x19, 0xd0, 0xd1, 0x01, 0x36, 0x3d, 0x09,
+    0x24, 0x7e, 0x7c, 0x74, 0xfd, 0xcc, 0xc3, 0x6e, 0x18, 0x9f, 0xf5, 0x82, 0xf7, 0x7b, 0x82, 0xb7,
+    0xb8, 0x3f, 0xf4, 0x93, 0x54, 0x82, 0x77, 0x6e, 0x5a, 0x8f, 0x5f, 0x3c, 0x3f, 0xe7, 0x83, 0x4c,
+    0xa4, 0x16, 0x12, 0x4d, 0x5b, 0xb8, 0xc9, 0x75, 0x38, 0x12, 0x4d, 0x82, 0x8b, 0x47, 0xe2, 0xfb,
+    0xfb, 0xe2, 0x12, 0x24, 0x62, 0x8e, 0xaa, 0xee, 0xa7, 0x89, 0x0c, 0xc6, 0x28, 0xef, 0xa8, 0x05,
+    0xfe, 0x68, 0x90, 0x89, 0x3a, 0x3e, 0x4b, 0xd0, 0x7e, 0xba, 0xde, 0x1d, 0x47, 0x33, 0x43, 0x8a,
+    0xe8, 0x1c, 0x1c, 0x29, 0xe6, 0x31, 0xa7, 0xc2, 0x5d, 0xba, 0x3e, 0xe4, 0xfe, 0x80, 0xf0, 0x82,
+    0xce, 0x15, 0x91, 0x46, 0xc2, 0xf3, 0x8c, 0xdf, 0xc5, 0xf2, 0x7f, 0x2c, 0x99, 0x4f, 0x20, 0xb7,
+    0xcc, 0xa8, 0x12, 0x44, 0x86, 0x94, 0xc1, 0x55, 0xaf, 0x70, 0xe5, 0x5c, 0xa5, 0xee, 0x4e, 0x81,
+    0xd5, 0x3f, 0xf9, 0x89, 0xb0, 0x2c, 0x3c, 0x5e, 0xf7, 0xc7, 0x98, 0x06, 0x99, 0x13, 0x3a, 0x69,
+    0xec, 0xcf, 0x60, 0xbd, 0x77, 0x4e, 0x61, 0x03, 0xad, 0x16, 0x2d, 0x5a, 0x94, 0x37, 0xaa, 0x34,
+    0x05, 0x82, 0x7d, 0x3f, 0x6d, 0x5a, 0xb6, 0xd5, 0xea, 0xcc, 0xdc, 0x79, 0xb3, 0x39, 0x77, 0xfd,
+    0x38, 0xe3, 0x18, 0xfe, 0x30, 0x65, 0xaf, 0x81, 0x92, 0x38, 0xb5, 0x05, 0xa4, 0x5c, 0x9f, 0x01,
+    0x10, 0x1c, 0xa5, 0xb0, 0x69, 0x08, 0x6d, 0x8b, 0x0e, 0xfd, 0xf1, 0x47, 0xa9, 0xdf, 0x4a, 0xe4,
+    0x93, 0xc4, 0x9a, 0x3b, 0xd7, 0x34, 0x68, 0x2d, 0x24, 0x88, 0x45, 0x3d, 0x7d, 0x28, 0x48, 0x30,
+    0x62, 0x0f, 0xc1, 0x40, 0x7e, 0x17, 0x7f, 0xcf, 0xe8, 0xce, 0x19, 0x7c, 0x99, 0xb3, 0x30, 0x5e,
+    0x84, 0x09, 0xb1, 0x54, 0x07, 0x7d, 0x03, 0x7a, 0xa2, 0x6d, 0x8e, 0xc2, 0xe0, 0x5a, 0xe0, 0x91,
+    0x4d, 0x82, 0x3b, 0x4e, 0xca, 0x8f, 0x9c, 0x2b, 0xca, 0x28, 0x33, 0x79, 0x46, 0x0f, 0xc8, 0x39,
+    0x4e, 0x5d, 0x89, 0xc7, 0x8b, 0x39, 0x46, 0x8d, 0xcf, 0x0b, 0xd9, 0x34, 0xe9, 0x6a, 0xed, 0x56,
+    0x73, 0x81, 0x86, 0xcd, 0xea, 0xc6, 0x9d, 0x66, 0x90, 0xec, 0xc0, 0x9b, 0x8c, 0x9a, 0xe7, 0xe1,
+    0xc6, 0x52, 0x0d, 0xa1, 0x06, 0xb2, 0xa1, 0x3b, 0x09, 0x25, 0x54, 0x78, 0xbd, 0xc2, 0xd4, 0xa7,
+    0x8f, 0x16, 0xb3, 0x21, 0xa8, 0x01, 0xc3, 0xcb, 0x7b, 0x88, 0xdb, 0x64, 0xf8, 0x1e, 0x95, 0x32,
+    0x32, 0x83, 0x95, 0x11, 0x6c, 0x50, 0xb2, 0x88, 0x25, 0x51, 0x0b, 0x9a, 0x25, 0x94, 0x41, 0x44,
+    0xb3, 0x9a, 0xe0, 0x4b, 0x54, 0x78, 0x18, 0x86, 0xc5, 0xc6, 0x24, 0x13, 0x54, 0x18, 0x05, 0x86,
+    0x0f, 0xf0, 0xde, 0x6d, 0x5a, 0x66, 0x24, 0xca, 0x32, 0x80, 0x92, 0xa9, 0x46, 0x7c, 0xe7, 0x3b,
+    0xe2, 0x0e, 0x7f, 0xec, 0xfc, 0xd5, 0x10, 0xf3, 0x33, 0x2d, 0x95, 0xaa, 0xb1, 0xaa, 0xc8, 0x64,
+    0x6d, 0x51, 0x7b, 0x3d, 0xcf, 0xd8, 0x7a, 0x25, 0x5b, 0x05, 0x50, 0x80, 0x1e, 0xdd, 0x26, 0x8b,
+    0x4b, 0xc6, 0x59, 0xaa, 0x99, 0x37, 0xf5, 0xc2, 0x9f, 0x61, 0xce, 0x0a, 0xd1, 0x7f, 0xd3, 0xe8,
+    0xb4, 0xd1, 0xfa, 0x38, 0xbc, 0x7e, 0x70, 0x7e, 0x68, 0x05, 0x87, 0x32, 0x53, 0x60, 0x94, 0xd0,
+    0x3d, 0x60, 0xcb, 0x39, 0xd5, 0x76, 0x40, 0x66, 0xc0, 0x9a, 0x90, 0xb8, 0x2e, 0xa7, 0x12, 0x78,
+    0xd4, 0x7c, 0xfe, 0x83, 0xcb, 0x4b, 0x3b, 0x93, 0x35, 0x5b, 0x44, 0xc0, 0xb5, 0x58, 0xa4, 0x58,
+    0xda, 0x48, 0x93, 0x16, 0x78, 0x75, 0x10, 0xbd, 0x45, 0x02, 0xbd, 0x62, 0x78, 0x6d, 0xda, 0x8e,
+    0xf1, 0x22, 0xe4, 0x58, 0xaa, 0x8c, 0x72, 0xa5, 0x38, 0x76, 0x87, 0x6d, 0x44, 0x87, 0xf8, 0x71,
+    0x11, 0x2d, 0xe2, 0x91, 0x6c, 0x29, 0x55, 0x1a, 0x64, 0x8c, 0x97, 0xb8, 0xd9, 0xa1, 0x5c, 0x0a,
+    0x63, 0x54, 0xd3, 0xda, 0xe7, 0x57, 0x5a, 0x98, 0xfb, 0x32, 0xa9, 0xe1, 0x2a, 0x09, 0x06, 0x70,
+    0xb5, 0x29, 0x0d, 0xe5, 0x46, 0xab, 0x9c, 0x30, 0x63, 0xd3, 0xf8, 0x1a, 0xf5, 0x15, 0x80, 0xff,
+    0xf9, 0xc5, 0x8b, 0x8f, 0x3a, 0x73, 0x7c, 0x21, 0xb5, 0x29, 0x3b, 0xc0, 0x33, 0xb7, 0x35, 0x00,
+    0x7d, 0x1d, 0xb9, 0xe9, 0x68, 0x0a, 0x23, 0x14, 0x3d, 0xa4, 0x9f, 0x4c, 0x76, 0xa2, 0xc4, 0x17,
+    0x76, 0x5a, 0x7f, 0x44, 0xfb, 0x63, 0xfa, 0x93, 0x56, 0x49, 0xe8, 0x79, 0x98, 0xda, 0x52, 0x86,
+    0x41, 0xda, 0x07, 0x20, 0xf4, 0x47, 0x53, 0x11, 0xd9, 0xa0, 0x99, 0x4a, 0xdb, 0xca, 0xac, 0x53,
+    0x59, 0x95, 0xeb, 0xd5, 0x18, 0x7f, 0xb6, 0xaa, 0x32, 0x99, 0xa6, 0xbd, 0xdc, 0xdc, 0xb1, 0x92,
+    0xb1, 0x7c, 0x97, 0x6b, 0x19, 0x96, 0x41, 0x38, 0xe6, 0x15, 0x90, 0xa5, 0x26, 0x1d, 0x53, 0x19,
+    0x11, 0x79, 0x48, 0xfa, 0x68, 0x31, 0x57, 0x8c, 0x4e, 0x5c, 0x89, 0xf1, 0x08, 0xdd, 0xb9, 0x4f,
+    0xa3, 0xcb, 0x70, 0xca, 0xe9, 0xd1, 0x40, 0xa6, 0x22, 0x5f, 0x6c, 0x41, 0xe3, 0x4d, 0xb0, 0x7a,
+    0x8d, 0xc4, 0x4b, 0x35, 0x89, 0xff, 0x76, 0xa8, 0xca, 0x22, 0x4c, 0xa4, 0x7a, 0x70, 0x61, 0x69,
+    0x54, 0x5c, 0x02, 0x1f, 0x80, 0xa1, 0xa4, 0xf2, 0xa3, 0xb5, 0x93, 0x98, 0x8b, 0xb9, 0x31, 0xf9,
+    0x9e, 0x2e, 0xb3, 0x18, 0x4c, 0x5c, 0xd3, 0x5d, 0xae, 0x3d, 0x76, 0xbf, 0x99, 0xd8, 0x1b, 0x5e,
+    0x12, 0xd7, 0x43, 0x02, 0x67, 0x70, 0x3c, 0x26, 0xc9, 0x66, 0x87, 0x3a, 0x96, 0x20, 0x6c, 0x20,
+    0xd5, 0xee, 0xdc, 0xdf, 0xd7, 0x82, 0xbb, 0x02, 0x11, 0x04, 0x9d, 0xeb, 0x03, 0x6b, 0xa3, 0x76,
+    0x92, 0x42, 0xbc, 0x63, 0x29, 0x67, 0xc2, 0xcb, 0x86, 0xf9, 0x9d, 0xe8, 0x8d, 0x56, 0x18, 0x05,
+    0x08, 0x1b, 0xbf, 0x48, 0xf4, 0x16, 0x6b, 0x29, 0x6e, 0x66, 0xf2, 0x33, 0xa2, 0x2b, 0xe2, 0x92,
+    0x8f, 0xd3, 0x9b, 0x16, 0x91, 0x47, 0x84, 0x0a, 0x6a, 0xe9, 0x03, 0x5e, 0xd9, 0xca, 0xdd, 0x91,
+    0xf2, 0x6a, 0xea, 0xd2, 0x1b, 0x19, 0x6b, 0xdb, 0xe0, 0x51, 0x1f, 0xed, 0x8a, 0x4d, 0x4e, 0x06,
+    0x7a, 0xf1, 0x95, 0x16, 0xe8, 0x36, 0xbd, 0x1b, 0xb4, 0x5a, 0xe8, 0x08, 0x81, 0x39, 0x19, 0x5b,
+    0x0a, 0x46, 0x6b, 0x95, 0xe9, 0x79, 0x18, 0x2d, 0x95, 0xa2, 0x3f, 0x56, 0x76, 0x49, 0xf7, 0xd0,
+    0xc1, 0xd8, 0x29, 0x0e, 0xe8, 0xa4, 0xd1, 0x87, 0x11, 0xbe, 0x29, 0x86, 0x87, 0x6b, 0x17, 0x29,
+    0xbe, 0x88, 0xdc, 0xb4, 0x64, 0xd8, 0x7e, 0x75, 0x61, 0xd9, 0xab, 0x29, 0x98, 0x86, 0x6e, 0xaf,
+    0x4f, 0xf1, 0x97, 0x2d, 0xf0, 0xa9, 0x6f, 0xf5, 0xda, 0x9e, 0x3f, 0xf1, 0x53, 0xa0, 0x6a, 0xe6,
+    0x87, 0x8b, 0x54, 0x9a, 0x2d, 0x10, 0x67, 0x46, 0xa1, 0x97, 0xb7, 0xac, 0x0d, 0x94, 0x1e, 0x47,
+    0x3b, 0x26, 0xca, 0xc7, 0xa4, 0xce, 0x45, 0x94, 0x4b, 0x29, 0xdf, 0x78, 0xee, 0x75, 0xdf, 0x0a,
+    0xa2, 0x70, 0x02, 0x20, 0xaf, 0x21, 0xf1, 0xed, 0xa3, 0x26, 0xc8, 0xd8, 0x1f, 0x21, 0x52, 0x90,
+    0xab, 0x69, 0xd6, 0x4b, 0x23, 0x75, 0x27, 0x63, 0xbb, 0x8b, 0xd6, 0x1f, 0x18, 0x51, 0x91, 0x43,
+    0x5c, 0xb3, 0x1a, 0x80, 0xb4, 0x54, 0xfa, 0xb1, 0xb1, 0xc8, 0x56, 0x30, 0xfd, 0x0f, 0xa9, 0x3c,
+    0xfb, 0xe8, 0xba, 0xc9, 0xd6, 0x06, 0x79, 0x8b, 0x06, 0x8f, 0xab, 0xb6, 0x30, 0x09, 0x22, 0xcc,
+    0xf3, 0x68, 0x36, 0xc7, 0x0a, 0xe0, 0x05, 0x56, 0x6d, 0x9a, 0x99, 0x26, 0xea, 0x0f, 0x4a, 0x17,
+    0x5b, 0x18, 0x8c, 0xbe, 0x8c, 0x31, 0x31, 0x4a, 0xaf, 0x49, 0x51, 0x20, 0xda, 0xa1, 0xd3, 0x37,
+    0x24, 0x84, 0x82, 0x20, 0xf6, 0x7a, 0x8c, 0x89, 0x0d, 0x80, 0x3a, 0x61, 0xf9, 0xa3, 0xa1, 0xc3,
+    0x9a, 0x49, 0x01, 0x1d, 0x45, 0x50, 0x45, 0x9c, 0x74, 0xbe, 0xf2, 0x47, 0xc3, 0x48, 0x47, 0x39,
+    0x37, 0xa1, 0xe4, 0x33, 0x96, 0x3f, 0x1d, 0x53, 0x09, 0x65, 0x06, 0xdd, 0xd2, 0x6f, 0xe6, 0x0b,
+    0x7c, 0x35, 0x1f, 0x2f, 0x9c, 0xb4, 0xc8, 0xbe, 0x6f, 0x42, 0xd2, 0xa1, 0x72, 0x5c, 0x27, 0xc9,
+    0x31, 0x21, 0x12, 0x06, 0x87, 0x21, 0x86, 0x2a, 0xe0, 0xd7, 0x28, 0xa4, 0x72, 0x55, 0xb9, 0xe8,
+    0xe4, 0x81, 0xff, 0x22, 0xc1, 0xe3, 0x0c, 0xb4, 0x56, 0x2b, 0xd6, 0xee, 0xbe, 0x85, 0x0a, 0x88,
+    0x29, 0xa6, 0x2a, 0xac, 0xdd, 0x11, 0x78, 0xfb, 0x00, 0x10, 0xc0, 0x86, 0xf4, 0x2d, 0x3a, 0xd0,
+    0xa2, 0x03, 0x70, 0x68, 0xfe, 0xfb, 0xdf, 0xa3, 0xc9, 0x80, 0xd5, 0xf6, 0x2d, 0x3c, 0x77, 0x52,
+    0x87, 0x8f, 0xff, 0xf3, 0xdb, 0x5f, 0xfc, 0x0a, 0xda, 0xc1, 0xa0, 0xf4, 0xad, 0xfc, 0xdc, 0xd8,
+    0xe2, 0xa0, 0x59, 0xe9, 0x60, 0x94, 0xb2, 0x3b, 0xca, 0x4e, 0xa8, 0xd9, 0x0f, 0xe1, 0x5b, 0x06,
+    0x94, 0x6d, 0x7e, 0xe4, 0x92, 0x5d, 0xb0, 0x70, 0xa0, 0x25, 0xde, 0x15, 0xcd, 0x4a, 0x54, 0xc9,
+    0x0a, 0x66, 0x9e, 0x52, 0x57, 0x14, 0xc9, 0x58, 0xdf, 0x6b, 0x9a, 0xff, 0x19, 0x01, 0x78, 0x15,
+    0xbe, 0x01, 0xe5, 0x0f, 0x89, 0xd7, 0xa5, 0x44, 0xb1, 0x88, 0x45, 0x45, 0x5d, 0x25, 0xd5, 0xcb,
+    0x23, 0xe9, 0x7a, 0xc7, 0x51, 0x52, 0x5c, 0x76, 0xcb, 0x2a, 0xe9, 0x6c, 0x72, 0x30, 0xfa, 0xcc,
+    0xb3, 0xc9, 0x30, 0x43, 0x8b, 0xb1, 0x1d, 0x43, 0x15, 0x83, 0xea, 0x31, 0x5a, 0x0f, 0xef, 0x40,
+    0x87, 0x19, 0x3b, 0x41, 0x93, 0x39, 0x59, 0xe0, 0xc4, 0x8e, 0xbe, 0x58, 0x6e, 0x84, 0x91, 0xdc,
+    0x41, 0x17, 0x5a, 0x3f, 0xb8, 0x7c, 0xfe, 0x21, 0xb2, 0xb3, 0x78, 0xe6, 0xcf, 0x97, 0x5d, 0xb3,
+    0xbb, 0x01, 0xe2, 0x13, 0x08, 0x91, 0xf9, 0xe0, 0xdc, 0xaa, 0xe4, 0x35, 0x25, 0x1c, 0x2a, 0x13,
+    0xce, 0x3d, 0x5e, 0x04, 0xbc, 0xf0, 0x43, 0x37, 0x40, 0x41, 0xd2, 0x0e, 0x5e, 0x9d, 0xc4, 0xf6,
+    0xad, 0x8d, 0x27, 0xb1, 0x96, 0x9d, 0x8f, 0xfd, 0x18, 0xc5, 0x6b, 0xc3, 0x09, 0xaa, 0x39, 0xee,
+    0x11, 0xc9, 0x5b, 0xfd, 0xc9, 0xa7, 0x39, 0xee, 0x05, 0xca, 0xdf, 0xc6, 0x33, 0x4b, 0x8b, 0x1d,
+    0x7c, 0x3d, 0x9f, 0xf4, 0x62, 0x5e, 0xeb, 0xad, 0x20, 0xc1, 0x29, 0x8c, 0x62, 0x3f, 0xba, 0xa6,
+    0xe0, 0xba, 0xcd, 0x3f, 0xe6, 0x91, 0x5e, 0x7e, 0x91, 0x80, 0x7e, 0x0a, 0x12, 0x51, 0x97, 0xbe,
+    0x18, 0x4a, 0x79, 0x63, 0xb0, 0xc6, 0xe3, 0x28, 0x14, 0x7a, 0x12, 0x94, 0x07, 0xaa, 0xd0, 0x47,
+    0x8b, 0x8e, 0x82, 0x06, 0xd4, 0xdf, 0x51, 0x13, 0x8a, 0x92, 0x04, 0x49, 0x37, 0xe8, 0xda, 0x47,
+    0x4d, 0x23, 0xc9, 0x6a, 0xd5, 0xd4, 0x36, 0xc4, 0xf6, 0x00, 0x4c, 0x81, 0xde, 0x1a, 0x6f, 0x6d,
+    0x8f, 0xb5, 0x14, 0xf8, 0x6a, 0xa8, 0x4f, 0x47, 0x72, 0x18, 0xea, 0xb7, 0x4e, 0xcf, 0xcc, 0x08,
+    0xeb, 0x8a, 0x44, 0x4d, 0x27, 0x8a, 0x06, 0x71, 0x2a, 0x8a, 0xaa, 0x27, 0x09, 0x5a, 0xd5, 0x8e,
+    0x9b, 0x4b, 0xcc, 0x5a, 0x6f, 0x8a, 0x07, 0x61, 0xaf, 0x13, 0x4c, 0xff, 0xf1, 0x9e, 0x18, 0xc4,
+    0x1c, 0xd1, 0x22, 0x81, 0x84, 0xbc, 0xe9, 0x49, 0x4c, 0xe0, 0x46, 0xd2, 0x6b, 0xd1, 0x20, 0x9d,
+    0x4c, 0x19, 0x9b, 0x0c, 0x73, 0x9a, 0x80, 0x84, 0x83, 0xaf, 0x5a, 0x0b, 0x5d, 0x87, 0xf3, 0x36,
+    0x32, 0x91, 0xef, 0xb5, 0xb9, 0xbf, 0x94, 0xf8, 0x45, 0x51, 0xa2, 0x93, 0xf9, 0xa1, 0x9b, 0x80,
+    0xf6, 0xe6, 0x95, 0x50, 0x36, 0x7b, 0x58, 0x63, 0x74, 0x05, 0xbe, 0x93, 0xcb, 0x25, 0x0e, 0x2c,
+    0x8e, 0xc1, 0xaf, 0x54, 0x85, 0x18, 0x23, 0x34, 0x1c, 0xef, 0xbc, 0x47, 0x3f, 0x18, 0x5a, 0xe1,
+    0x10, 0x6c, 0x8a, 0x27, 0x43, 0x97, 0xde, 0x2c, 0xd1, 0xff, 0x9c, 0x8e, 0x73, 0xd4, 0xb2, 0x74,
+    0xf0, 0x50, 0x30, 0xac, 0x46, 0x0c, 0xb1, 0x62, 0x80, 0xe5, 0xef, 0x10, 0xb1, 0x06, 0x25, 0xc8,
+    0x8e, 0xdd, 0x3b, 0x3a, 0xc2, 0x5b, 0x80, 0x78, 0x7d, 0xd8, 0xe2, 0x1c, 0x2d, 0x73, 0xd9, 0x15,
+    0xe0, 0x14, 0x2c, 0x18, 0xa0, 0xf3, 0xaf, 0x16, 0xa9, 0x00, 0x56, 0x60, 0x11, 0xb0, 0x73, 0x33,
+    0x60, 0x0e, 0x09, 0x0c, 0xc8, 0xe6, 0xf7, 0xd2, 0x54, 0x60, 0x1f, 0x00, 0x27, 0x0e, 0x0f, 0x99,
+    0x72, 0x83, 0x6e, 0xde, 0xc5, 0xf9, 0xa8, 0xa8, 0x15, 0xa8, 0x95, 0xa6, 0x6e, 0xb1, 0x7b, 0x37,
+    0x5e, 0x8d, 0x3a, 0x15, 0x9f, 0xd7, 0x9f, 0xff, 0x8a, 0xbb, 0x2b, 0xc2, 0xbb, 0xa6, 0xc3, 0xdf,
+    0xbb, 0xab, 0xd1, 0x1a, 0x7e, 0x01, 0xf8, 0x75, 0xf9, 0x28, 0xb8, 0xbe, 0x95, 0x0e, 0x88, 0x3f,
+    0xaf, 0x60, 0xd6, 0x2f, 0x58, 0x9d, 0x8a, 0x26, 0x91, 0x0a, 0xcb, 0x77, 0xc4, 0xfb, 0xc2, 0xe9,
+    0x1c, 0x1e, 0x09, 0xc8, 0x06, 0x58, 0x6e, 0x8b, 0xb5, 0x4f, 0x8c, 0x03, 0xa2, 0x45, 0x3a, 0x30,
+    0xec, 0xdb, 0x66, 0xe9, 0xd7, 0xa5, 0x81, 0xca, 0xf4, 0x96, 0xa0, 0xe3, 0x28, 0xf5, 0x54, 0xd3,
+    0x3f, 0x28, 0x14, 0x88, 0x54, 0x2b, 0x3a, 0x78, 0x99, 0xea, 0x49, 0x68, 0x1f, 0x48, 0x39, 0x73,
+    0xc4, 0x84, 0xd4, 0x16, 0xf7, 0x1d, 0xc8, 0xf9, 0x41, 0x13, 0xf0, 0x76, 0x3b, 0x28, 0x91, 0xd6,
+    0xd6, 0x9a, 0xa4, 0xae, 0x66, 0xfa, 0xae, 0xc9, 0x1d, 0x3a, 0xfa, 0x6c, 0xe6, 0xfb, 0x7c, 0x19,
+    0x00, 0xe3, 0x16, 0x19, 0x8e, 0x20, 0x81, 0x7a, 0xf5, 0xf1, 0x33, 0x8c, 0x23, 0xa3, 0x10, 0xb7,
+    0x10, 0xc1, 0x66, 0xa9, 0x9e, 0xce, 0xf4, 0xb4, 0xcf, 0x04, 0x3a, 0xc3, 0x08, 0x82, 0x2f, 0x17,
+    0xb5, 0x7e, 0xee, 0xce, 0x06, 0x54, 0xef, 0xe3, 0xca, 0x5f, 0x34, 0x1a, 0xb9, 0x09, 0xd0, 0xe9,
+    0x06, 0xc1, 0xb5, 0x91, 0x22, 0x93, 0x25, 0xa4, 0xbd, 0x02, 0x79, 0xd2, 0x0f, 0xb0, 0xc5, 0xf8,
+    0x48, 0x9d, 0xf8, 0xfe, 0x0e, 0x8f, 0x68, 0xe5, 0xd9, 0xb7, 0x20, 0xc0, 0x97, 0x88, 0xa8, 0x69,
+    0x19, 0x8e, 0x0b, 0x89, 0xc6, 0x49, 0xef, 0x0a, 0xeb, 0x9e, 0x65, 0x5b, 0xea, 0xc6, 0x77, 0x5e,
+    0x0d, 0x5d, 0xe7, 0x89, 0x31, 0x27, 0xa0, 0x90, 0x7f, 0xd6, 0xa6, 0x9f, 0x06, 0x4c, 0x6a, 0x31,
+    0xb2, 0x4f, 0xf6, 0x9a, 0x2f, 0xfd, 0x11, 0x46, 0x1b, 0x60, 0x7a, 0xd8, 0x38, 0xa5, 0x10, 0x12,
+    0x24, 0x66, 0x8d, 0x11, 0xf7, 0x38, 0x1a, 0xf3, 0xb7, 0x29, 0x60, 0x1a, 0x0a, 0xb6, 0x27, 0x2a,
+    0x94, 0x46, 0x11, 0x0a, 0x08, 0xce, 0x95, 0xc4, 0x7a, 0xa8, 0x70, 0x21, 0x15, 0x93, 0x62, 0x01,
+    0x96, 0x39, 0xc8, 0xe7, 0x50, 0x4d, 0x7c, 0xe9, 0xa7, 0x23, 0x2a, 0x61, 0x81, 0x6a, 0x01, 0x2b,
+    0xcb, 0xdb, 0x6e, 0xde, 0x7b, 0xca, 0x43, 0x64, 0xd8, 0x9b, 0xec, 0xac, 0xa0, 0xe0, 0x33, 0x8d,
+    0x03, 0x04, 0x1d, 0x69, 0xb1, 0x5c, 0xcc, 0xdc, 0xb9, 0x19, 0x46, 0xeb, 0xf0, 0x47, 0x47, 0xce,
+    0x1c, 0xe2, 0x64, 0x01, 0xb3, 0x8a, 0x64, 0x74, 0xa0, 0xcc, 0x01, 0x4b, 0x21, 0x48, 0xf6, 0xd1,
+    0x02, 0x00, 0x50, 0x15, 0xbb, 0x2a, 0xc3, 0x8a, 0x47, 0x0b, 0x95, 0xb0, 0xd2, 0x87, 0x80, 0x12,
+    0x89, 0xe1, 0x32, 0x20, 0x08, 0xec, 0x2a, 0x2b, 0x25, 0xdc, 0x29, 0x14, 0x95, 0xb0, 0x82, 0xd9,
+    0x64, 0xd1, 0x05, 0x20, 0x1c, 0x9d, 0xd3, 0xbd, 0x29, 0x9a, 0x0d, 0xf2, 0x91, 0x4e, 0x63, 0x90,
+    0x37, 0xaa, 0xc9, 0xf1, 0x3e, 0xd2, 0x34, 0x66, 0x11, 0xa8, 0x90, 0x1f, 0xa0, 0xa1, 0x1d, 0xdc,
+    0xac, 0x0d, 0xc4, 0xce, 0xf7, 0x89, 0xf2, 0x4d, 0x8a, 0xc0, 0xbc, 0xde, 0xa8, 0x0a, 0x35, 0xa9,
+    0x8b, 0x16, 0x42, 0x43, 0x74, 0xd9, 0x54, 0x33, 0x7d, 0x9e, 0x50, 0xe2, 0x3a, 0x5e, 0x80, 0x8a,
+    0xdc, 0xd1, 0x57, 0xbf, 0x48, 0x0e, 0x64, 0xc8, 0xa1, 0xeb, 0x37, 0xbf, 0xf9, 0x5d, 0x55, 0xac,
+    0x55, 0xa4, 0x5b, 0x59, 0xfb, 0xc7, 0xf2, 0x47, 0x0b, 0x09, 0x6b, 0x34, 0xd7, 0x9d, 0x89, 0x7d,
+    0x1c, 0xd7, 0x0b, 0xbe, 0x49, 0x91, 0x51, 0x79, 0x89, 0x35, 0xf9, 0x06, 0xf1, 0x4f, 0x09, 0x2e,
+    0xe6, 0x5a, 0x6a, 0x38, 0x2d, 0xb3, 0x23, 0x2e, 0xc1, 0xe2, 0xb8, 0x13, 0xd7, 0x0f, 0x3b, 0x40,
+    0x2b, 0x6b, 0x8f, 0xc2, 0x3d, 0xf6, 0x49, 0xfd, 0x85, 0xde, 0xdf, 0xcd, 0xe2, 0x40, 0x11, 0xba,
+    0x66, 0x6e, 0xf5, 0xd0, 0x4b, 0xe9, 0x61, 0xc5, 0x02, 0x9a, 0x32, 0xc1, 0x35, 0x47, 0x23, 0x0e,
+    0xd9, 0x54, 0xd6, 0x1a, 0x22, 0x47, 0xb0, 0xac, 0x45, 0xd8, 0x66, 0x32, 0x9d, 0x46, 0x5e, 0x5f,
+    0x58, 0x2f, 0x5f, 0x5c, 0x5c, 0x42, 0x2b, 0x9f, 0x96, 0x27, 0x7d, 0x50, 0x0d, 0x4b, 0x85, 0x62,
+    0xed, 0xcb, 0xeb, 0xb9, 0xb4, 0x60, 0x08, 0x86, 0x67, 0xfb, 0xf3, 0x00, 0x96, 0x0a, 0xa2, 0x0f,
+    0xaa, 0x11, 0x79, 0xd7, 0x7d, 0xc1, 0x78, 0xc1, 0xf5, 0x58, 0x54, 0x7d, 0x52, 0xa5, 0x4f, 0xf0,
+    0x41, 0xfc, 0x4c, 0xb5, 0xa8, 0x3d, 0x7d, 0xfa, 0x42, 0x32, 0x5e, 0xaa, 0x97, 0x65, 0x6b, 0x2c,
+    0x15, 0x54, 0x19, 0xd2, 0x8d, 0x47, 0x21, 0x59, 0x75, 0x8c, 0xf5, 0xbb, 0xca, 0xa6, 0xea, 0xad,
+    0xc3, 0x55, 0x45, 0xed, 0x6a, 0xb5, 0xac, 0xa0, 0x8c, 0xb5, 0xea, 0x56, 0x27, 0x72, 0x3a, 0x50,
+    0xaf, 0x2b, 0x19, 0x1b, 0xd2, 0x54, 0x23, 0xee, 0x1d, 0xfe, 0x16, 0xad, 0x44, 0x2c, 0xa3, 0xf0,
+    0x87, 0x56, 0xaa, 0xc5, 0x0c, 0x39, 0x88, 0x6f, 0x1e, 0x8e, 0x50, 0x96, 0x50, 0xc6, 0xfc, 0x70,
+    0x1c, 0x95, 0x94, 0xc1, 0xf0, 0x48, 0xe6, 0xf1, 0x94, 0xa4, 0x2f, 0xf7, 0xf2, 0x65, 0xf1, 0x90,
+    0xca, 0x53, 0x36, 0x9c, 0x0f, 0x22, 0xab, 0xa4, 0x3d, 0xcc, 0xec, 0x71, 0x85, 0x30, 0x3c, 0x02,
+    0x1f, 0x47, 0xf8, 0xa2, 0x73, 0x06, 0xad, 0x53, 0xa3, 0xa1, 0xbb, 0x68, 0x9e, 0x69, 0xaa, 0x6e,
+    0xa9, 0x78, 0x74, 0x90, 0xbe, 0x59, 0xef, 0x6a, 0x22, 0xf6, 0x5a, 0xd9, 0xa9, 0x26, 0xf3, 0x56,
+    0xf9, 0xf2, 0xaa, 0x99, 0xc3, 0xa1, 0xf4, 0xd7, 0x8c, 0xc2, 0x8a, 0x45, 0x7e, 0xf6, 0x84, 0xe9,
+    0x3f, 0x25, 0x70, 0x38, 0xda, 0xf4, 0x44, 0x7b, 0x9b, 0xe5, 0x02, 0x53, 0x55, 0xca, 0xf2, 0x31,
+    0x91, 0xea, 0xc4, 0x72, 0x16, 0x5d, 0xc9, 0xa6, 0x65, 0x5c, 0xbb, 0xd2, 0x7c, 0x2d, 0x0e, 0x84,
+    0xf4, 0x8b, 0x47, 0x71, 0x7d, 0x4e, 0x1d, 0xa6, 0x00, 0xda, 0x52, 0x1a, 0xc5, 0xfb, 0x89, 0x08,
+    0xad, 0x1c, 0x0c, 0x7f, 0x27, 0x0c, 0x74, 0x5e, 0x90, 0xbf, 0x65, 0x6f, 0x0b, 0xc3, 0x32, 0x61,
+    0x23, 0x26, 0xd7, 0x57, 0x16, 0xea, 0x69, 0x35, 0xa9, 0xd8, 0x40, 0x68, 0x69, 0x39, 0x75, 0xb4,
+    0x2a, 0xb5, 0xd8, 0x44, 0xad, 0xba, 0xc7, 0xab, 0x6c, 0xce, 0x88, 0x77, 0xc0, 0xaa, 0x4b, 0xef,
+    0xb3, 0x3b, 0x81, 0xaf, 0x9e, 0x55, 0xf3, 0xfa, 0xba, 0xe3, 0xdd, 0x5c, 0x1a, 0xb2, 0x17, 0x8b,
+    0x78, 0xb7, 0x6b, 0xef, 0xe4, 0x65, 0x82, 0xc1, 0x8f, 0xc5, 0xc2, 0x0d, 0x11, 0x64, 0x4e, 0xc3,
+    0xb7, 0x72, 0x9f, 0xb8, 0xa0, 0x0d, 0xcd, 0xa5, 0x2d, 0x7c, 0xe3, 0x18, 0x4c, 0x9d, 0xac, 0x61,
+    0x76, 0x9c, 0x15, 0x12, 0x47, 0xb1, 0x04, 0x89, 0x55, 0x65, 0xc4, 0xa6, 0xe5, 0xf9, 0x57, 0x9a,
+    0x61, 0x32, 0x28, 0xd6, 0xdb, 0xe8, 0xba, 0xbe, 0x95, 0xf5, 0x99, 0x34, 0x7c, 0xbe, 0x57, 0xb8,
+    0x67, 0x5c, 0xb8, 0x50, 0xbc, 0xfd, 0x95, 0xa5, 0xd2, 0x15, 0x3d, 0xf1, 0xce, 0xdd, 0x95, 0xff,
+    0x6e, 0x77, 0x5d, 0xba, 0xf1, 0x6b, 0x5e, 0xb2, 0x01, 0xa3, 0xd8, 0xd8, 0x74, 0x75, 0x0c, 0xdf,
+    0xc5, 0x05, 0x84, 0xe6, 0x5d, 0x5d, 0x7e, 0x77, 0x44, 0x63, 0xa7, 0x0e, 0xbe, 0x95, 0xa7, 0x6e,
+    0xe5, 0xde, 0x5d, 0x2d, 0x3b, 0x9c, 0x30, 0x35, 0xb0, 0xba, 0xee, 0xb6, 0x7d, 0xef, 0x2d, 0xb6,
+    0xfa, 0xfa, 0x79, 0xec, 0xcb, 0x80, 0xdf, 0x97, 0xc1, 0x2f, 0xa6, 0x8d, 0xc1, 0x06, 0xfb, 0x10,
+    0xb3, 0x9d, 0x95, 0x6f, 0x08, 0xd1, 0x22, 0x6b, 0x6e, 0x3a, 0x7d, 0xf3, 0xd3, 0xaf, 0xeb, 0x2e,
+    0x3a, 0xfd, 0xc1, 0x34, 0x83, 0x4c, 0xdd, 0x40, 0x31, 0x8c, 0xd8, 0x42, 0xef, 0x6d, 0xee, 0x0b,
+    0x12, 0x54, 0xd6, 0x3e, 0x8d, 0x48, 0x5d, 0xa4, 0x7f, 0xcc, 0x17, 0x94, 0xf8, 0x40, 0xd7, 0xb8,
+    0x11, 0xb8, 0xf1, 0x9e, 0x4f, 0x71, 0xf5, 0xf8, 0x96, 0x6e, 0xe3, 0xec, 0xd3, 0x68, 0x01, 0xe6,
+    0x3b, 0x14, 0xc4, 0xc2, 0x99, 0xef, 0x85, 0x54, 0x2a, 0x6e, 0xca, 0xce, 0xa4, 0x63, 0x8b, 0x5e,
+    0xaf, 0x0f, 0xf9, 0xca, 0x37, 0x3f, 0xfb, 0x85, 0x70, 0x8e, 0xfb, 0x07, 0x4e, 0xcb, 0x7c, 0x71,
+    0xe7, 0xf3, 0x2c, 0xd8, 0x54, 0x7a, 0x81, 0xb7, 0xa9, 0x43, 0xef, 0x7c, 0xea, 0x07, 0x5e, 0x53,
+    0xe6, 0x35, 0x95, 0x82, 0xee, 0x80, 0x0f, 0x8d, 0xaf, 0x2f, 0xe8, 0x3b, 0x57, 0xa2, 0xf8, 0x61,
+    0x10, 0xa8, 0x3a, 0xd2, 0x6b, 0x83, 0xf5, 0x9f, 0x59, 0xad, 0x4c, 0x87, 0xa0, 0x53, 0x57, 0x97,
+    0xe0, 0x63, 0xdd, 0x31, 0x3e, 0x79, 0x09, 0x3e, 0x71, 0xd6, 0x23, 0xf3, 0x30, 0xfd, 0x6d, 0x5e,
+    0x89, 0x92, 0x1d, 0x10, 0xa1, 0x89, 0xa4, 0x1b, 0x3f, 0x0f, 0xd3, 0x34, 0xf6, 0x81, 0x49, 0x92,
+    0xce, 0x79, 0x68, 0x0b, 0xad, 0x56, 0x16, 0xc3, 0xf2, 0x64, 0xda, 0x46, 0x98, 0xbe, 0x6d, 0x1e,
+    0x8d, 0xc9, 0x33, 0x30, 0xd3, 0x0a, 0xbc, 0x06, 0x98, 0x9f, 0xbd, 0xa6, 0x01, 0x9f, 0x99, 0x50,
+    0x48, 0x86, 0x06, 0x7b, 0xb9, 0x0b, 0x47, 0x83, 0xdd, 0xc6, 0x2b, 0x66, 0x62, 0x39, 0x95, 0x2a,
+    0xe5, 0xe1, 0x3a, 0xcf, 0x4c, 0xdf, 0x3a, 0xa5, 0x9b, 0x98, 0xca, 0xc4, 0x3d, 0x34, 0x03, 0x84,
+    0xec, 0x34, 0x74, 0x57, 0x5e, 0xb3, 0x60, 0xbc, 0x36, 0x24, 0xca, 0x64, 0x36, 0x08, 0x9d, 0x66,
+    0xe1, 0x70, 0xdb, 0x9d, 0x89, 0x9b, 0x59, 0xad, 0xaa, 0x35, 0x97, 0x1b, 0x39, 0xc7, 0xc8, 0x0d,
+    0xa6, 0x17, 0x2c, 0x28, 0x5e, 0xf5, 0x19, 0x49, 0x08, 0x96, 0xdf, 0xe2, 0x57, 0xa9, 0x66, 0xb7,
+    0x7d, 0xea, 0xae, 0xe9, 0x14, 0x97, 0x6f, 0x06, 0x03, 0xc5, 0x8b, 0x1d, 0x6c, 0xf3, 0x0b, 0x58,
+    0xf0, 0xfa, 0x44, 0x93, 0xcb, 0x35, 0x7d, 0xcb, 0xa2, 0xeb, 0x43, 0xf0, 0x77, 0xad, 0xc2, 0xcc,
+    0x3a, 0x64, 0x26, 0x78, 0x7d, 0xd5, 0xbb, 0x30, 0x86, 0xbe, 0x16, 0xe6, 0xc9, 0x6c, 0x4e, 0xb5,
+    0x1a, 0x8e, 0xf3, 0x11, 0xed, 0x98, 0xf2, 0x57, 0xe4, 0xd3, 0x12, 0xf3, 0x66, 0x93, 0x0a, 0x15,
+    0x2f, 0xe1, 0x35, 0x9c, 0xb1, 0x90, 0x34, 0x93, 0x44, 0x24, 0xa1, 0x1b, 0x1e, 0xea, 0x6b, 0x66,
+    0xa8, 0x10, 0x38, 0x8c, 0xd2, 0x29, 0x4b, 0x25, 0xf7, 0xd1, 0x60, 0xf0, 0x30, 0xa9, 0x95, 0x88,
+    0xe8, 0x8d, 0x7b, 0xad, 0xf3, 0x0e, 0x83, 0x06, 0xbc, 0xe8, 0x70, 0x47, 0x19, 0x58, 0x0c, 0x54,
+    0xf4, 0xc7, 0x53, 0x75, 0x71, 0x4b, 0xf5, 0x63, 0xe1, 0x94, 0x7a, 0xf1, 0x83, 0xea, 0x6b, 0xe9,
+    0x52, 0xaa, 0x3a, 0x4b, 0xd0, 0xd0, 0x4d, 0x70, 0x3c, 0xb5, 0x95, 0x9f, 0x58, 0x47, 0x6f, 0xf4,
+    0x41, 0xf0, 0x2c, 0x99, 0xf4, 0xad, 0x97, 0x01, 0x7e, 0xc5, 0xa9, 0xc0, 0x2f, 0x94, 0x54, 0xd5,
+    0x38, 0x5c, 0x07, 0x22, 0x01, 0x86, 0x08, 0x09, 0x22, 0xa7, 0x4c, 0x57, 0xc7, 0xd2, 0xf5, 0x7e,
+    0xc4, 0xb0, 0xff, 0x97, 0x3f, 0xf4, 0x56, 0xbd, 0x75, 0x9f, 0x7e, 0xdf, 0xdd, 0x87, 0xa8, 0x01,
+    0x02, 0x43, 0x85, 0xb6, 0x45, 0x78, 0x37, 0x8c, 0x40, 0x62, 0x36, 0x53, 0xf3, 0x2c, 0xa4, 0x2d,
+    0xe3, 0x83, 0x6d, 0xbc, 0xa0, 0xec, 0xa6, 0x1d, 0xf1, 0x0a, 0xe8, 0xfb, 0xe0, 0x83, 0xfe, 0xf3,
+    0xe7, 0x9a, 0x04, 0xf3, 0x04, 0x1e, 0x00, 0xa0, 0x17, 0x29, 0x9d, 0xa4, 0xab, 0x2b, 0x76, 0x97,
+    0xd1, 0x0f, 0x50, 0xbd, 0x5e, 0xba, 0xb1, 0x3b, 0x63, 0xe1, 0x52, 0xd3, 0xcc, 0xdd, 0xa5, 0x35,
+    0x75, 0xf8, 0x8b, 0x12, 0x9b, 0x4b, 0x0c, 0x05, 0x34, 0xfb, 0x80, 0xf5, 0xcc, 0x6f, 0xfa, 0xc0,
+    0x6d, 0x7c, 0x9f, 0x2e, 0xef, 0xd2, 0xf7, 0xeb, 0x40, 0x38, 0x5e, 0x60, 0x99, 0x89, 0xe9, 0x5f,
+    0x9a, 0xa0, 0xf1, 0x2e, 0x1d, 0xc1, 0xfd, 0x3c, 0xf7, 0xa4, 0x6d, 0xed, 0xa0, 0x3e, 0xe7, 0xb2,
+    0x77, 0xe7, 0x8b, 0xc8, 0x0f, 0xe9, 0xea, 0x1d, 0x2d, 0x04, 0xcf, 0xf6, 0x8c, 0xd7, 0x16, 0x40,
+    0xff, 0x6b, 0xae, 0xf1, 0xd0, 0x85, 0xfa, 0xfc, 0x6e, 0xa3, 0x56, 0x78, 0xd9, 0x99, 0xc7, 0x74,
+    0x07, 0xe8, 0xb1, 0x1c, 0xbb, 0x8b, 0x20, 0xcd, 0x4e, 0xa4, 0x6f, 0x59, 0x90, 0x51, 0xf7, 0xf1,
+    0xd5, 0x49, 0x23, 0x3f, 0xb0, 0x1d, 0x55, 0x0f, 0xb7, 0x39, 0x1c, 0xbb, 0x70, 0xaf, 0x8c, 0xb3,
+    0x31, 0x0d, 0xa0, 0x72, 0xec, 0x66, 0x9e, 0xcf, 0x50, 0x01, 0xa7, 0x56, 0x83, 0xb3, 0x9a, 0x3d,
+    0xf5, 0xe6, 0x55, 0x0f, 0x4c, 0x51, 0x9e, 0xe2, 0xe5, 0xf8, 0x26, 0x77, 0x80, 0x48, 0x15, 0x12,
+    0x91, 0x5d, 0x28, 0xdf, 0xfe, 0x8a, 0x81, 0x55, 0x04, 0x53, 0x7f, 0xa4, 0x57, 0x5b, 0x2f, 0x10,
+    0x06, 0xcf, 0xd7, 0x85, 0x32, 0x13, 0x2f, 0xf8, 0x47, 0x58, 0x1b, 0xa8, 0x29, 0xf3, 0xd4, 0x4a,
+    0xf2, 0x0d, 0x25, 0xa4, 0xcf, 0xb1, 0x84, 0xa4, 0x49, 0x7e, 0xdf, 0x94, 0xf5, 0xd3, 0xbb, 0xab,
+    0x1f, 0x25, 0x20, 0x73, 0x9b, 0xaa, 0x46, 0x39, 0x07, 0xad, 0x6f, 0x7e, 0xf3, 0x75, 0x1e, 0xb3,
+    0xf3, 0xf5, 0xea, 0x42, 0x7d, 0xa8, 0xae, 0xbc, 0x69, 0xe4, 0x88, 0xd9, 0x54, 0xce, 0xf7, 0x3c,
+    0x3c, 0x07, 0xff, 0xea, 0xcb, 0xdd, 0x8b, 0x47, 0x4f, 0x6f, 0x53, 0x34, 0x2a, 0xd0, 0xb9, 0x29,
+    0x79, 0xd5, 0xeb, 0xfa, 0x87, 0x9f, 0x8b, 0x3c, 0x81, 0xa5, 0x09, 0x5a, 0xd5, 0xb6, 0x97, 0x8b,
+    0xfe, 0xef, 0x64, 0x67, 0xcd, 0x17, 0x11, 0xcb, 0x85, 0xd7, 0xe2, 0x9b, 0x29, 0xdf, 0xae, 0xea,
+    0x9a, 0x25, 0xda, 0xfa, 0x95, 0x16, 0x5e, 0xfb, 0x2d, 0x8f, 0xbe, 0xe9, 0xbd, 0x16, 0x43, 0xbf,
+    0x37, 0x1c, 0xa9, 0x97, 0x44, 0xbe, 0xae, 0x1e, 0x56, 0x58, 0x94, 0xb5, 0x51, 0x4e, 0x6b, 0xef,
+    0x09, 0x6f, 0x0f, 0x40, 0x36, 0x0b, 0x37, 0xe1, 0xfc, 0xb6, 0xe2, 0xad, 0x26, 0xa3, 0x78, 0x53,
+    0x60, 0x5f, 0x37, 0x0f, 0x7c, 0xc3, 0x27, 0x14, 0x37, 0x2a, 0x36, 0x15, 0x8a, 0x3f, 0x36, 0x3d,
+    0xf1, 0x4b, 0x6d, 0x80, 0x60, 0x01, 0x01, 0x2d, 0xb9, 0x28, 0x00, 0x6a, 0x1c, 0x53, 0x14, 0x8e,
+    0xd6, 0xee, 0xe4, 0x17, 0x7c, 0xf2, 0x03, 0x89, 0xca, 0xdb, 0xd5, 0x59, 0x4d, 0xbb, 0x70, 0xf4,
+    0xf0, 0x47, 0x55, 0x37, 0x5a, 0xd0, 0xad, 0xf4, 0x8d, 0x67, 0xec, 0xa6, 0x70, 0xc3, 0x5d, 0x94,
+    0x6d, 0xcb, 0xfb, 0x55, 0x46, 0xbd, 0xe2, 0x76, 0xca, 0x66, 0x04, 0x12, 0xe6, 0x8b, 0x1e, 0x48,
+    0xd5, 0xc5, 0xd2, 0x0d, 0x20, 0x56, 0x88, 0x65, 0x93, 0x69, 0xa4, 0x24, 0xaf, 0x2f, 0x2c, 0xf3,
+    0x65, 0x8e, 0xf7, 0xd5, 0x3d, 0x0a, 0xac, 0xa4, 0x40, 0xd7, 0x43, 0x88, 0x03, 0xaf, 0x21, 0x7f,
+    0xa3, 0x6b, 0xd5, 0xf8, 0x61, 0xe9, 0x86, 0x29, 0xf2, 0x82, 0xe3, 0x6b, 0x65, 0x5b, 0xd5, 0x8b,
+    0x46, 0xb0, 0x71, 0xb0, 0xcd, 0x3e, 0x10, 0xa3, 0xa1, 0xe0, 0x17, 0xa5, 0x00, 0x14, 0xf5, 0xe2,
+    0x8c, 0x6a, 0x44, 0xfe, 0x9e, 0xe3, 0x2b, 0xb1, 0xaa, 0x76, 0xd6, 0xa7, 0xbd, 0xb6, 0xf5, 0x66,
+    0x01, 0x81, 0x33, 0xee, 0x38, 0x57, 0xf7, 0x13, 0xf9, 0x54, 0x17, 0xbf, 0x9a, 0x47, 0x5d, 0x95,
+    0x52, 0x63, 0x0d, 0x18, 0xe6, 0x50, 0xfa, 0x02, 0xbf, 0xfc, 0x5e, 0x55, 0x0d, 0xe0, 0x4b, 0x5e,
+    0xdc, 0xa7, 0x32, 0xb1, 0x15, 0x93, 0x30, 0xca, 0xad, 0x42, 0x55, 0xe3, 0x98, 0x58, 0xd5, 0x6f,
+    0x7e, 0x1f, 0xa1, 0x65, 0x7c, 0x6f, 0x57, 0x86, 0x87, 0x09, 0xc9, 0xbe, 0xa0, 0x8b, 0xcb, 0xd5,
+    0x1d, 0xd0, 0x93, 0xb0, 0xa9, 0x82, 0x9d, 0x38, 0xcb, 0x6e, 0xd0, 0x38, 0x74, 0x7c, 0x2c, 0x04,
+    0x21, 0x71, 0xd2, 0x6b, 0x15, 0x93, 0x1e, 0xf5, 0x5e, 0x0e, 0x1b, 0x39, 0xf5, 0x90, 0x6b, 0xa6,
+    0x6a, 0xb8, 0x8d, 0xad, 0xa3, 0xf7, 0x93, 0x52, 0xc3, 0xd8, 0x99, 0x70, 0x6a, 0xef, 0x11, 0x19,
+    0x86, 0x8f, 0xee, 0xad, 0x17, 0x0c, 0x5e, 0x2e, 0x60, 0x39, 0x55, 0x05, 0x31, 0x53, 0x22, 0x06,
+    0x26, 0xeb, 0x4b, 0x25, 0x24, 0xe7, 0xca, 0xe4, 0xa0, 0x86, 0x23, 0x77, 0xad, 0xfc, 0x85, 0x2d,
+    0x30, 0x93, 0xea, 0x0e, 0x02, 0x52, 0x67, 0xb3, 0xf0, 0x64, 0x06, 0xc9, 0x66, 0xb9, 0x31, 0xb7,
+    0x51, 0x47, 0xdf, 0xc6, 0x96, 0x14, 0x77, 0x44, 0xed, 0x86, 0xb1, 0x19, 0xd9, 0x55, 0xdb, 0xea,
+    0x21, 0xe6, 0x06, 0xd2, 0x9f, 0xa8, 0x13, 0x4c, 0xa6, 0x36, 0x37, 0x06, 0x63, 0x43, 0x69, 0x72,
+    0x6a, 0xf5, 0x79, 0xe7, 0xb7, 0x25, 0xa9, 0x68, 0x44, 0x76, 0xdb, 0xe5, 0xad, 0x2f, 0x67, 0x59,
+    0x83, 0x0a, 0xa4, 0x7a, 0x7b, 0x52, 0x38, 0xdf, 0xad, 0xbd, 0xf8, 0xbc, 0xa5, 0x4a, 0xa0, 0xde,
+    0x4a, 0x7a, 0xc2, 0xaf, 0x5f, 0x18, 0x39, 0x24, 0x87, 0xc2, 0x43, 0x09, 0xdc, 0x22, 0x63, 0x81,
+    0xf6, 0x8a, 0x13, 0xc8, 0x44, 0x25, 0xa3, 0x3c, 0xb8, 0xb5, 0x5b, 0xf0, 0x9c, 0x39, 0x85, 0x42,
+    0x00, 0x9d, 0x5d, 0xe6, 0x07, 0x12, 0x1e, 0x47, 0xa1, 0xc5, 0xe1, 0x3f, 0xba, 0x9e, 0x94, 0x5e,
+    0x75, 0xa0, 0x64, 0x16, 0x37, 0x26, 0xf9, 0x7f, 0x1b, 0xbb, 0x02, 0xe5, 0x17, 0x33, 0x7c, 0x3d,
+    0x65, 0x06, 0xb2, 0x4e, 0xef, 0x75, 0x85, 0x1e, 0x30, 0x97, 0x2f, 0xe4, 0x4c, 0xdd, 0x94, 0xbd,
+    0x2e, 0x15, 0x71, 0xdc, 0xc4, 0x70, 0xf6, 0x5b, 0x9c, 0xbb, 0xab, 0xeb, 0x3e, 0x78, 0xf2, 0xf9,
+    0xd5, 0xb7, 0x3c, 0x57, 0xc9, 0x8b, 0x47, 0x15, 0x47, 0x59, 0xf4, 0x35, 0xb9, 0xd3, 0x54, 0x2b,
+    0xb0, 0xa9, 0xf6, 0x68, 0x14, 0xc2, 0x65, 0x90, 0x67, 0x63, 0xfa, 0xd6, 0x26, 0xdf, 0x8c, 0x2d,
+    0x95, 0xed, 0x15, 0x00, 0xd5, 0x57, 0xa8, 0x51, 0xd3, 0xdb, 0xc3, 0xc2, 0x7a, 0x17, 0x41, 0xbf,
+    0x6b, 0x11, 0x52, 0x7d, 0x55, 0xd3, 0xbc, 0x0d, 0xb2, 0xca, 0x26, 0x16, 0x0e, 0x16, 0x68, 0x38,
+    0xbe, 0x05, 0x62, 0x8b, 0xc3, 0x1e, 0xbd, 0x38, 0x53, 0x5e, 0x01, 0xf3, 0x70, 0xd3, 0x0a, 0xf8,
+    0x6e, 0xc6, 0x29, 0x5b, 0x89, 0x99, 0xff, 0x16, 0x92, 0x5e, 0xe5, 0x48, 0xb1, 0x43, 0xb9, 0x31,
+    0x91, 0x7d, 0x2b, 0x85, 0xb0, 0xf0, 0x0b, 0x41, 0x21, 0xa6, 0xab, 0xb5, 0x5d, 0x42, 0x19, 0x2f,
+    0xac, 0x16, 0x80, 0xc3, 0x38, 0x70, 0xf0, 0xca, 0x3d, 0x3d, 0xbc, 0x8c, 0x23, 0x10, 0x9d, 0x24,
+    0x79, 0xe4, 0xc6, 0xa6, 0x6b, 0xdc, 0xec, 0x78, 0x6a, 0x9c, 0x0e, 0x4f, 0xf1, 0x7c, 0xef, 0xc5,
+    0x5c, 0xa2, 0x83, 0xa5, 0x43, 0x02, 0x51, 0xf7, 0xbe, 0xe1, 0x2c, 0x5a, 0x24, 0x92, 0xbe, 0x11,
+    0x03, 0x00, 0xd1, 0xca, 0x12, 0x20, 0x1b, 0xb9, 0x09, 0xdb, 0xbc, 0x79, 0x06, 0x5d, 0xbe, 0xd0,
+    0x33, 0x80, 0xda, 0xc5, 0x4c, 0xea, 0x39, 0xeb, 0xec, 0x80, 0x56, 0x95, 0xee, 0xe0, 0xcf, 0x73,
+    0x75, 0x41, 0x42, 0xc9, 0x20, 0xd0, 0x9a, 0xdb, 0x75, 0x96, 0x2c, 0x91, 0xd9, 0x4e, 0x3c, 0x91,
+    0x84, 0x47, 0x3a, 0x98, 0xe4, 0x9a, 0x09, 0xf1, 0x57, 0xdb, 0x65, 0x8e, 0x29, 0x14, 0x50, 0x2a,
+    0xeb, 0xf2, 0xdd, 0x5e, 0x1a, 0x6f, 0xeb, 0xa0, 0x46, 0xeb, 0x11, 0x9b, 0x32, 0xe3, 0x3f, 0xcb,
+    0xb6, 0xaf, 0xbe, 0x29, 0x6e, 0x9f, 0xff, 0x83, 0x76, 0xff, 0x0b, 0x60, 0x10, 0xd1, 0x72, 0xe1,
+    0x6e, 0x00, 0x00,
+};
+
+#endif // INDEX_HTML_H
@@ -1,39 +1,220 @@
 // WebServerManager.cpp 
 #include "WebServerManager.h"
 #include <Preferences.h>
+#include <esp_timer.h>
+#include <memory>
 #include "ScheduleManager/ScheduleManager.h"
+#include "IndexHtml.h"
+#include "SettingsStore/SettingsStore.h"
+#include "LEDController/ColorParser.h"
+#include "CommandBatch/CommandBatch.h"
+#include "Telemetry/Telemetry.h"
+#include "NetworkManager/NetworkManager.h"
+#include "TaskScheduler/TaskScheduler.h"
+#include "Timekeeper/Timekeeper.h"
+#include "Trace/Trace.h"
+
+// Server-sent state frames: bursts are coalesced to one frame per interval,
+// and a frame is held back while clients still have this many queued
+#define STATE_PUSH_INTERVAL_MS 100
+#define STATE_PUSH_MAX_QUEUED 4
+// {"color":"<COLOR_TEXT_SIZE>","brightness":100,"mode":"manual"}
+#define STATE_FRAME_SIZE (48 + COLOR_TEXT_SIZE)
+// Whole /metrics page, reserved up front so the scrape never regrows it.
+// A scrape is about 6.3 KiB; one that does not fit answers 500.
+#define METRICS_BUFFER_SIZE 8192
+// Largest /api/batch body accepted
+#define BATCH_BODY_MAX 1024
+
+namespace {
+    // One unlabelled counter or gauge in the Prometheus text format
+    void writeMetric(Print& out, const char* name, const char* type, const char* help, uint32_t value) {
+        out.printf("# HELP %s %s\n# TYPE %s %s\n%s %u\n", name, help, name, type, name, (unsigned)value);
+    }
+
+    // The server turns form posts, and text/plain bodies that start like
+    // one ("brightness=40;..."), into parameters instead of calling the
+    // body handler. Puts the operations back together from them: an "ops"
+    // field (or a bare "body") as is, anything else as name=value, one
+    // field per line. Kept in _tempObject like a body; nullptr if too long.
+    char* batchFromParams(AsyncWebServerRequest* request) {
+        char* text = static_cast<char*>(calloc(BATCH_BODY_MAX + 1, 1));
+        if (!text) return nullptr;
+        request->_tempObject = text;
+        size_t length = 0;
+        for (size_t i = 0; i < request->params(); i++) {
+            AsyncWebParameter* param = request->getParam(i);
+            if (!param->isPost()) continue;
+            const String& name = param->name();
+            bool bare = name == "ops" || name == "body";
+            size_t needed = (bare ? 0 : name.length() + 1) + param->value().length() + 1;
+            if (length + needed > BATCH_BODY_MAX) return nullptr;
+            if (!bare) length += snprintf(text + length, BATCH_BODY_MAX + 1 - length, "%s=", name.c_str());
+            length += snprintf(text + length, BATCH_BODY_MAX + 1 - length, "%s\n", param->value().c_str());
+        }
+        return length ? text : nullptr;
+    }
+}
 
 WebServerManager::WebServerManager(LEDController* led, MQTTManager* mqtt)
-    : _server(80), _ledController(led), _mqttManager(mqtt) {}
+    : _server(80), _events("/events"), _pushedVersion(0), _pushedAutoMode(true), _lastPush(0),
+      _ledController(led), _mqttManager(mqtt) {}
 
 void WebServerManager::setup() {
     setupRootPage();
+    setupStateHandler();
+    setupEventStream();
     setupColorHandler();
   setupBrightnessHandler();
+    setupTransitionHandler();
+    setupWhiteBalanceHandler();
+    setupStripHandler();
     setupScheduleHandler();
+    setupRampHandler();
+    setupTelemetryHandler();
+    setupBatchHandler();
+    setupMetricsHandler();
+    setupTraceHandler();
     setupClearScheduleHandler();
     setupForgetWiFiHandler();
     _server.begin();
 }
 
+void WebServerManager::on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction handler,
+                          ArBodyHandlerFunction body) {
+    _server.on(uri, method, [this, handler](AsyncWebServerRequest* request) {
+        TRACE_SCOPE(HttpRequest);
+        uint32_t start = micros();
+        handler(request);
+        _httpHistogram.observe(micros() - start);
+    }, nullptr, body);
+}
+
 void WebServerManager::setupRootPage() {
-    _server.on("/", HTTP_GET, [this](AsyncWebServerRequest* request) {
+    // Prebuilt, gzipped page served straight from flash; no per-hit heap
+    on("/", HTTP_GET, [](AsyncWebServerRequest* request) {
+        AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+        if (ifNoneMatch && ifNoneMatch->value() == INDEX_HTML_ETAG) {
+            request->send(304);
+            return;
+        }
+        AsyncWebServerResponse* response =
+            request->beginResponse_P(200, "text/html", INDEX_HTML_GZ, INDEX_HTML_GZ_LEN);
+        response->addHeader("Content-Encoding", "gzip");
+        response->addHeader("ETag", INDEX_HTML_ETAG);
+        response->addHeader("Cache-Control", "public, max-age=86400");
+        request->send(response);
+    });
+}
+
+void WebServerManager::setupStateHandler() {
+    on("/api/state", HTTP_GET, [this](AsyncWebServerRequest* request) {
         String greenWindows = ScheduleManager::getGreenWindows();
-  String currentColor = _ledController->getColor();
-  // Inject brightness percent into page via placeholder token appended to greenWindows variable (separate param simpler)
-  String page = generateHtmlPage(greenWindows, currentColor);
-  page.replace("<!--BRIGHTNESS_PLACEHOLDER-->", String(_ledController->getBrightnessPercent()));
-  request->send(200, "text/html", page);
+        uint8_t sunriseMin, sunsetMin;
+        ScheduleManager::getRampMinutes(sunriseMin, sunsetMin);
+        const StripConfig& strip = _ledController->getStripConfig();
+        char color[COLOR_TEXT_SIZE];
+        char balance[COLOR_TEXT_SIZE];
+        CRGB whiteBalance = _ledController->getWhiteBalance();
+        snprintf(balance, sizeof(balance), "#%02X%02X%02X", whiteBalance.r, whiteBalance.g, whiteBalance.b);
+        // Render task share of its core, in hundredths of a percent, over
+        // the time spent in each mode
+        LEDFrameStats frames = _ledController->getFrameStats();
+        uint64_t uptimeUs = (uint64_t)esp_timer_get_time();
+        uint64_t idleSpanUs = uptimeUs > frames.ditherUs ? uptimeUs - frames.ditherUs : 1;
+        uint32_t load = (uint32_t)((frames.busyUs - frames.ditherBusyUs) * 10000 / idleSpanUs);
+        uint32_t ditherLoad = frames.ditherUs ? (uint32_t)(frames.ditherBusyUs * 10000 / frames.ditherUs) : 0;
+        TimeStatus clock = Timekeeper::getStatus();
+        SchedulerStats scheduler = getSchedulerStats();
+        AsyncResponseStream* response = request->beginResponseStream("application/json", 560 + greenWindows.length());
+        response->addHeader("Cache-Control", "no-store");
+        response->printf("{\"color\":\"%s\",\"brightness\":%u,\"mode\":\"%s\",\"whiteBalance\":\"%s\",\"fadeMs\":%u,\"easing\":\"%s\","
+                         "\"ramp\":\"%s\",\"sunriseMin\":%u,\"sunsetMin\":%u,"
+                         "\"strip\":{\"count\":%u,\"type\":\"%s\",\"driver\":\"%s\",\"pins\":[",
+                         formatColor(_ledController->getColor(), color), _ledController->getBrightnessPercent(),
+                         isScheduleAutoMode() ? "auto" : "manual", balance,
+                         _ledController->getTransitionMs(), ledEasingName(_ledController->getTransitionEasing()),
+                         rampKindName(_ledController->getRampKind()), sunriseMin, sunsetMin,
+                         strip.count, ledChipsetName(strip.chipset), ledDriverName(LED_DRIVER));
+        for (uint8_t i = 0; i < strip.outputs; i++) response->printf(i ? ",%u" : "%u", strip.pins[i]);
+        response->printf("]},\"render\":{\"frames\":%u,\"ditherFrames\":%u,\"loadPct\":%u.%02u,\"ditherLoadPct\":%u.%02u},"
+                         "\"scheduler\":{\"wakeups\":%u,\"wakeupsLastHour\":%u,\"transitions\":%u,\"lastLatencyUs\":%u},"
+                         "\"clock\":{\"source\":\"%s\",\"sinceSyncS\":%u,\"driftPpb\":%ld},"
+                         "\"telemetryS\":%u,\"greenWindows\":\"",
+                         frames.frames, frames.ditherFrames, load / 100, load % 100, ditherLoad / 100, ditherLoad % 100,
+                         (unsigned)scheduler.wakeups, (unsigned)scheduler.wakeupsLastHour,
+                         (unsigned)scheduler.transitions, (unsigned)scheduler.lastLatencyUs,
+                         Timekeeper::sourceName(clock.source), (unsigned)clock.sinceSyncS, (long)clock.driftPpb,
+                         Telemetry::getIntervalS());
+        // Windows come from user input, so escape anything JSON cares about
+        for (const char* p = greenWindows.c_str(); *p; p++) {
+            if (*p == '"' || *p == '\\') response->write('\\');
+            if ((uint8_t)*p >= 0x20) response->write(*p);
+        }
+        response->print("\"}");
+        request->send(response);
+    });
+}
+
+size_t WebServerManager::formatState(char* buffer, size_t size) {
+    char color[COLOR_TEXT_SIZE];
+    int len = snprintf(buffer, size, "{\"color\":\"%s\",\"brightness\":%u,\"mode\":\"%s\"}",
+                       formatColor(_ledController->getColor(), color), _ledController->getBrightnessPercent(),
+                       isScheduleAutoMode() ? "auto" : "manual");
+    return len < 0 ? 0 : (size_t)len;
+}
+
+void WebServerManager::setupEventStream() {
+    // New clients get the full state straight away, later frames only
+    // when something changed
+    _events.onConnect([this](AsyncEventSourceClient* client) {
+        char frame[STATE_FRAME_SIZE];
+        formatState(frame, sizeof(frame));
+        client->send(frame, "state", _ledController->getStateVersion());
     });
+    _server.addHandler(&_events);
+}
+
+void WebServerManager::loop() {
+    uint32_t version = _ledController->getStateVersion();
+    bool autoMode = isScheduleAutoMode();
+    if (version == _pushedVersion && autoMode == _pushedAutoMode) return;
+    // Sends and retries share this tick: a burst of changes coalesces
+    // into one frame, and a frame that could not go out is tried again
+    // on the next tick for as long as the change is pending
+    if (millis() - _lastPush < STATE_PUSH_INTERVAL_MS) return;
+    _lastPush = millis();
+    if (_events.count() == 0) {
+        _pushedVersion = version;
+        _pushedAutoMode = autoMode;
+        return;
+    }
+    // Slow clients: keep the change pending instead of growing their queues
+    if (_events.avgPacketsWaiting() >= STATE_PUSH_MAX_QUEUED) return;
+
+    // Frames carry the whole (tiny) state, so the latest one is all a
+    // client needs. try_send() fails when no client could take it; the
+    // change then stays pending as well.
+    char frame[STATE_FRAME_SIZE];
+    formatState(frame, sizeof(frame));
+    if (!_events.try_send(frame, "state", version)) return;
+    _pushedVersion = version;
+    _pushedAutoMode = autoMode;
 }
 
 void WebServerManager::setupColorHandler() {
-    _server.on("/setColor", HTTP_GET, [this](AsyncWebServerRequest* request) {
+    on("/setColor", HTTP_GET, [this](AsyncWebServerRequest* request) {
         if (request->hasParam("color")) {
             String color = request->getParam("color")->value();
-            _ledController->setColor(color);
-            _mqttManager->publishColor(color.c_str());
-            request->send(200, "text/plain", "Color changed to " + color);
+            if (!_ledController->setColor(color)) {
+                request->send(400, "text/plain", "Unknown color: " + color);
+                return;
+            }
+            // Others see the canonical form, whatever syntax was sent
+            char canonical[COLOR_TEXT_SIZE];
+            formatColor(_ledController->getColor(), canonical);
+            _mqttManager->publishColor(canonical);
+            request->send(200, "text/plain", String("Color changed to ") + canonical);
         } else {
             request->send(400, "text/plain", "Missing color parameter");
         }
@@ -41,7 +222,7 @@ void WebServerManager::setupColorHandler() {
 }
 
 void WebServerManager::setupBrightnessHandler() {
-  _server.on("/setBrightness", HTTP_GET, [this](AsyncWebServerRequest* request) {
+  on("/setBrightness", HTTP_GET, [this](AsyncWebServerRequest* request) {
     if (request->hasParam("value")) {
       int val = request->getParam("value")->value().toInt();
       if (val < 0) val = 0; if (val > 100) val = 100;
@@ -53,704 +234,291 @@ void WebServerManager::setupBrightnessHandler() {
   });
 }
 
-void WebServerManager::setupScheduleHandler() {
-    _server.on("/setSchedule", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (request->hasParam("greenWindows")) {
-            ScheduleManager::saveGreenWindows(request->getParam("greenWindows")->value());
-            request->send(200, "text/plain", "Schedule saved!");
-        } else {
-            request->send(400, "text/plain", "Missing green windows parameter");
+void WebServerManager::setupTransitionHandler() {
+    on("/setTransition", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (!request->hasParam("ms")) {
+            request->send(400, "text/plain", "Missing ms parameter");
+            return;
+        }
+        long ms = request->getParam("ms")->value().toInt();
+        if (ms < 0 || ms > LED_FADE_MAX_MS) {
+            request->send(400, "text/plain", "ms must be 0-" + String(LED_FADE_MAX_MS));
+            return;
+        }
+        LedEasing easing = _ledController->getTransitionEasing();
+        if (request->hasParam("easing")) {
+            const String& name = request->getParam("easing")->value();
+            if (!parseLedEasing(name.c_str(), name.length(), easing)) {
+                request->send(400, "text/plain", "easing must be linear, in, out or inout");
+                return;
+            }
         }
+        _ledController->setTransition((uint16_t)ms, easing);
+        request->send(200, "text/plain", "Transition set to " + String(ms) + " ms " + ledEasingName(easing));
     });
 }
 
-
-void WebServerManager::setupClearScheduleHandler() {
-    _server.on("/clearSchedule", HTTP_GET, [](AsyncWebServerRequest* request) {
-        ScheduleManager::clearGreenWindows();
-        request->send(200, "text/plain", "Schedule cleared!");
+void WebServerManager::setupWhiteBalanceHandler() {
+    // Channel gains 0-255; any left out keep their current value
+    on("/setWhiteBalance", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        CRGB balance = _ledController->getWhiteBalance();
+        const char* names[] = { "r", "g", "b" };
+        for (int i = 0; i < 3; i++) {
+            if (!request->hasParam(names[i])) continue;
+            long gain = request->getParam(names[i])->value().toInt();
+            if (gain < 0 || gain > 255) {
+                request->send(400, "text/plain", String(names[i]) + " must be 0-255");
+                return;
+            }
+            balance.raw[i] = (uint8_t)gain;
+        }
+        _ledController->setWhiteBalance(balance);
+        request->send(200, "text/plain", "White balance set to " + String(balance.r) + "," + String(balance.g) + "," +
+                      String(balance.b));
     });
 }
 
-void WebServerManager::setupForgetWiFiHandler() {
-    _server.on("/forgetWiFi", HTTP_GET, [](AsyncWebServerRequest* request) {
-        Preferences pref;
-        pref.begin("wifi", false);
-        pref.clear();
-        pref.end();
-
-        WiFi.disconnect(true, true);
-        request->send(200, "text/plain", "WiFi cleared. Restarting...");
+void WebServerManager::setupStripHandler() {
+    // Strip geometry is fixed at boot: store it and restart into it.
+    // Parameters left out keep their current value. `pins` is a comma
+    // list with one GPIO per output; `pin` is the single-output shorthand.
+    on("/setStrip", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        StripConfig config = _ledController->getStripConfig();
+        if (request->hasParam("count")) {
+            long count = request->getParam("count")->value().toInt();
+            config.count = count < 1 || count > LED_MAX_COUNT ? 0 : (uint16_t)count;
+        }
+        const char* pinsParam = request->hasParam("pins") ? "pins" : request->hasParam("pin") ? "pin" : nullptr;
+        if (pinsParam) {
+            const String& list = request->getParam(pinsParam)->value();
+            // Anything malformed leaves zero outputs, which fails validation
+            config.outputs = 0;
+            const char* p = list.c_str();
+            for (;;) {
+                char* end;
+                long pin = strtol(p, &end, 10);
+                if (end == p || pin < 0 || pin > 255 || config.outputs == LED_MAX_OUTPUTS) {
+                    config.outputs = 0;
+                    break;
+                }
+                config.pins[config.outputs++] = (uint8_t)pin;
+                if (*end != ',') {
+                    if (*end) config.outputs = 0;
+                    break;
+                }
+                p = end + 1;
+            }
+        }
+        if (request->hasParam("type")) {
+            const String& name = request->getParam("type")->value();
+            if (!parseLedChipset(name.c_str(), name.length(), config.chipset)) {
+                request->send(400, "text/plain", "type must be ws2812, ws2811, ws2813 or sk6812");
+                return;
+            }
+        }
+        if (!LEDController::setStripConfig(config)) {
+            request->send(400, "text/plain", "count must be 1-" + String(LED_MAX_COUNT) + " and pins 1-" +
+                          String(LED_MAX_OUTPUTS) + " distinct free output GPIOs");
+            return;
+        }
+        request->send(200, "text/plain", "Strip set to " + String(config.outputs) + " x " + String(config.count) + " " +
+                      ledChipsetName(config.chipset) + ". Restarting...");
+        SettingsStore::flush();
         delay(1000);
         ESP.restart();
     });
 }
 
-String WebServerManager::generateHtmlPage(const String& greenWindows, const String& currentColor) {
-    String html = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-<meta charset="UTF-8" />
-<meta name="viewport" content="width=device-width, initial-scale=1, viewport-fit=cover" />
-<title>OK TO WAKE – Control Panel</title>
-<meta name="theme-color" content="#0ea5a5" />
-<script src="https://cdn.jsdelivr.net/npm/sweetalert2@11"></script>
-<style>
-:root{--bg-0:hsl(250,50%,98%);--bg-1:hsl(230,45%,97%);--card:#fff;--fg:hsl(210,20%,18%);--muted:hsl(220,20%,94%);--muted-fg:hsl(215,15%,50%);--border:hsl(220,16%,88%);--ring:hsl(210,100%,65%);--wake:hsl(120,70%,45%);--wake-weak:hsl(120,50%,85%);--sleep:hsl(0,60%,55%);--sleep-weak:hsl(0,40%,88%);--time:hsl(210,80%,58%);--time-weak:hsl(210,60%,90%);--accent:var(--time);--accent-weak:var(--time-weak);--g-aurora:radial-gradient(60% 60% at 20% 20%,hsl(180,90%,90%) 0%,transparent 60%),radial-gradient(50% 50% at 80% 30%,hsl(260,90%,92%) 0%,transparent 60%),radial-gradient(40% 40% at 60% 80%,hsl(120,90%,90%) 0%,transparent 60%);--g-surface:linear-gradient(145deg,#fff,hsl(220,20%,98%));--g-wake:linear-gradient(135deg,hsl(120,70%,45%),hsl(120,60%,65%));--g-sleep:linear-gradient(135deg,hsl(0,60%,55%),hsl(0,50%,70%));--g-accent:linear-gradient(135deg,var(--accent),hsl(210,100%,70%));--radius-lg:18px;--radius-md:12px;--radius-sm:10px;--shadow-soft:0 8px 24px hsl(215 30% 20% / .08);--shadow-float:0 12px 36px hsl(215 30% 20% / .14);--shadow-glow:0 0 40px hsl(210 100% 80% / .4);--ease:cubic-bezier(.22,1,.36,1);--t-fast:180ms var(--ease);--t-med:280ms var(--ease)}
-*{box-sizing:border-box}html,body{height:100%}body{margin:0;font-family:ui-sans-serif,system-ui,-apple-system,Segoe UI,Roboto,Noto Sans,Ubuntu,Cantarell,Arial,"Apple Color Emoji","Segoe UI Emoji";background:linear-gradient(180deg,var(--bg-0),var(--bg-1)),var(--g-aurora);color:var(--fg);line-height:1.55;-webkit-tap-highlight-color:transparent}
-.aurora{position:fixed;inset:-20vmax;background:var(--g-aurora);filter:blur(40px) saturate(120%);opacity:.5;pointer-events:none;animation:float 20s ease-in-out infinite alternate}
-@keyframes float{0%{transform:translate3d(-2%,-1%,0) scale(1)}100%{transform:translate3d(2%,1%,0) scale(1.02)}}
-@media (prefers-reduced-motion:reduce){.aurora{animation:none}}
-.container{max-width:960px;margin:0 auto;padding:clamp(16px,3.5vw,32px)}
-header{text-align:center;margin-bottom:clamp(16px,6vw,32px);position:relative}
-.brand-icons{display:flex;justify-content:center;gap:12px;margin-bottom:10px;opacity:.9}
-.brand-icons .ico{font-size:clamp(20px,5vw,28px)}
-.title{font-size:clamp(28px,6vw,44px);font-weight:800;letter-spacing:.4px;background:var(--g-accent);-webkit-background-clip:text;background-clip:text;-webkit-text-fill-color:transparent;filter:drop-shadow(0 2px 10px hsl(210 90% 85% / .35));margin:0 0 4px}
-.subtitle{color:var(--muted-fg);font-size:clamp(14px,3.6vw,18px);margin:0 auto 8px}
-.divider{width:88px;height:4px;margin:10px auto 0;background:var(--g-accent);border-radius:999px;box-shadow:var(--shadow-glow);opacity:.9}
-.grid{display:grid;gap:clamp(14px,3.5vw,22px);grid-template-columns:1fr}
-.card{background:var(--g-surface);border:1px solid var(--border);border-radius:var(--radius-lg);box-shadow:var(--shadow-soft);padding:clamp(16px,4vw,24px);backdrop-filter:saturate(120%) blur(8px);position:relative;overflow:clip}
-.card:hover{box-shadow:var(--shadow-float);transform:translateY(-1px);transition:transform var(--t-fast),box-shadow var(--t-med)}
-.card-header{display:flex;align-items:center;justify-content:space-between;gap:12px;margin-bottom:14px;flex-wrap:wrap}
-.card-title{display:flex;align-items:center;gap:10px;font-size:18px;font-weight:700}
-.card-title .ico{font-size:22px}
-.card-desc{color:var(--muted-fg);font-size:14px;margin-top:4px}
-.clock{text-align:center;background:linear-gradient(180deg,var(--card),hsl(0 0% 100% / .6));border:1px solid var(--border);border-radius:var(--radius-md);padding:clamp(14px,4vw,20px);box-shadow:var(--shadow-glow)}
-.clock-time{font-family:ui-monospace,SFMono-Regular,Menlo,Monaco,Consolas,"Liberation Mono","Courier New",monospace;font-size:clamp(28px,10vw,56px);font-weight:800;letter-spacing:.08em;color:var(--time);text-shadow:0 0 18px hsl(210 100% 88% / .35)}
-.clock-date{margin-top:6px;color:var(--muted-fg);font-size:clamp(13px,3.4vw,15px)}
-.status{display:flex;align-items:center;gap:8px;padding:10px 12px;background:hsl(0 0% 100% / .5);border:1px solid var(--border);border-radius:999px}
-.dot{width:10px;height:10px;border-radius:999px;background:var(--muted-fg);box-shadow:0 0 0 3px hsl(0 0% 100% / .6) inset}
-.dot.green{background:var(--wake)}.dot.red{background:var(--sleep)}.dot.blue{background:var(--time)}.dot.off{background:var(--muted-fg)}
-.status-text{font-weight:700;font-size:15px}.status-sub{color:var(--muted-fg);font-size:12px}
-.btns{display:grid;grid-template-columns:repeat(2,minmax(0,1fr));gap:10px}
-@media (min-width:520px){.btns{grid-template-columns:repeat(4,minmax(0,1fr))}}
-.btn{-webkit-user-select:none;user-select:none;display:flex;align-items:center;justify-content:center;gap:8px;padding:12px 14px;border:2px solid transparent;border-radius:12px;font-weight:700;font-size:16px;background:var(--card);color:var(--fg);transition:transform var(--t-fast),box-shadow var(--t-fast),background var(--t-fast),border-color var(--t-fast),opacity var(--t-fast);box-shadow:0 1px 0 hsl(0 0% 100% / .8) inset,0 8px 20px hsl(215 30% 20% / .06);min-height:44px}
-.btn:hover{transform:translateY(-1px)}.btn:active{transform:translateY(0)}.btn:disabled{opacity:.6;transform:none;cursor:not-allowed}
-.btn-wake{background:var(--g-wake);color:#fff;border-color:hsl(120,70%,42%);box-shadow:0 8px 24px hsl(120 70% 40% / .22)}
-.btn-sleep{background:var(--g-sleep);color:#fff;border-color:hsl(0,60%,50%);box-shadow:0 8px 24px hsl(0 70% 45% / .22)}
-.btn-blue {
-  background: linear-gradient(135deg, hsl(210, 80%, 58%), hsl(210, 70%, 65%));
-  color: white;
-  border-color: hsl(210, 80%, 50%);
-  box-shadow: 0 8px 24px hsl(210 80% 40% / 0.22);
-}
-.btn-off{background:var(--muted);color:var(--muted-fg);border-color:var(--border)}
-.btn-outline{background:transparent;border-color:var(--border);color:var(--fg)}
-.btn-outline:hover{background:hsl(0 0% 100% / .6)}
-.btn-danger{background:transparent;color:var(--sleep);border-color:var(--sleep)}
-.btn-danger:hover{background:var(--sleep-weak)}
-.toolbar{display:flex;justify-content:center;margin-top:8px}.toolbar .btn{min-width:200px}
-.spinner{width:18px;height:18px;border:2px solid transparent;border-top-color:currentColor;border-radius:999px;animation:spin 1s linear infinite}
-@keyframes spin{to{transform:rotate(360deg)}}
-.form-grid{display:grid;gap:16px;grid-template-columns:1fr}
-@media (min-width:720px){.form-grid{grid-template-columns:repeat(2,minmax(0,1fr))}}
-.group{display:flex;flex-direction:column;gap:8px}.label{display:flex;align-items:center;gap:8px;font-weight:700;color:var(--wake);font-size:15px}
-.row{display:flex;gap:10px;align-items:center}.row>.flex-1{flex:1}
-.input{width:100%;padding:12px;font-size:16px;border:2px solid var(--border);background:var(--card);border-radius:var(--radius-sm);color:var(--fg);outline:none;transition:border-color var(--t-fast),box-shadow var(--t-fast)}
-.input:focus{border-color:var(--accent);box-shadow:0 0 0 3px hsl(210 100% 60% / .12)}
-.input.wake{border-color:hsl(120 60% 50% / .35);background:hsl(120 50% 94% / .3)}
-.help{color:var(--muted-fg);font-size:12px}
-.actions{display:flex;gap:10px;flex-wrap:wrap}.actions .btn{flex:1;min-width:180px}
-.flash{margin-top:10px;padding:10px 12px;border-radius:12px;font-weight:700;text-align:center;border:1px solid transparent;opacity:0;transform:translateY(4px);transition:all var(--t-med)}
-.flash.show{opacity:1;transform:translateY(0)}
-.flash.success{background:var(--wake-weak);color:var(--wake);border-color:var(--wake)}
-.flash.error{background:var(--sleep-weak);color:var(--sleep);border-color:var(--sleep)}
-.warning{background:hsl(0 60% 55% / .06);border:1px solid hsl(0 60% 55% / .22);border-radius:var(--radius-md);padding:16px;margin-top:10px}
-.warning h3{margin:0 0 6px;color:var(--sleep)}.warning p{margin:0 0 10px;color:var(--muted-fg);font-size:13px}
-footer{text-align:center;color:var(--muted-fg);font-size:13px;padding:20px 0 8px}
-a,button{cursor:pointer}.sr{position:absolute;width:1px;height:1px;padding:0;margin:-1px;overflow:hidden;clip:rect(0,0,0,0);white-space:nowrap;border:0}
-</style>
-</head>
-<body>
-<div class="aurora" aria-hidden="true"></div>
-<div class="container">
-  <header>
-    <div class="brand-icons" aria-hidden="true">
-      <span class="ico">🌙</span><span class="ico">✨</span><span class="ico">🌅</span>
-    </div>
-    <h1 class="title">OK TO WAKE</h1>
-    <p class="subtitle">Smart Wake-Up Clock</p>
-    <div class="divider"></div>
-  </header>
-
-  <main class="grid" role="main">
-    <!-- Clock -->
-    <section class="card" aria-labelledby="clock-title">
-      <div class="card-header">
-        <div>
-          <div class="card-title" id="clock-title"><span class="ico">🕐</span> Current Time</div>
-          <p class="card-desc">Device time reference</p>
-        </div>
-        <div class="status" aria-live="polite">
-          <span class="dot blue" id="statusDot"></span>
-          <span class="status-text" id="currentStatus">Device Off</span>
-        </div>
-      </div>
-      <div class="clock">
-        <div class="clock-time" id="clock">--:--:--</div>
-        <div class="clock-date" id="date">Loading...</div>
-      </div>
-    </section>
-
-  <!-- Light Control -->
-  <section class="card" aria-labelledby="light-title">
-      <div class="card-header">
-        <div>
-          <div class="card-title" id="light-title"><span class="ico">💡</span> Light Control</div>
-          <p class="card-desc">Quick set current light color</p>
-        </div>
-      </div>
-
-      <div class="btns" role="group" aria-label="Light color options">
-        <button class="btn btn-wake" onclick="changeColor('green')" id="btnGreen"><span>🟢</span> Wake Up</button>
-        <button class="btn btn-sleep" onclick="changeColor('red')" id="btnRed"><span>🔴</span> Sleep</button>
-        <button class="btn btn-blue" onclick="changeColor('blue')" id="btnBlue"><span>🔵</span> Blue</button>
-        <button class="btn btn-off" onclick="changeColor('off')" id="btnOff"><span>⚫</span> Turn Off</button>
-      </div>
-
-      <div class="toolbar">
-        <button class="btn btn-outline" id="manualControlBtn" onclick="toggleManualMode()" title="Toggle Manual Control">
-          <span class="ico">⚙️</span> <span id="manualControlText">Enable Manual</span>
-        </button>
-      </div>
-
-      <!-- Brightness (independent of mode) -->
-      <div style="margin-top:18px">
-        <label for="brightnessSlider" class="label" style="color:var(--accent);display:flex;align-items:center;gap:8px"><span class="ico">🔆</span> Brightness: <span id="brightnessValue">--</span>%</label>
-        <div class="brightness-wrapper" style="position:relative;height:46px;display:flex;align-items:center;">
-          <input type="range" id="brightnessSlider" min="0" max="100" value="0" style="width:100%;appearance:none;height:16px;border-radius:999px;background:linear-gradient(90deg,var(--muted) 0%, var(--muted) 100%);outline:none;border:1px solid var(--border);padding:0;margin:0;"
-            aria-label="Brightness" />
-        </div>
-      </div>
-    </section>
-
-    <!-- Schedule -->
-    <section class="card" aria-labelledby="sched-title">
-      <div>
-        <div class="card-title" id="sched-title"><span class="ico">📅</span> Schedule Settings</div>
-        <p class="card-desc">Define Green Windows. Outside of these, light is red.</p>
-      </div>
-
-      <form id="scheduleForm" novalidate>
-        <div class="form-grid" id="greenWindowsContainer"></div>
-
-        <div class="actions" style="margin-top: 4px; margin-bottom: 8px">
-          <button type="button" class="btn btn-outline" id="addWindowBtn">
-            <span class="ico">➕</span> Add Wake Up Window
-          </button>
-        </div>
-
-        <div class="actions">
-          <button type="submit" class="btn btn-wake" id="saveBtn">
-            <span class="ico">💾</span> Save Schedule
-          </button>
-          <button type="button" class="btn btn-danger" onclick="clearSchedule()" id="clearBtn">
-            <span class="ico">🗑️</span> Clear Settings
-          </button>
-        </div>
-        <div class="flash" id="saveStatus" role="status" aria-live="polite"></div>
-      </form>
-    </section>
-
-    <!-- Network -->
-    <section class="card" aria-labelledby="net-title">
-      <div class="card-header">
-        <div>
-          <div class="card-title" id="net-title"><span class="ico">⚙️</span> Network Settings</div>
-          <p class="card-desc">Manage device Wi-Fi connection</p>
-        </div>
-      </div>
-
-      <div class="status">
-        <span class="ico" aria-hidden="true">📶</span>
-        <div>
-          <div class="status-text">Connected to Network</div>
-          <div class="status-sub">Device is operating on current network</div>
-        </div>
-      </div>
-
-      <div class="warning" role="note">
-        <h3>Reset Wi-Fi Settings</h3>
-        <p>This will delete saved network details and return the device to setup mode.</p>
-        <button class="btn btn-danger" onclick="forgetWiFi()" id="wifiBtn">
-          <span class="ico">📶</span> Forget Wi-Fi
-        </button>
-      </div>
-    </section>
-  </main>
-
-  <footer>© 2025 Koren Halevie. All rights reserved.</footer>
-</div>
-
-<script>
-let currentColor = 'off';
-let isLoading = false;
-let greenWindows = [];
-let isManualMode = false;
-let brightness = <!--BRIGHTNESS_PLACEHOLDER-->; // injected from server
-
-const $ = (id) => document.getElementById(id);
-
-document.addEventListener('DOMContentLoaded', () => {
-  updateClock();
-  setInterval(updateClock, 1000);
-
-  // Initialize green windows from the parameter passed from the server
-  const initialWindows = ')rawliteral" + greenWindows + R"rawliteral(';
-  if (
-    initialWindows &&
-    initialWindows !== '' &&
-    initialWindows.trim() !== ''
-  ) {
-    greenWindows = initialWindows.split(',').map((pair) => {
-      const [start, end] = pair.trim().split('-');
-      return { start, end };
+void WebServerManager::setupScheduleHandler() {
+    on("/setSchedule", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (request->hasParam("greenWindows")) {
+            ScheduleManager::saveGreenWindows(request->getParam("greenWindows")->value());
+            request->send(200, "text/plain", "Schedule saved!");
+        } else {
+            request->send(400, "text/plain", "Missing green windows parameter");
+        }
     });
-  } else {
-    greenWindows = [];
-  }
-  renderGreenWindows();
-
-  // Initialize manual mode and Manual Control button
-  isManualMode = false;
-  updateManualControlButton();
-
-  // Check immediately if the color needs to be updated according to the current schedule
-  if (greenWindows.length > 0) {
-    checkAndUpdateColorBySchedule();
-  }
-
-  // Initialize color status from server parameter
-  const initColor = ')rawliteral" + currentColor + R"rawliteral(';
-  updateStatus((initColor && initColor !== '') ? initColor : 'off');
-
-  // Initialize brightness slider
-  setupBrightnessSlider();
-
-  // To ensure the add button works at all times
-  const addBtn = $('addWindowBtn');
-  if (addBtn && !addBtn._bound) {
-    addBtn.addEventListener('click', addGreenWindow);
-    addBtn._bound = true;
-  }
-});
-
-function updateClock(){
-  const now = new Date();
-  const time = now.toLocaleTimeString('en-US',{hour12:false, hour:'2-digit', minute:'2-digit', second:'2-digit'});
-  const date = now.toLocaleDateString('en-US',{weekday:'long', year:'numeric', month:'long', day:'numeric'});
-  $('clock').textContent = time;
-  $('date').textContent = date;
-
-  // === Automatic color calculation by schedule ===
-  try {
-    const minutesNow = now.getHours()*60 + now.getMinutes();
-    let inGreen = false;
-    for (let i=0;i<greenWindows.length;i++){
-      const w = greenWindows[i];
-      if (!w || !w.start || !w.end) continue;
-      const [sh,sm] = (w.start||'00:00').split(':').map(Number);
-      const [eh,em] = (w.end||'00:00').split(':').map(Number);
-      const startMin = (sh*60 + sm);
-      const endMin = (eh*60 + em);
-      if (startMin === endMin) continue; // Empty range
-      if (startMin < endMin) {
-        if (minutesNow >= startMin && minutesNow < endMin) { inGreen = true; break; }
-      } else {
-        if (minutesNow >= startMin || minutesNow < endMin) { inGreen = true; break; }
-      }
-    }
-
-    // Automatic update of the device according to the schedule - only if not in manual mode
-    if (!isManualMode) {
-      const target = inGreen ? 'green' : 'red';
-      if (currentColor !== target) {
-        changeColor(target, true); // true = automatic
-      }
-    }
-  } catch (e) {
-    console.error(e);
-  }
-}
-
-function setAccentBy(color){
-  let accent = getComputedStyle(document.documentElement).getPropertyValue('--time').trim();
-  if(color === 'green') accent = getComputedStyle(document.documentElement).getPropertyValue('--wake').trim();
-  else if(color === 'red') accent = getComputedStyle(document.documentElement).getPropertyValue('--sleep').trim();
-  else if(color === 'blue') accent = getComputedStyle(document.documentElement).getPropertyValue('--time').trim();
-  else accent = 'hsl(215, 15%, 55%)';
-  document.documentElement.style.setProperty('--accent', accent);
-}
-
-function updateStatus(color){
-  const statusTexts = { green:'Time to Wake Up! 🌅', red:'Sleep Time 😴', blue:'Blue Light 💙', off:'Device Off' };
-  const dot = $('statusDot');
-  dot.className = 'dot ' + (color || 'off');
-  $('currentStatus').textContent = statusTexts[color] || 'Unknown';
-  currentColor = color || 'off';
-  setAccentBy(color);
-  updateBrightnessGradient();
-}
-
-function setButtonLoading(buttonId, loading){
-  const btn = $(buttonId);
-  if(!btn) return;
-  if(loading){
-    btn.disabled = true;
-    btn.innerHTML = '<span class="spinner"></span> Working...';
-  } else {
-    btn.disabled = false;
-    const original = {
-      btnGreen:'<span>🟢</span> Wake Up',
-      btnRed:'<span>🔴</span> Sleep',
-      btnBlue:'<span>🔵</span> Blue',
-      btnOff:'<span>⚫</span> Turn Off'
-    };
-    btn.innerHTML = original[buttonId] || btn.innerHTML;
-  }
-}
-
-// ------- Brightness Control -------
-function setupBrightnessSlider(){
-  const slider = $('brightnessSlider');
-  const valueEl = $('brightnessValue');
-  if(!slider || !valueEl) return;
-  if (isNaN(brightness)) brightness = 100;
-  slider.value = brightness;
-  valueEl.textContent = brightness;
-  updateBrightnessGradient();
-  slider.addEventListener('input', ()=>{
-    const val = Number(slider.value);
-    valueEl.textContent = val;
-    brightness = val;
-    updateBrightnessGradient();
-    // send continuously (debounced)
-    scheduleBrightnessSend(val);
-  });
-}
-
-function updateBrightnessGradient(){
-  const slider = $('brightnessSlider');
-  if(!slider) return;
-  // Choose color based on currentColor and a soft starting tint
-  let c = '#777777', start = 'rgba(120,120,120,0.05)';
-  if(currentColor === 'green'){ c = 'hsl(120,70%,45%)'; start = 'rgba(0,255,0,0.12)'; }
-  else if(currentColor === 'red'){ c = 'hsl(0,60%,55%)'; start = 'rgba(255,0,0,0.10)'; }
-  else if(currentColor === 'blue'){ c = 'hsl(210,80%,58%)'; start = 'rgba(30,144,255,0.12)'; }
-  const pct = brightness || 0;
-  slider.style.background = `linear-gradient(90deg, ${start} 0%, ${c} ${pct}%, var(--muted) ${pct}%, var(--muted) 100%)`;
-  slider.style.opacity = (pct === 0 ? 0.45 : 1);
-}
-
-let brightnessTimeout;
-function scheduleBrightnessSend(val){
-  if (brightnessTimeout) clearTimeout(brightnessTimeout);
-  brightnessTimeout = setTimeout(()=> sendBrightness(val), 90); // faster debounce
-}
-
-async function sendBrightness(val){
-  try {
-    const res = await fetch('/setBrightness?value=' + encodeURIComponent(val));
-    if(res.ok){
-      // no toast spam; show only occasionally
-      if (val === 0 || val === 100 || (val % 10 === 0)) {
-        showToast('Brightness ' + val + '%','success');
-      }
-    }
-  } catch(e){
-    console.error('Brightness error', e);
-  }
 }
 
-async function changeColor(color, isAutomatic = false){
-  if(isLoading && !isAutomatic) return;
-  isLoading = true;
-  const map = { green:'btnGreen', red:'btnRed', blue:'btnBlue', off:'btnOff' };
-  const id = map[color];
-  if(id && !isAutomatic) setButtonLoading(id, true);
-
-  // If manual button is pressed, switch to manual mode
-  if (!isAutomatic) {
-    isManualMode = true;
-    updateManualControlButton();
-  }
-  
-  try{
-    const res = await fetch('/setColor?color=' + encodeURIComponent(color));
-    if(res.ok){
-      updateStatus(color);
-      if (!isAutomatic) {
-        showToast('Color changed successfully! Manual mode enabled ✨','success');
-      }
-    } else throw new Error('Request failed');
-  } catch(err){
-    console.error('Color change error:', err);
-    if (!isAutomatic) {
-      showToast('Failed to change color. Try again.','error');
-    }
-  } finally {
-    if(id && !isAutomatic) setButtonLoading(id, false);
-    isLoading = false;
-  }
-}
-
-function toggleManualMode(){
-  isManualMode = !isManualMode;
-  updateManualControlButton();
-  
-  if (isManualMode) {
-    showToast('Manual mode enabled. Colors won\'t change automatically.','info');
-  } else {
-    showToast('Auto mode enabled. Colors will follow schedule.','success');
-    // Immediately update according to the current schedule
-    checkAndUpdateColorBySchedule();
-  }
-}
-
-function updateManualControlButton(){
-  const btn = $('manualControlBtn');
-  const text = $('manualControlText');
-  if (!btn || !text) return;
-  
-  if (isManualMode) {
-    btn.classList.remove('btn-outline');
-    btn.classList.add('btn-wake');
-    text.textContent = 'Auto Mode';
-    btn.title = 'Switch back to automatic mode';
-  } else {
-    btn.classList.remove('btn-wake');
-    btn.classList.add('btn-outline');
-    text.textContent = 'Manual Mode';
-    btn.title = 'Enable manual control';
-  }
-}
-
-// ------- Schedule UI -------
-function renderGreenWindows(){
-  const container = $('greenWindowsContainer');
-  container.innerHTML = '';
-  greenWindows.forEach((w, i) => {
-    const el = document.createElement('div');
-    el.className = 'group';
-    el.innerHTML = `
-      <label class="label"><span class="ico">🌅</span> Wake Up Window #${i+1}</label>
-      <div class="row">
-        <div class="flex-1"><input type="time" class="input wake" value="${w.start}" data-idx="${i}" data-field="start" required></div>
-        <span aria-hidden="true">—</span>
-        <div class="flex-1"><input type="time" class="input wake" value="${w.end}" data-idx="${i}" data-field="end" required></div>
-        <button type="button" class="btn btn-danger" data-remove="${i}" title="Delete window">🗑️</button>
-      </div>
-      <div class="help">You can span midnight (e.g., 22:00 → 06:30).</div>
-    `;
-    container.appendChild(el);
-  });
-
-  container.querySelectorAll('input[type="time"]').forEach(inp=>{
-    inp.addEventListener('change', (e)=>{
-      const idx = Number(e.target.getAttribute('data-idx'));
-      const field = e.target.getAttribute('data-field');
-      greenWindows[idx][field] = e.target.value;
-
-      // Auto-save when changing time
-      saveScheduleAutomatically();
-    });
-  });
-
-  container.querySelectorAll('button[data-remove]').forEach(btn=>{
-    btn.addEventListener('click',(e)=>{
-      const idx = Number(e.currentTarget.getAttribute('data-remove'));
-      greenWindows.splice(idx,1);
-      renderGreenWindows();
+void WebServerManager::setupRampHandler() {
+    // Either parameter may be left out to keep its current value
+    on("/setRamp", HTTP_GET, [](AsyncWebServerRequest* request) {
+        uint8_t sunrise, sunset;
+        ScheduleManager::getRampMinutes(sunrise, sunset);
+        const char* names[] = { "sunrise", "sunset" };
+        uint8_t* values[] = { &sunrise, &sunset };
+        for (int i = 0; i < 2; i++) {
+            if (!request->hasParam(names[i])) continue;
+            long minutes = request->getParam(names[i])->value().toInt();
+            if (minutes < 0 || minutes > 255 || !ScheduleManager::isValidRampMinutes((uint8_t)minutes)) {
+                request->send(400, "text/plain", String(names[i]) + " must be 0 (off) or " +
+                              String(ScheduleManager::RAMP_MIN_MINUTES) + "-" + String(ScheduleManager::RAMP_MAX_MINUTES));
+                return;
+            }
+            *values[i] = (uint8_t)minutes;
+        }
+        ScheduleManager::saveRampMinutes(sunrise, sunset);
+        request->send(200, "text/plain", "Ramps set to sunrise " + String(sunrise) + " min, sunset " + String(sunset) + " min");
     });
-  });
-}
-
-function addGreenWindow(){
-  greenWindows.push({start:'', end:''});
-  renderGreenWindows();
-}
-
-function validateGreenWindows(allowEmpty = false){
-  for(const w of greenWindows){
-    // If empty values are allowed and both fields are empty, it's okay
-    if(allowEmpty && (!w.start || w.start === '') && (!w.end || w.end === '')) continue;
-    
-    if(!w.start || !w.end) return { ok:false, msg:'Please fill start and end for each window.' };
-    if(!/^\d{2}:\d{2}$/.test(w.start) || !/^\d{2}:\d{2}$/.test(w.end)) return { ok:false, msg:'Invalid time format. Use HH:MM.' };
-  }
-  return {ok:true};
-}
-
-function windowsToQueryParam(){
-  return greenWindows
-    .filter(w => w.start && w.end && w.start !== '' && w.end !== '') // Only valid windows
-    .map(w => `${w.start}-${w.end}`)
-    .join(',');
 }
 
-$('scheduleForm').addEventListener('submit', async (e)=>{
-  e.preventDefault();
-  if(isLoading) return;
-  isLoading = true;
-  const saveBtn = $('saveBtn');
-  saveBtn.innerHTML = '<span class="spinner"></span> Saving...';
-  saveBtn.disabled = true;
-
-  const valid = validateGreenWindows();
-  if(!valid.ok){
-    showFlash(valid.msg,'error');
-    saveBtn.innerHTML = '<span class="ico">💾</span> Save Schedule';
-    saveBtn.disabled = false;
-    isLoading = false;
-    return;
-  }
-
-  try{
-    const qs = encodeURIComponent(windowsToQueryParam());
-    const res = await fetch(`/setSchedule?greenWindows=${qs}`);
-    if(res.ok){
-      showFlash('✔ Schedule saved successfully!','success');
-      showToast('Schedule updated! 📅','success');
-      // Check immediately if the current color needs to be changed
-      checkAndUpdateColorBySchedule();
-    } else throw new Error('Failed');
-  } catch(err){
-    console.error('Schedule save error:', err);
-    showFlash('❌ Failed to save schedule','error');
-  } finally {
-    saveBtn.innerHTML = '<span class="ico">💾</span> Save Schedule';
-    saveBtn.disabled = false;
-    isLoading = false;
-  }
-});
-
-async function clearSchedule(){
-  if(isLoading) return;
-  isLoading = true;
-  const btn = $('clearBtn');
-  btn.innerHTML = '<span class="spinner"></span> Clearing...';
-  btn.disabled = true;
-  try{
-    const res = await fetch('/clearSchedule');
-    if(res.ok){
-      greenWindows = [];
-      renderGreenWindows();
-      showFlash('✔ Schedule cleared successfully!','success');
-      showToast('Schedule cleared! 🗑️','success');
-      // When clearing the schedule, the light should turn red
-      if (currentColor !== 'red') {
-        changeColor('red', true);
-      }
-    } else throw new Error('Failed');
-  } catch(err){
-    console.error('Schedule clear error:', err);
-    showFlash('❌ Failed to clear schedule','error');
-  } finally {
-    btn.innerHTML = '<span class="ico">🗑️</span> Clear Settings';
-    btn.disabled = false;
-    isLoading = false;
-  }
+void WebServerManager::setupTelemetryHandler() {
+    on("/setTelemetry", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (!request->hasParam("interval")) {
+            request->send(400, "text/plain", "Missing interval parameter");
+            return;
+        }
+        long seconds = request->getParam("interval")->value().toInt();
+        if (seconds < 0 || seconds > TELEMETRY_MAX_INTERVAL_S || !Telemetry::setIntervalS((uint16_t)seconds)) {
+            request->send(400, "text/plain", "interval must be 0 (off) or " + String(TELEMETRY_MIN_INTERVAL_S) + "-" +
+                          String(TELEMETRY_MAX_INTERVAL_S) + " seconds");
+            return;
+        }
+        request->send(200, "text/plain", "Telemetry every " + String(seconds) + " s");
+    });
 }
 
-function forgetWiFi(){
-  Swal.fire({
-    title: 'Forget Wi-Fi?',
-    text: 'Are you sure you want to remove saved Wi-Fi credentials?',
-    icon: 'warning',
-    showCancelButton: true,
-    confirmButtonColor: 'hsl(0, 60%, 55%)',
-    cancelButtonColor: 'hsl(210, 15%, 55%)',
-    confirmButtonText: 'Yes, forget it',
-    cancelButtonText: 'Cancel',
-    background: 'var(--card)',
-    color: 'var(--fg)'
-  }).then(async (r)=>{
-    if(r.isConfirmed){
-      const wifiBtn = $('wifiBtn');
-      wifiBtn.innerHTML = '<span class="spinner"></span> Resetting...';
-      wifiBtn.disabled = true;
-      try{
-        await fetch('/forgetWiFi');
-        Swal.fire({ title:'✅ Wi-Fi Cleared!', text:'Device is restarting...', icon:'success', showConfirmButton:false, background:'var(--card)', color:'var(--fg)' });
-      } catch(e){
-        Swal.fire({ title:'Error', text:'Failed to forget Wi-Fi.', icon:'error', background:'var(--card)', color:'var(--fg)' });
-      } finally {
-        wifiBtn.innerHTML = '<span class="ico">📶</span> Forget Wi-Fi';
-        wifiBtn.disabled = false;
-      }
-    }
-  });
+void WebServerManager::setupBatchHandler() {
+    // Body: operations as in CommandBatch.h, one per line or separated by
+    // ';', e.g. "#FF8800;brightness:40;schedule:07:30-08:00". Either
+    // all of them are applied, with one render and one state publish, or
+    // none.
+    on("/api/batch", HTTP_POST, [this](AsyncWebServerRequest* request) {
+        const char* body = static_cast<const char*>(request->_tempObject);
+        if (!body) body = batchFromParams(request);
+        if (!body) {
+            request->send(400, "text/plain", "Missing body (at most " + String(BATCH_BODY_MAX) + " bytes)");
+            return;
+        }
+        CommandBatch batch;
+        uint8_t failed;
+        if (!parseCommandBatch(body, strlen(body), batch, failed)) {
+            request->send(400, "text/plain", failed ? "Invalid operation " + String(failed) : String("No operations"));
+            return;
+        }
+        uint8_t superseded = applyCommandBatch(batch, *_ledController);
+        String reply = "Applied " + String(batch.operations) + " operations";
+        if (superseded) reply += ", color in operation " + String(superseded) + " superseded by the schedule";
+        request->send(200, "text/plain", reply);
+    }, [](AsyncWebServerRequest* request, uint8_t* data, size_t length, size_t index, size_t total) {
+        // The body may arrive in pieces; the server frees _tempObject
+        if (total > BATCH_BODY_MAX) return;
+        if (index == 0) request->_tempObject = calloc(total + 1, 1);
+        if (request->_tempObject) memcpy(static_cast<char*>(request->_tempObject) + index, data, length);
+    });
 }
 
-async function saveScheduleAutomatically(){
-  // Ensure fields are valid before saving (allows empty fields)
-  const valid = validateGreenWindows(true);
-  if(!valid.ok) return; // Don't save if there are errors
-
-  try{
-    const qs = encodeURIComponent(windowsToQueryParam());
-    const res = await fetch(`/setSchedule?greenWindows=${qs}`);
-    if(res.ok){
-      // Check immediately if the current color needs to be changed
-      checkAndUpdateColorBySchedule();
-      // Small message indicating that the save was successful
-      showToast('Schedule auto-saved ✓','success');
-    }
-  } catch(err){
-    console.error('Auto-save error:', err);
-  }
+void WebServerManager::setupMetricsHandler() {
+    on("/metrics", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        AsyncResponseStream* response = request->beginResponseStream("text/plain; version=0.0.4", METRICS_BUFFER_SIZE);
+        response->addHeader("Cache-Control", "no-store");
+        Telemetry::getLoopHistogram().writePrometheus(*response, "otwu_loop_duration_seconds",
+                                                      "Time spent in one loop() pass");
+        _ledController->getShowHistogram().writePrometheus(*response, "otwu_led_show_duration_seconds",
+                                                           "Time spent in FastLED.show()");
+        _httpHistogram.writePrometheus(*response, "otwu_http_handler_duration_seconds",
+                                       "Time spent in an HTTP handler, excluding sending the response");
+        _mqttManager->getCallbackHistogram().writePrometheus(*response, "otwu_mqtt_callback_duration_seconds",
+                                                             "Time spent handling one MQTT message");
+
+        writeMetric(*response, "otwu_uptime_seconds", "counter", "Time since boot",
+                    (uint32_t)(esp_timer_get_time() / 1000000));
+        writeMetric(*response, "otwu_heap_free_bytes", "gauge", "Free heap", ESP.getFreeHeap());
+        writeMetric(*response, "otwu_heap_min_free_bytes", "gauge", "Lowest free heap since boot", ESP.getMinFreeHeap());
+        writeMetric(*response, "otwu_heap_largest_free_block_bytes", "gauge", "Largest single allocation possible",
+                    ESP.getMaxAllocHeap());
+        // This handler runs on the async TCP task, so a null handle is that task
+        response->print("# HELP otwu_task_stack_free_bytes Least free stack seen per task\n"
+                        "# TYPE otwu_task_stack_free_bytes gauge\n");
+        response->printf("otwu_task_stack_free_bytes{task=\"loop\"} %u\n", (unsigned)Telemetry::getLoopStackFree());
+        response->printf("otwu_task_stack_free_bytes{task=\"led\"} %u\n", (unsigned)_ledController->getTaskStackFree());
+        response->printf("otwu_task_stack_free_bytes{task=\"async_tcp\"} %u\n",
+                         (unsigned)uxTaskGetStackHighWaterMark(nullptr));
+
+        LEDFrameStats frames = _ledController->getFrameStats();
+        MQTTStats mqtt = _mqttManager->getStats();
+        writeMetric(*response, "otwu_led_frames_total", "counter", "Frames sent to the strip", frames.frames);
+        writeMetric(*response, "otwu_led_dropped_commands_total", "counter", "LED commands dropped on a full queue",
+                    frames.droppedCommands);
+        SchedulerStats scheduler = getSchedulerStats();
+        writeMetric(*response, "otwu_scheduler_wakeups_total", "counter", "Times the schedule was evaluated",
+                    scheduler.wakeups);
+        writeMetric(*response, "otwu_scheduler_transitions_total", "counter", "Color changes applied by the schedule",
+                    scheduler.transitions);
+        writeMetric(*response, "otwu_nvs_commits_total", "counter", "NVS writes performed",
+                    SettingsStore::getCommitCount());
+        writeMetric(*response, "otwu_wifi_reconnects_total", "counter", "WiFi links restored after a drop",
+                    NetworkManager::getWiFiReconnects());
+        response->printf("# HELP otwu_wifi_rssi_dbm WiFi signal strength\n# TYPE otwu_wifi_rssi_dbm gauge\n"
+                         "otwu_wifi_rssi_dbm %d\n", WiFi.status() == WL_CONNECTED ? (int)WiFi.RSSI() : 0);
+        writeMetric(*response, "otwu_mqtt_reconnects_total", "counter", "MQTT sessions restored after a drop",
+                    mqtt.reconnects);
+        writeMetric(*response, "otwu_mqtt_connect_failures_total", "counter", "MQTT connect attempts that failed",
+                    mqtt.failures);
+        writeMetric(*response, "otwu_mqtt_commands_total", "counter", "MQTT commands applied", mqtt.commands);
+        TimeStatus clock = Timekeeper::getStatus();
+        writeMetric(*response, "otwu_ntp_syncs_total", "counter", "NTP syncs since boot", clock.syncs);
+        writeMetric(*response, "otwu_clock_since_sync_seconds", "gauge", "Time since the last NTP sync",
+                    clock.sinceSyncS);
+        response->printf("# HELP otwu_clock_drift_ppb Measured RTC rate error, positive when fast\n"
+                         "# TYPE otwu_clock_drift_ppb gauge\notwu_clock_drift_ppb %ld\n", (long)clock.driftPpb);
+        // Phases not reached yet are left out
+        response->print("# HELP otwu_boot_phase_seconds Time from power-on to each boot milestone\n"
+                        "# TYPE otwu_boot_phase_seconds gauge\n");
+        for (uint8_t i = 0; i < (uint8_t)BootPhase::Count; i++) {
+            int32_t ms = Telemetry::getBootMs((BootPhase)i);
+            if (ms < 0) continue;
+            response->printf("otwu_boot_phase_seconds{phase=\"%s\"} %u.%03u\n", Telemetry::bootPhaseName((BootPhase)i),
+                             (unsigned)(ms / 1000), (unsigned)(ms % 1000));
+        }
+        // The stream regrows its buffer rather than failing, which would
+        // hide a page that has outgrown the reservation: fail the scrape
+        size_t length = response->available();
+        if (length > METRICS_BUFFER_SIZE) {
+            Serial.printf("❌ /metrics: %u bytes overflow METRICS_BUFFER_SIZE (%u)\n", (unsigned)length,
+                          (unsigned)METRICS_BUFFER_SIZE);
+            delete response;
+            request->send(500, "text/plain", "Metrics exceed METRICS_BUFFER_SIZE");
+            return;
+        }
+        request->send(response);
+    });
 }
 
-function checkAndUpdateColorBySchedule(){
-  // only if not in manual state
-  if (isManualMode) return;
-  
-  const now = new Date();
-  const minutesNow = now.getHours()*60 + now.getMinutes();
-  let inGreen = false;
-  
-  for (let i=0;i<greenWindows.length;i++){
-    const w = greenWindows[i];
-    if (!w || !w.start || !w.end) continue;
-    const [sh,sm] = (w.start||'00:00').split(':').map(Number);
-    const [eh,em] = (w.end||'00:00').split(':').map(Number);
-    const startMin = (sh*60 + sm);
-    const endMin = (eh*60 + em);
-    if (startMin === endMin) continue;
-    if (startMin < endMin) {
-      if (minutesNow >= startMin && minutesNow < endMin) { inGreen = true; break; }
-    } else {
-      if (minutesNow >= startMin || minutesNow < endMin) { inGreen = true; break; }
-    }
-  }
-  
-  const targetColor = inGreen ? 'green' : 'red';
-  if (currentColor !== targetColor) {
-    changeColor(targetColor, true);
-  }
+void WebServerManager::setupTraceHandler() {
+#if OTWU_TRACE
+    // Streamed straight from a snapshot of the rings, one TCP segment at a
+    // time; the snapshot lives until the last segment is sent
+    on("/trace", HTTP_GET, [](AsyncWebServerRequest* request) {
+        std::shared_ptr<TraceJsonWriter> writer = std::make_shared<TraceJsonWriter>();
+        AsyncWebServerResponse* response = request->beginChunkedResponse(
+            "application/json", [writer](uint8_t* buffer, size_t maxLen, size_t) -> size_t {
+                return writer->fill(reinterpret_cast<char*>(buffer), maxLen);
+            });
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+#endif
 }
 
-function showFlash(message, type){
-  const el = $('saveStatus');
-  el.textContent = message;
-  el.className = 'flash '+type+' show';
-  setTimeout(()=>{ el.classList.remove('show'); }, 4200);
+void WebServerManager::setupClearScheduleHandler() {
+    on("/clearSchedule", HTTP_GET, [](AsyncWebServerRequest* request) {
+        ScheduleManager::clearGreenWindows();
+        request->send(200, "text/plain", "Schedule cleared!");
+    });
 }
 
-function showToast(message, type){
-  const toast = Swal.mixin({
-    toast: true, position: 'top-end', showConfirmButton: false, timer: 3000, timerProgressBar: true,
-    background: 'var(--card)', color: 'var(--fg)',
-    didOpen: t => { t.addEventListener('mouseenter', Swal.stopTimer); t.addEventListener('mouseleave', Swal.resumeTimer); }
-  });
-  const iconMap = { success: 'success', error: 'error', info: 'info' };
-  toast.fire({ icon: iconMap[type] || 'info', title: message });
-}
-</script>
-</body>
-</html>
-    )rawliteral";
+void WebServerManager::setupForgetWiFiHandler() {
+    on("/forgetWiFi", HTTP_GET, [](AsyncWebServerRequest* request) {
+        Preferences pref;
+        pref.begin("wifi", false);
+        pref.clear();
+        pref.end();
 
-    return html;
+        WiFi.disconnect(true, true);
+        request->send(200, "text/plain", "WiFi cleared. Restarting...");
+        SettingsStore::flush();
+        delay(1000);
+        ESP.restart();
+    });
 }
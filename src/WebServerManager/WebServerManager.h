@@ -5,24 +5,44 @@
 #include <ESPAsyncWebServer.h>
 #include "LEDController/LEDController.h"
 #include "MQTTManager/MQTTManager.h"
+#include "Telemetry/LatencyHistogram.h"
 
 class WebServerManager {
 private:
     AsyncWebServer _server;
+    AsyncEventSource _events;
+    uint32_t _pushedVersion;
+    bool _pushedAutoMode;
+    unsigned long _lastPush;
     LEDController* _ledController;
     MQTTManager* _mqttManager;
+    LatencyHistogram _httpHistogram;
 
+    // _server.on() with the handler's run time recorded in _httpHistogram
+    void on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction handler,
+            ArBodyHandlerFunction body = nullptr);
     void setupRootPage();
+    void setupStateHandler();
+    void setupEventStream();
+    size_t formatState(char* buffer, size_t size);
     void setupColorHandler();
     void setupBrightnessHandler();
+    void setupTransitionHandler();
+    void setupWhiteBalanceHandler();
+    void setupStripHandler();
     void setupScheduleHandler();
+    void setupRampHandler();
+    void setupTelemetryHandler();
+    void setupBatchHandler();
+    void setupMetricsHandler();
+    void setupTraceHandler();   // only with OTWU_TRACE
     void setupClearScheduleHandler();
     void setupForgetWiFiHandler();
-    String generateHtmlPage(const String& greenWindows, const String& currentColor);
 
 public:
     WebServerManager(LEDController* led, MQTTManager* mqtt);
     void setup();
+    void loop();
 };
 
 #endif // WEBSERVERMANAGER_H
@@ -12,6 +12,24 @@
 
 // WiFi Configuration
 #define WIFI_SSID "OTWU"
+// 1 = a fast reconnect also reuses the last DHCP address instead of asking
+// again. Saves the DHCP round trip; only safe where the router keeps
+// leases for known devices.
+#define WIFI_CACHE_IP 0
+
+// GPIOs wired to a strip connector. Every pin is one FastLED controller
+// per chipset in flash, so list only the ones the board brings out (any
+// output-capable GPIO that is not a boot strap or flash pin).
+#define LED_STRIP_PINS 23, 22, 21, 19
+
+// Time: POSIX TZ string (UTC+3, no DST) and NTP servers
+#define TIME_ZONE "<+03>-3"
+#define NTP_SERVER_1 "pool.ntp.org"
+#define NTP_SERVER_2 "time.nist.gov"
+// 1 = after a power loss, start the clock from the last time saved to
+// flash (hourly) instead of waiting for NTP. It is behind by however long
+// the power was off, so the schedule may run late until the next sync.
+#define TIME_RESTORE_FROM_FLASH 1
 
 // Static IP Configuration
 const IPAddress LOCAL_IP(4, 3, 2, 1);
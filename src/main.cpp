@@ -2,7 +2,11 @@
 #include "config.h"
 #include "globals.h"
 #include "TaskScheduler/TaskScheduler.h"
+#include "ScheduleManager/ScheduleManager.h"
+#include "SettingsStore/SettingsStore.h"
 #include "NetworkManager/NetworkManager.h"
+#include "Telemetry/Telemetry.h"
+#include "Timekeeper/Timekeeper.h"
 
 LEDController ledController;
 MQTTManager mqttManager(MQTT_BROKER, MQTT_PORT, MQTT_TOPIC, &ledController);
@@ -11,11 +15,20 @@ CaptivePortalManager captivePortal(WIFI_SSID, LOCAL_IP, GATEWAY_IP, REDIRECT_URL
 
 void setup() {
     Serial.begin(115200);
+    Telemetry::setLoopTask(xTaskGetCurrentTaskHandle());
+    // Light first, from the stored state; nothing below waits for the network
+    ledController.setup();
+    Timekeeper::begin();
+    ScheduleManager::begin();
+    setupScheduledLighting();
     NetworkManager::setupWiFiAndServices();
 }
 
 void loop() {
-    handleScheduledLighting();
+    uint32_t start = micros();
+    Timekeeper::loop();
     NetworkManager::handleWiFiTasks();
+    SettingsStore::loop();
+    Telemetry::recordLoop(micros() - start);
     delay(10);
 }